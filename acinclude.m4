@@ -47,10 +47,10 @@ AC_DEFUN([AX_LIBCFILE_CHECK_LOCAL],
   AC_CHECK_HEADERS([errno.h stdio.h sys/stat.h])
 
   dnl Headers included in libcfile/libcfile_file.c
-  AC_CHECK_HEADERS([cygwin/fs.h fcntl.h linux/fs.h sys/disk.h sys/disklabel.h sys/ioctl.h unistd.h])
+  AC_CHECK_HEADERS([cygwin/fs.h fcntl.h linux/fs.h sys/disk.h sys/disklabel.h sys/ioctl.h sys/uio.h unistd.h])
 
   dnl File input/output functions used in libcfile/libcfile_file.c
-  AC_CHECK_FUNCS([close fstat ftruncate ioctl lseek open read write])
+  AC_CHECK_FUNCS([close fstat ftruncate ioctl lseek open pread preadv pwrite pwritev read readv write writev])
 
   AS_IF(
     [test "x$ac_cv_func_close" != xyes],
@@ -103,6 +103,42 @@ AC_DEFUN([AX_LIBCFILE_CHECK_LOCAL],
       [1])
     ])
 
+  dnl Headers and functions used in libcfile/libcfile_io_ring.c
+  AC_CHECK_HEADERS([linux/io_uring.h sys/mman.h sys/syscall.h])
+
+  AC_CHECK_FUNCS([mmap syscall])
+
+  dnl Memory mapping functions used in libcfile/libcfile_file.c
+  AC_CHECK_FUNCS([madvise munmap])
+
+  dnl Aligned memory allocation function used in libcfile/libcfile_block_cache.c and libcfile/libcfile_file.c
+  AC_CHECK_FUNCS([posix_memalign])
+
+  dnl Storage allocation functions used in libcfile/libcfile_file.c
+  AC_CHECK_FUNCS([fallocate posix_fallocate])
+
+  dnl File synchronization functions used in libcfile/libcfile_file.c
+  AC_CHECK_FUNCS([fdatasync fsync sync_file_range])
+
+  dnl Sleep function and header used to wait in libcfile/libcfile_group_commit.c
+  AC_CHECK_FUNCS([nanosleep])
+
+  AC_CHECK_HEADERS([linux/futex.h])
+
+  dnl Functions used to query the page cache in libcfile/libcfile_file.c
+  AC_CHECK_FUNCS([mincore preadv2])
+
+  dnl Header used to query the physical extents in libcfile/libcfile_file.c
+  AC_CHECK_HEADERS([linux/fiemap.h])
+
+  dnl Headers and functions used to copy and splice ranges in libcfile/libcfile_file.c
+  AC_CHECK_HEADERS([sys/sendfile.h])
+
+  AC_CHECK_FUNCS([copy_file_range sendfile splice])
+
+  dnl Clock function used in libcfile/libcfile_statistics.c
+  AC_CHECK_FUNCS([clock_gettime])
+
   dnl File input/output functions used in libcfile/libcfile_support.c
   AC_CHECK_FUNCS([stat unlink])
 
@@ -121,6 +157,23 @@ AC_DEFUN([AX_LIBCFILE_CHECK_LOCAL],
     ])
   ])
 
+dnl Function to detect whether input/output statistics should be maintained
+AC_DEFUN([AX_LIBCFILE_CHECK_ENABLE_STATISTICS],
+  [AX_COMMON_ARG_DISABLE(
+    [statistics],
+    [statistics],
+    [per file input/output statistics])
+
+  AS_IF(
+    [test "x$ac_cv_enable_statistics" != xno],
+    [AC_DEFINE(
+      [HAVE_LIBCFILE_STATISTICS],
+      [1],
+      [Define to 1 if per file input/output statistics should be maintained.])
+
+    ac_cv_enable_statistics=yes])
+  ])
+
 dnl Function to check if DLL support is needed
 AC_DEFUN([AX_LIBCFILE_CHECK_DLL_SUPPORT],
   [AS_IF(
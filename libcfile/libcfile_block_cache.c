@@ -0,0 +1,817 @@
+/*
+ * Block cache functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libcfile_block_cache.h"
+#include "libcfile_definitions.h"
+#include "libcfile_libcerror.h"
+
+/* Creates a block cache
+ * Make sure the value block_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_block_cache_initialize(
+     libcfile_block_cache_t **block_cache,
+     size_t block_size,
+     int number_of_blocks,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_block_cache_initialize";
+	size_t data_size      = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid block cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_blocks <= 0 )
+	 || ( number_of_blocks > LIBCFILE_MAXIMUM_NUMBER_OF_CACHE_BLOCKS )
+	 || ( (size_t) number_of_blocks > ( (size_t) SSIZE_MAX / block_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of blocks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	data_size = block_size * (size_t) number_of_blocks;
+
+	*block_cache = memory_allocate_structure(
+	                libcfile_block_cache_t );
+
+	if( *block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *block_cache,
+	     0,
+	     sizeof( libcfile_block_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear block cache.",
+		 function );
+
+		memory_free(
+		 *block_cache );
+
+		*block_cache = NULL;
+
+		return( -1 );
+	}
+	( *block_cache )->block_size       = block_size;
+	( *block_cache )->number_of_blocks = number_of_blocks;
+
+	/* Align the data to the block size so that the blocks can be read
+	 * directly when the file is opened for direct access
+	 */
+#if defined( HAVE_POSIX_MEMALIGN )
+	if( ( ( block_size & ( block_size - 1 ) ) == 0 )
+	 && ( ( block_size % sizeof( void * ) ) == 0 ) )
+	{
+		if( posix_memalign(
+		     (void **) &( ( *block_cache )->data ),
+		     block_size,
+		     data_size ) != 0 )
+		{
+			( *block_cache )->data = NULL;
+		}
+	}
+	else
+#endif
+	{
+		( *block_cache )->data = (uint8_t *) memory_allocate(
+		                                      data_size );
+	}
+	if( ( *block_cache )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	( *block_cache )->entries = (libcfile_block_cache_entry_t *) memory_allocate(
+	                                                              sizeof( libcfile_block_cache_entry_t ) * number_of_blocks );
+
+	if( ( *block_cache )->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	/* Use twice the number of blocks as hash buckets to keep the chains short
+	 */
+	( *block_cache )->number_of_buckets = 1;
+
+	while( ( *block_cache )->number_of_buckets < ( 2 * number_of_blocks ) )
+	{
+		( *block_cache )->number_of_buckets <<= 1;
+	}
+	( *block_cache )->buckets = (int *) memory_allocate(
+	                                     sizeof( int ) * ( *block_cache )->number_of_buckets );
+
+	if( ( *block_cache )->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_block_cache_empty(
+	     *block_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to empty block cache.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *block_cache != NULL )
+	{
+		if( ( *block_cache )->buckets != NULL )
+		{
+			memory_free(
+			 ( *block_cache )->buckets );
+		}
+		if( ( *block_cache )->entries != NULL )
+		{
+			memory_free(
+			 ( *block_cache )->entries );
+		}
+		if( ( *block_cache )->data != NULL )
+		{
+			memory_free(
+			 ( *block_cache )->data );
+		}
+		memory_free(
+		 *block_cache );
+
+		*block_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a block cache
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_block_cache_free(
+     libcfile_block_cache_t **block_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_block_cache_free";
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_cache != NULL )
+	{
+		memory_free(
+		 ( *block_cache )->buckets );
+
+		memory_free(
+		 ( *block_cache )->entries );
+
+		memory_free(
+		 ( *block_cache )->data );
+
+		memory_free(
+		 *block_cache );
+
+		*block_cache = NULL;
+	}
+	return( 1 );
+}
+
+/* Empties a block cache
+ * The statistics are not reset
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_block_cache_empty(
+     libcfile_block_cache_t *block_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_block_cache_empty";
+	int bucket_index      = 0;
+	int entry_index       = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	for( bucket_index = 0;
+	     bucket_index < block_cache->number_of_buckets;
+	     bucket_index++ )
+	{
+		block_cache->buckets[ bucket_index ] = -1;
+	}
+	for( entry_index = 0;
+	     entry_index < block_cache->number_of_blocks;
+	     entry_index++ )
+	{
+		block_cache->entries[ entry_index ].offset         = -1;
+		block_cache->entries[ entry_index ].data           = &( block_cache->data[ block_cache->block_size * entry_index ] );
+		block_cache->entries[ entry_index ].next_in_bucket = -1;
+		block_cache->entries[ entry_index ].previous_used  = entry_index - 1;
+		block_cache->entries[ entry_index ].next_used      = entry_index + 1;
+	}
+	block_cache->entries[ block_cache->number_of_blocks - 1 ].next_used = -1;
+
+	block_cache->most_recently_used  = 0;
+	block_cache->least_recently_used = block_cache->number_of_blocks - 1;
+
+	return( 1 );
+}
+
+/* Unlinks an entry from the list of used entries
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_block_cache_unlink_entry(
+     libcfile_block_cache_t *block_cache,
+     int entry_index,
+     libcerror_error_t **error )
+{
+	libcfile_block_cache_entry_t *entry = NULL;
+	static char *function               = "libcfile_block_cache_unlink_entry";
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= block_cache->number_of_blocks ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entry = &( block_cache->entries[ entry_index ] );
+
+	if( entry->previous_used != -1 )
+	{
+		block_cache->entries[ entry->previous_used ].next_used = entry->next_used;
+	}
+	else
+	{
+		block_cache->most_recently_used = entry->next_used;
+	}
+	if( entry->next_used != -1 )
+	{
+		block_cache->entries[ entry->next_used ].previous_used = entry->previous_used;
+	}
+	else
+	{
+		block_cache->least_recently_used = entry->previous_used;
+	}
+	entry->previous_used = -1;
+	entry->next_used     = -1;
+
+	return( 1 );
+}
+
+/* Removes the block of an entry from the cache
+ * The entry becomes the least recently used so that it is reused first
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_block_cache_remove_entry(
+     libcfile_block_cache_t *block_cache,
+     int entry_index,
+     libcerror_error_t **error )
+{
+	libcfile_block_cache_entry_t *entry = NULL;
+	static char *function               = "libcfile_block_cache_remove_entry";
+	int bucket_index                    = 0;
+	int previous_index                  = -1;
+	int search_index                    = 0;
+
+	if( libcfile_block_cache_unlink_entry(
+	     block_cache,
+	     entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to unlink entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	entry = &( block_cache->entries[ entry_index ] );
+
+	if( entry->offset != -1 )
+	{
+		bucket_index = (int) ( ( (uint64_t) entry->offset / block_cache->block_size ) & (uint64_t) ( block_cache->number_of_buckets - 1 ) );
+
+		search_index = block_cache->buckets[ bucket_index ];
+
+		while( ( search_index != -1 )
+		    && ( search_index != entry_index ) )
+		{
+			previous_index = search_index;
+			search_index   = block_cache->entries[ search_index ].next_in_bucket;
+		}
+		if( search_index == entry_index )
+		{
+			if( previous_index != -1 )
+			{
+				block_cache->entries[ previous_index ].next_in_bucket = entry->next_in_bucket;
+			}
+			else
+			{
+				block_cache->buckets[ bucket_index ] = entry->next_in_bucket;
+			}
+		}
+		entry->offset         = -1;
+		entry->next_in_bucket = -1;
+	}
+	entry->previous_used = block_cache->least_recently_used;
+
+	if( block_cache->least_recently_used != -1 )
+	{
+		block_cache->entries[ block_cache->least_recently_used ].next_used = entry_index;
+	}
+	else
+	{
+		block_cache->most_recently_used = entry_index;
+	}
+	block_cache->least_recently_used = entry_index;
+
+	return( 1 );
+}
+
+/* Marks an entry as the most recently used
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_block_cache_use_entry(
+     libcfile_block_cache_t *block_cache,
+     int entry_index,
+     libcerror_error_t **error )
+{
+	libcfile_block_cache_entry_t *entry = NULL;
+	static char *function               = "libcfile_block_cache_use_entry";
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_cache->most_recently_used == entry_index )
+	{
+		return( 1 );
+	}
+	if( libcfile_block_cache_unlink_entry(
+	     block_cache,
+	     entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to unlink entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	entry = &( block_cache->entries[ entry_index ] );
+
+	entry->next_used = block_cache->most_recently_used;
+
+	if( block_cache->most_recently_used != -1 )
+	{
+		block_cache->entries[ block_cache->most_recently_used ].previous_used = entry_index;
+	}
+	else
+	{
+		block_cache->least_recently_used = entry_index;
+	}
+	block_cache->most_recently_used = entry_index;
+
+	return( 1 );
+}
+
+/* Retrieves the data of a cached block
+ * Returns 1 if successful, 0 if the block is not cached or -1 on error
+ */
+int libcfile_block_cache_get_block(
+     libcfile_block_cache_t *block_cache,
+     off64_t offset,
+     uint8_t **data,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_block_cache_get_block";
+	int bucket_index      = 0;
+	int entry_index       = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = (int) ( ( (uint64_t) offset / block_cache->block_size ) & (uint64_t) ( block_cache->number_of_buckets - 1 ) );
+
+	entry_index = block_cache->buckets[ bucket_index ];
+
+	while( entry_index != -1 )
+	{
+		if( block_cache->entries[ entry_index ].offset == offset )
+		{
+			if( libcfile_block_cache_use_entry(
+			     block_cache,
+			     entry_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to mark entry: %d as used.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+			*data = block_cache->entries[ entry_index ].data;
+
+			block_cache->number_of_hits += 1;
+
+			return( 1 );
+		}
+		entry_index = block_cache->entries[ entry_index ].next_in_bucket;
+	}
+	block_cache->number_of_misses += 1;
+
+	return( 0 );
+}
+
+/* Allocates a block in the cache by reusing the least recently used entry
+ * The caller is responsible for filling the data of the block
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_block_cache_allocate_block(
+     libcfile_block_cache_t *block_cache,
+     off64_t offset,
+     uint8_t **data,
+     libcerror_error_t **error )
+{
+	libcfile_block_cache_entry_t *entry = NULL;
+	static char *function               = "libcfile_block_cache_allocate_block";
+	int bucket_index                    = 0;
+	int entry_index                     = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset < 0 )
+	 || ( ( (uint64_t) offset % block_cache->block_size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	entry_index = block_cache->least_recently_used;
+
+	if( libcfile_block_cache_remove_entry(
+	     block_cache,
+	     entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	entry = &( block_cache->entries[ entry_index ] );
+
+	bucket_index = (int) ( ( (uint64_t) offset / block_cache->block_size ) & (uint64_t) ( block_cache->number_of_buckets - 1 ) );
+
+	entry->offset         = offset;
+	entry->next_in_bucket = block_cache->buckets[ bucket_index ];
+
+	block_cache->buckets[ bucket_index ] = entry_index;
+
+	if( libcfile_block_cache_use_entry(
+	     block_cache,
+	     entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to mark entry: %d as used.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	*data = entry->data;
+
+	return( 1 );
+}
+
+/* Removes the cached blocks that overlap with a range
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_block_cache_invalidate_range(
+     libcfile_block_cache_t *block_cache,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_block_cache_invalidate_range";
+	off64_t entry_offset  = 0;
+	int entry_index       = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < block_cache->number_of_blocks;
+	     entry_index++ )
+	{
+		entry_offset = block_cache->entries[ entry_index ].offset;
+
+		if( entry_offset == -1 )
+		{
+			continue;
+		}
+		if( entry_offset >= offset )
+		{
+			if( (size64_t) ( entry_offset - offset ) >= size )
+			{
+				continue;
+			}
+		}
+		else if( (size64_t) ( offset - entry_offset ) >= (size64_t) block_cache->block_size )
+		{
+			continue;
+		}
+		if( libcfile_block_cache_remove_entry(
+		     block_cache,
+		     entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the statistics of the block cache
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_block_cache_get_statistics(
+     libcfile_block_cache_t *block_cache,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_block_cache_get_statistics";
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_hits   = block_cache->number_of_hits;
+	*number_of_misses = block_cache->number_of_misses;
+
+	return( 1 );
+}
+
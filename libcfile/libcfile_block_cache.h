@@ -0,0 +1,162 @@
+/*
+ * Block cache functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCFILE_BLOCK_CACHE_H )
+#define _LIBCFILE_BLOCK_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcfile_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libcfile_block_cache_entry libcfile_block_cache_entry_t;
+
+struct libcfile_block_cache_entry
+{
+	/* The offset of the cached block or -1 if not set
+	 */
+	off64_t offset;
+
+	/* The block data
+	 */
+	uint8_t *data;
+
+	/* The index of the next entry in the same hash bucket or -1 if none
+	 */
+	int next_in_bucket;
+
+	/* The index of the more recently used entry or -1 if none
+	 */
+	int previous_used;
+
+	/* The index of the less recently used entry or -1 if none
+	 */
+	int next_used;
+};
+
+typedef struct libcfile_block_cache libcfile_block_cache_t;
+
+struct libcfile_block_cache
+{
+	/* The block size
+	 */
+	size_t block_size;
+
+	/* The number of blocks
+	 */
+	int number_of_blocks;
+
+	/* The data of all the blocks
+	 */
+	uint8_t *data;
+
+	/* The entries
+	 */
+	libcfile_block_cache_entry_t *entries;
+
+	/* The hash buckets, containing the index of the first entry or -1 if none
+	 */
+	int *buckets;
+
+	/* The number of hash buckets, which is a power of 2
+	 */
+	int number_of_buckets;
+
+	/* The index of the most recently used entry
+	 */
+	int most_recently_used;
+
+	/* The index of the least recently used entry
+	 */
+	int least_recently_used;
+
+	/* The number of lookups that were found in the cache
+	 */
+	uint64_t number_of_hits;
+
+	/* The number of lookups that were not found in the cache
+	 */
+	uint64_t number_of_misses;
+};
+
+int libcfile_block_cache_initialize(
+     libcfile_block_cache_t **block_cache,
+     size_t block_size,
+     int number_of_blocks,
+     libcerror_error_t **error );
+
+int libcfile_block_cache_free(
+     libcfile_block_cache_t **block_cache,
+     libcerror_error_t **error );
+
+int libcfile_block_cache_empty(
+     libcfile_block_cache_t *block_cache,
+     libcerror_error_t **error );
+
+int libcfile_block_cache_unlink_entry(
+     libcfile_block_cache_t *block_cache,
+     int entry_index,
+     libcerror_error_t **error );
+
+int libcfile_block_cache_remove_entry(
+     libcfile_block_cache_t *block_cache,
+     int entry_index,
+     libcerror_error_t **error );
+
+int libcfile_block_cache_use_entry(
+     libcfile_block_cache_t *block_cache,
+     int entry_index,
+     libcerror_error_t **error );
+
+int libcfile_block_cache_get_block(
+     libcfile_block_cache_t *block_cache,
+     off64_t offset,
+     uint8_t **data,
+     libcerror_error_t **error );
+
+int libcfile_block_cache_allocate_block(
+     libcfile_block_cache_t *block_cache,
+     off64_t offset,
+     uint8_t **data,
+     libcerror_error_t **error );
+
+int libcfile_block_cache_invalidate_range(
+     libcfile_block_cache_t *block_cache,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libcfile_block_cache_get_statistics(
+     libcfile_block_cache_t *block_cache,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCFILE_BLOCK_CACHE_H ) */
+
@@ -19,6 +19,12 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+/* O_DIRECT is only defined by fcntl.h on Linux if _GNU_SOURCE is defined
+ */
+#if defined( __linux__ ) && !defined( _GNU_SOURCE )
+#define _GNU_SOURCE
+#endif
+
 #include <common.h>
 #include <memory.h>
 #include <narrow_string.h>
@@ -66,6 +72,10 @@ typedef size_t u64;
 
 #include <linux/fs.h>
 
+#if defined( HAVE_LINUX_FIEMAP_H )
+#include <linux/fiemap.h>
+#endif
+
 #else
 
 #if defined( HAVE_SYS_DISK_H )
@@ -78,22 +88,93 @@ typedef size_t u64;
 
 #endif
 
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_SYS_SENDFILE_H )
+#include <sys/sendfile.h>
+#endif
+
+#if defined( HAVE_SYS_SYSCALL_H )
+#include <sys/syscall.h>
+#endif
+
+#if defined( HAVE_SYS_UIO_H )
+#include <sys/uio.h>
+#endif
+
 #if defined( HAVE_UNISTD_H )
 #include <unistd.h>
 #endif
 
+#include "libcfile_block_cache.h"
 #include "libcfile_definitions.h"
 #include "libcfile_file.h"
+#include "libcfile_group_commit.h"
+#include "libcfile_io_ring.h"
 #include "libcfile_libcerror.h"
 #include "libcfile_libcnotify.h"
+#include "libcfile_readahead.h"
 #include "libcfile_system_string.h"
 #include "libcfile_types.h"
+#include "libcfile_unused.h"
 #include "libcfile_winapi.h"
 
 #if defined( HAVE_IOCTL ) || defined( WINAPI )
 #define LIBCFILE_HAVE_IO_CONTROL	1
 #endif
 
+#if defined( HAVE_SYS_MMAN_H ) && defined( HAVE_MMAP ) && defined( HAVE_MUNMAP ) && !defined( WINAPI )
+#define LIBCFILE_HAVE_MEMORY_MAP	1
+#endif
+
+#if defined( HAVE_LINUX_FIEMAP_H ) && defined( FS_IOC_FIEMAP ) && defined( HAVE_IOCTL ) && !defined( WINAPI )
+#define LIBCFILE_HAVE_FIEMAP		1
+#endif
+
+#if defined( LIBCFILE_HAVE_MEMORY_MAP ) && defined( HAVE_MINCORE )
+#define LIBCFILE_HAVE_MINCORE		1
+#endif
+
+#if defined( HAVE_PREADV2 ) && defined( RWF_NOWAIT ) && !defined( WINAPI )
+#define LIBCFILE_HAVE_READ_NOWAIT	1
+#endif
+
+/* The cachestat system call was added in Linux 6.5 and uses the same number on all
+ * architectures except alpha, older kernels fail with ENOSYS
+ */
+#if defined( __linux__ ) && defined( HAVE_SYSCALL ) && defined( HAVE_SYS_SYSCALL_H )
+#if defined( __NR_cachestat )
+#define LIBCFILE_SYSCALL_CACHESTAT	__NR_cachestat
+#elif !defined( __alpha__ )
+#define LIBCFILE_SYSCALL_CACHESTAT	451
+#endif
+#endif
+
+#if defined( LIBCFILE_SYSCALL_CACHESTAT )
+
+typedef struct libcfile_cachestat_range libcfile_cachestat_range_t;
+
+struct libcfile_cachestat_range
+{
+	uint64_t offset;
+	uint64_t size;
+};
+
+typedef struct libcfile_cachestat libcfile_cachestat_t;
+
+struct libcfile_cachestat
+{
+	uint64_t number_of_cached_pages;
+	uint64_t number_of_dirty_pages;
+	uint64_t number_of_writeback_pages;
+	uint64_t number_of_evicted_pages;
+	uint64_t number_of_recently_evicted_pages;
+};
+
+#endif /* defined( LIBCFILE_SYSCALL_CACHESTAT ) */
+
 /* Creates a file
  * Make sure the value file is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -160,6 +241,8 @@ int libcfile_file_initialize(
 #else
 	internal_file->descriptor = -1;
 #endif
+	internal_file->number_of_cache_blocks = LIBCFILE_DEFAULT_NUMBER_OF_CACHE_BLOCKS;
+
 	*file = (libcfile_file_t *) internal_file;
 
 	return( 1 );
@@ -219,6 +302,74 @@ int libcfile_file_free(
 				result = -1;
 			}
 		}
+		if( internal_file->io_ring != NULL )
+		{
+			if( libcfile_io_ring_free(
+			     &( internal_file->io_ring ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free IO ring.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_file->completions != NULL )
+		{
+			memory_free(
+			 internal_file->completions );
+		}
+		if( internal_file->block_cache != NULL )
+		{
+			if( libcfile_block_cache_free(
+			     &( internal_file->block_cache ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free block cache.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_file->bounce_data != NULL )
+		{
+			memory_free(
+			 internal_file->bounce_data );
+		}
+		if( internal_file->read_block_data != NULL )
+		{
+			memory_free(
+			 internal_file->read_block_data );
+		}
+		if( internal_file->readahead != NULL )
+		{
+			if( libcfile_readahead_free(
+			     &( internal_file->readahead ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free readahead.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_file->write_buffer != NULL )
+		{
+			memory_free(
+			 internal_file->write_buffer );
+		}
 		*file = NULL;
 
 		memory_free(
@@ -291,6 +442,7 @@ int libcfile_file_open_with_error_code(
 	DWORD file_io_shared_flags              = 0;
 	DWORD flags_and_attributes              = 0;
 	size_t filename_length                  = 0;
+	size64_t file_size                      = 0;
 	ssize_t read_count                      = 0;
 
 	if( file == NULL )
@@ -368,6 +520,21 @@ int libcfile_file_open_with_error_code(
 	{
 		file_io_creation_flags = CREATE_ALWAYS;
 	}
+	if( ( access_flags & LIBCFILE_ACCESS_FLAG_DIRECT ) != 0 )
+	{
+		if( ( access_flags & ( LIBCFILE_ACCESS_FLAG_WRITE | LIBCFILE_ACCESS_FLAG_MEMORY_MAP ) ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported access flags: 0x%02x - direct access cannot be combined with write access or memory mapping.",
+			 function,
+			 access_flags );
+
+			return( -1 );
+		}
+	}
 	if( error_code == NULL )
 	{
 		libcerror_error_set(
@@ -402,6 +569,11 @@ int libcfile_file_open_with_error_code(
 	}
 	flags_and_attributes = FILE_ATTRIBUTE_NORMAL;
 
+	if( ( access_flags & LIBCFILE_ACCESS_FLAG_DIRECT ) != 0 )
+	{
+		flags_and_attributes |= FILE_FLAG_NO_BUFFERING;
+	}
+
 	if( internal_file->use_asynchronous_io != 0 )
 	{
 		flags_and_attributes |= FILE_FLAG_OVERLAPPED;
@@ -522,7 +694,7 @@ int libcfile_file_open_with_error_code(
 
 	if( libcfile_internal_file_get_size(
 	     internal_file,
-	     &( internal_file->size ),
+	     &file_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -534,9 +706,29 @@ int libcfile_file_open_with_error_code(
 
 		return( -1 );
 	}
+	libcfile_internal_file_store_size(
+	 internal_file,
+	 file_size );
+
 	internal_file->access_flags   = access_flags;
 	internal_file->current_offset = 0;
 
+	if( ( access_flags & LIBCFILE_ACCESS_FLAG_DIRECT ) != 0 )
+	{
+		if( libcfile_internal_file_initialize_direct_access(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize direct access.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
 
@@ -558,6 +750,7 @@ int libcfile_file_open_with_error_code(
 #endif
 	libcfile_internal_file_t *internal_file = NULL;
 	static char *function                   = "libcfile_file_open_with_error_code";
+	size64_t file_size                      = 0;
 	int file_io_flags                       = 0;
 
 	if( file == NULL )
@@ -625,6 +818,24 @@ int libcfile_file_open_with_error_code(
 	{
 		file_io_flags |= O_TRUNC;
 	}
+	if( ( access_flags & LIBCFILE_ACCESS_FLAG_DIRECT ) != 0 )
+	{
+		if( ( access_flags & ( LIBCFILE_ACCESS_FLAG_WRITE | LIBCFILE_ACCESS_FLAG_MEMORY_MAP ) ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported access flags: 0x%02x - direct access cannot be combined with write access or memory mapping.",
+			 function,
+			 access_flags );
+
+			return( -1 );
+		}
+#if defined( O_DIRECT )
+		file_io_flags |= O_DIRECT;
+#endif
+	}
 	if( error_code == NULL )
 	{
 		libcerror_error_set(
@@ -693,6 +904,26 @@ int libcfile_file_open_with_error_code(
 		}
 		return( -1 );
 	}
+#if !defined( O_DIRECT ) && defined( F_NOCACHE )
+	if( ( access_flags & LIBCFILE_ACCESS_FLAG_DIRECT ) != 0 )
+	{
+		if( fcntl(
+		     internal_file->descriptor,
+		     F_NOCACHE,
+		     1 ) == -1 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 errno,
+			 "%s: unable to disable caching of file.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
 #if defined( __FreeBSD__ ) || defined( __NetBSD__ ) || defined( __OpenBSD__ )
 	if( fstat(
 	     internal_file->descriptor,
@@ -727,7 +958,7 @@ int libcfile_file_open_with_error_code(
 
 	if( libcfile_internal_file_get_size(
 	     internal_file,
-	     &( internal_file->size ),
+	     &file_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -739,9 +970,45 @@ int libcfile_file_open_with_error_code(
 
 		return( -1 );
 	}
+	libcfile_internal_file_store_size(
+	 internal_file,
+	 file_size );
+
 	internal_file->access_flags   = access_flags;
 	internal_file->current_offset = 0;
 
+	if( ( access_flags & LIBCFILE_ACCESS_FLAG_DIRECT ) != 0 )
+	{
+		if( libcfile_internal_file_initialize_direct_access(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize direct access.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( access_flags & LIBCFILE_ACCESS_FLAG_MEMORY_MAP ) != 0 )
+	{
+		if( libcfile_internal_file_map(
+		     internal_file,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to map file.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
 
@@ -803,6 +1070,7 @@ int libcfile_file_open_wide_with_error_code(
 	DWORD file_io_shared_flags              = 0;
 	DWORD flags_and_attributes              = 0;
 	size_t filename_length                  = 0;
+	size64_t file_size                      = 0;
 	ssize_t read_count                      = 0;
 
 	if( file == NULL )
@@ -880,6 +1148,21 @@ int libcfile_file_open_wide_with_error_code(
 	{
 		file_io_creation_flags = CREATE_ALWAYS;
 	}
+	if( ( access_flags & LIBCFILE_ACCESS_FLAG_DIRECT ) != 0 )
+	{
+		if( ( access_flags & ( LIBCFILE_ACCESS_FLAG_WRITE | LIBCFILE_ACCESS_FLAG_MEMORY_MAP ) ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported access flags: 0x%02x - direct access cannot be combined with write access or memory mapping.",
+			 function,
+			 access_flags );
+
+			return( -1 );
+		}
+	}
 	if( error_code == NULL )
 	{
 		libcerror_error_set(
@@ -914,6 +1197,11 @@ int libcfile_file_open_wide_with_error_code(
 	}
 	flags_and_attributes = FILE_ATTRIBUTE_NORMAL;
 
+	if( ( access_flags & LIBCFILE_ACCESS_FLAG_DIRECT ) != 0 )
+	{
+		flags_and_attributes |= FILE_FLAG_NO_BUFFERING;
+	}
+
 	if( internal_file->use_asynchronous_io != 0 )
 	{
 		flags_and_attributes |= FILE_FLAG_OVERLAPPED;
@@ -1034,7 +1322,7 @@ int libcfile_file_open_wide_with_error_code(
 
 	if( libcfile_internal_file_get_size(
 	     internal_file,
-	     &( internal_file->size ),
+	     &file_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1046,9 +1334,29 @@ int libcfile_file_open_wide_with_error_code(
 
 		return( -1 );
 	}
+	libcfile_internal_file_store_size(
+	 internal_file,
+	 file_size );
+
 	internal_file->access_flags   = access_flags;
 	internal_file->current_offset = 0;
 
+	if( ( access_flags & LIBCFILE_ACCESS_FLAG_DIRECT ) != 0 )
+	{
+		if( libcfile_internal_file_initialize_direct_access(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize direct access.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
 
@@ -1073,6 +1381,7 @@ int libcfile_file_open_wide_with_error_code(
 	char *narrow_filename                   = NULL;
 	size_t filename_size                    = 0;
 	size_t narrow_filename_size             = 0;
+	size64_t file_size                      = 0;
 	int file_io_flags                       = 0;
 
 	if( file == NULL )
@@ -1140,6 +1449,24 @@ int libcfile_file_open_wide_with_error_code(
 	{
 		file_io_flags |= O_TRUNC;
 	}
+	if( ( access_flags & LIBCFILE_ACCESS_FLAG_DIRECT ) != 0 )
+	{
+		if( ( access_flags & ( LIBCFILE_ACCESS_FLAG_WRITE | LIBCFILE_ACCESS_FLAG_MEMORY_MAP ) ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported access flags: 0x%02x - direct access cannot be combined with write access or memory mapping.",
+			 function,
+			 access_flags );
+
+			return( -1 );
+		}
+#if defined( O_DIRECT )
+		file_io_flags |= O_DIRECT;
+#endif
+	}
 	if( error_code == NULL )
 	{
 		libcerror_error_set(
@@ -1261,6 +1588,26 @@ int libcfile_file_open_wide_with_error_code(
 		}
 		goto on_error;
 	}
+#if !defined( O_DIRECT ) && defined( F_NOCACHE )
+	if( ( access_flags & LIBCFILE_ACCESS_FLAG_DIRECT ) != 0 )
+	{
+		if( fcntl(
+		     internal_file->descriptor,
+		     F_NOCACHE,
+		     1 ) == -1 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 errno,
+			 "%s: unable to disable caching of file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
 #if defined( __FreeBSD__ ) || defined( __NetBSD__ ) || defined( __OpenBSD__ )
 	if( fstat(
 	     internal_file->descriptor,
@@ -1295,7 +1642,7 @@ int libcfile_file_open_wide_with_error_code(
 
 	if( libcfile_internal_file_get_size(
 	     internal_file,
-	     &( internal_file->size ),
+	     &file_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1307,6 +1654,45 @@ int libcfile_file_open_wide_with_error_code(
 
 		goto on_error;
 	}
+	libcfile_internal_file_store_size(
+	 internal_file,
+	 file_size );
+
+	internal_file->access_flags   = access_flags;
+	internal_file->current_offset = 0;
+
+	if( ( access_flags & LIBCFILE_ACCESS_FLAG_DIRECT ) != 0 )
+	{
+		if( libcfile_internal_file_initialize_direct_access(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize direct access.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( access_flags & LIBCFILE_ACCESS_FLAG_MEMORY_MAP ) != 0 )
+	{
+		if( libcfile_internal_file_map(
+		     internal_file,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to map file.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	return( 1 );
 
 on_error:
@@ -1324,23 +1710,25 @@ on_error:
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
-#if defined( WINAPI )
-
-/* Closes the file
- * This function uses the WINAPI function for Windows 2000 (0x0500) or later
- * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
- * Returns 0 if successful or -1 on error
+/* Memory maps the file
+ * Only regular files that are opened for reading only are memory mapped
+ * Returns 1 if successful, 0 if the file cannot be memory mapped or -1 on error
  */
-int libcfile_file_close(
-     libcfile_file_t *file,
+int libcfile_internal_file_map(
+     libcfile_internal_file_t *internal_file,
      libcerror_error_t **error )
 {
-	libcfile_internal_file_t *internal_file = NULL;
-	static char *function                   = "libcfile_file_close";
-	DWORD error_code                        = 0;
-	BOOL result                             = FALSE;
+#if defined( LIBCFILE_HAVE_MEMORY_MAP )
+	struct stat file_statistics;
 
-	if( file == NULL )
+	void *mapped_data     = NULL;
+	size64_t file_size    = 0;
+	int mapping_flags     = MAP_PRIVATE;
+#endif
+
+	static char *function = "libcfile_internal_file_map";
+
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1351,12 +1739,228 @@ int libcfile_file_close(
 
 		return( -1 );
 	}
-	internal_file = (libcfile_internal_file_t *) file;
+	if( internal_file->mapped_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - mapped data value already set.",
+		 function );
 
-	if( internal_file->handle != INVALID_HANDLE_VALUE )
+		return( -1 );
+	}
+#if defined( LIBCFILE_HAVE_MEMORY_MAP )
+	if( internal_file->descriptor == -1 )
 	{
-#if ( WINVER <= 0x0500 )
-		result = libcfile_CloseHandle(
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->access_flags & LIBCFILE_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		return( 0 );
+	}
+	file_size = libcfile_internal_file_load_size(
+	             internal_file );
+
+	/* An empty file cannot be mapped and the size of a mapping is limited by the address space
+	 */
+	if( ( file_size == 0 )
+	 || ( file_size > (size64_t) SSIZE_MAX ) )
+	{
+		return( 0 );
+	}
+	if( memory_set(
+	     &file_statistics,
+	     0,
+	     sizeof( struct stat ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( fstat(
+	     internal_file->descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	/* Devices are read using the block data
+	 */
+	if( !S_ISREG( file_statistics.st_mode ) )
+	{
+		return( 0 );
+	}
+#if defined( MAP_POPULATE )
+	if( ( internal_file->access_flags & LIBCFILE_ACCESS_FLAG_MEMORY_MAP_POPULATE ) != 0 )
+	{
+		mapping_flags |= MAP_POPULATE;
+	}
+#endif
+	mapped_data = mmap(
+	               NULL,
+	               (size_t) file_size,
+	               PROT_READ,
+	               mapping_flags,
+	               internal_file->descriptor,
+	               0 );
+
+	/* Fall back to reading from the file descriptor if the file cannot be mapped
+	 */
+	if( mapped_data == MAP_FAILED )
+	{
+		return( 0 );
+	}
+	internal_file->mapped_data      = (uint8_t *) mapped_data;
+	internal_file->mapped_data_size = (size_t) file_size;
+
+	return( 1 );
+#else
+	return( 0 );
+#endif /* defined( LIBCFILE_HAVE_MEMORY_MAP ) */
+}
+
+/* Unmaps the file
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_internal_file_unmap(
+     libcfile_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_internal_file_unmap";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCFILE_HAVE_MEMORY_MAP )
+	if( internal_file->mapped_data != NULL )
+	{
+		if( munmap(
+		     (void *) internal_file->mapped_data,
+		     internal_file->mapped_data_size ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 errno,
+			 "%s: unable to unmap file.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif /* defined( LIBCFILE_HAVE_MEMORY_MAP ) */
+
+	internal_file->mapped_data      = NULL;
+	internal_file->mapped_data_size = 0;
+
+	return( 1 );
+}
+
+#if defined( WINAPI )
+
+/* Closes the file
+ * This function uses the WINAPI function for Windows 2000 (0x0500) or later
+ * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
+ * Returns 0 if successful or -1 on error
+ */
+int libcfile_file_close(
+     libcfile_file_t *file,
+     libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_close";
+	DWORD error_code                        = 0;
+	BOOL result                             = FALSE;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+	if( internal_file->write_buffer_data_size > 0 )
+	{
+		if( libcfile_internal_file_flush_write_buffer(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write buffer.",
+			 function );
+
+			/* The buffered data is discarded so that the file can still be closed
+			 */
+			internal_file->write_buffer_data_size = 0;
+
+			return( -1 );
+		}
+	}
+	if( internal_file->io_ring != NULL )
+	{
+		if( libcfile_io_ring_free(
+		     &( internal_file->io_ring ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free IO ring.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_file->completions != NULL )
+	{
+		memory_free(
+		 internal_file->completions );
+
+		internal_file->completions = NULL;
+	}
+	if( internal_file->handle != INVALID_HANDLE_VALUE )
+	{
+#if ( WINVER <= 0x0500 )
+		result = libcfile_CloseHandle(
 		          internal_file->handle );
 #else
 		result = CloseHandle(
@@ -1376,25 +1980,52 @@ int libcfile_file_close(
 
 			return( -1 );
 		}
-		internal_file->handle              = INVALID_HANDLE_VALUE;
-		internal_file->is_device_filename  = 0;
-		internal_file->use_asynchronous_io = 0;
-		internal_file->access_flags        = 0;
-		internal_file->size                = 0;
-		internal_file->current_offset      = 0;
+		internal_file->handle                = INVALID_HANDLE_VALUE;
+		internal_file->is_device_filename    = 0;
+		internal_file->use_asynchronous_io   = 0;
+		internal_file->access_flags          = 0;
+		internal_file->current_offset        = 0;
+		internal_file->preallocated_offset   = 0;
+		internal_file->preallocation_step    = internal_file->preallocation_size;
+		internal_file->skip_holes            = 0;
+		internal_file->writeback_offset      = 0;
+		internal_file->writeback_wait_offset = 0;
+		internal_file->writeback_error_code  = 0;
+		internal_file->access_behavior       = LIBCFILE_ACCESS_BEHAVIOR_NORMAL;
+		internal_file->streaming_offset      = 0;
+		internal_file->streaming_end_offset  = 0;
+
+		libcfile_internal_file_store_size(
+		 internal_file,
+		 0 );
+	}
+	if( internal_file->block_cache != NULL )
+	{
+		if( libcfile_block_cache_empty(
+		     internal_file->block_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty block cache.",
+			 function );
+
+			return( -1 );
+		}
 	}
-	if( internal_file->block_data != NULL )
+	if( internal_file->readahead != NULL )
 	{
-		if( memory_set(
-		     internal_file->block_data,
-		     0,
-		     internal_file->block_size ) == NULL )
+		if( libcfile_readahead_reset(
+		     internal_file->readahead,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to clear block data.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to reset readahead.",
 			 function );
 
 			return( -1 );
@@ -1407,6 +2038,7 @@ int libcfile_file_close(
 
 /* Closes the file
  * This function uses the POSIX close function or equivalent
+ * A failed write back that was not yet reported is reported after the file was closed
  * Returns 0 if successful or -1 on error
  */
 int libcfile_file_close(
@@ -1415,6 +2047,8 @@ int libcfile_file_close(
 {
 	libcfile_internal_file_t *internal_file = NULL;
 	static char *function                   = "libcfile_file_close";
+	size64_t file_size                      = 0;
+	int result                              = 0;
 
 	if( file == NULL )
 	{
@@ -1429,8 +2063,103 @@ int libcfile_file_close(
 	}
 	internal_file = (libcfile_internal_file_t *) file;
 
+	if( internal_file->write_buffer_data_size > 0 )
+	{
+		if( libcfile_internal_file_flush_write_buffer(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write buffer.",
+			 function );
+
+			/* The buffered data is discarded so that the file can still be closed
+			 */
+			internal_file->write_buffer_data_size = 0;
+
+			return( -1 );
+		}
+	}
+	if( internal_file->io_ring != NULL )
+	{
+		if( libcfile_io_ring_free(
+		     &( internal_file->io_ring ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free IO ring.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_file->completions != NULL )
+	{
+		memory_free(
+		 internal_file->completions );
+
+		internal_file->completions = NULL;
+	}
+	if( internal_file->mapped_data != NULL )
+	{
+		if( libcfile_internal_file_unmap(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to unmap file.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	if( internal_file->descriptor != -1 )
 	{
+		file_size = libcfile_internal_file_load_size(
+		             internal_file );
+
+		/* Release the storage that was preallocated beyond the end of file
+		 */
+		if( internal_file->preallocated_offset > file_size )
+		{
+			if( ftruncate(
+			     internal_file->descriptor,
+			     (off_t) file_size ) != 0 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_GENERIC,
+				 errno,
+				 "%s: unable to release preallocated storage.",
+				 function );
+
+				return( -1 );
+			}
+		}
+#if defined( HAVE_POSIX_FADVISE )
+		/* Remove the data that was read in streaming access behavior
+		 * and not yet removed from the page cache
+		 */
+		if( ( internal_file->access_behavior == LIBCFILE_ACCESS_BEHAVIOR_STREAMING )
+		 && ( internal_file->streaming_end_offset > internal_file->streaming_offset ) )
+		{
+			posix_fadvise(
+			 internal_file->descriptor,
+			 (off_t) internal_file->streaming_offset,
+			 (off_t) ( internal_file->streaming_end_offset - internal_file->streaming_offset ),
+			 POSIX_FADV_DONTNEED );
+		}
+#endif
 		if( close(
 		     internal_file->descriptor ) != 0 )
 		{
@@ -1444,29 +2173,73 @@ int libcfile_file_close(
 
 			return( -1 );
 		}
-		internal_file->descriptor     = -1;
-		internal_file->access_flags   = 0;
-		internal_file->size           = 0;
-		internal_file->current_offset = 0;
+		/* The failure of a write back that was not yet reported cannot be
+		 * reported by the system anymore hence it is reported by the close
+		 */
+		if( libcfile_internal_file_get_writeback_error(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write back data.",
+			 function );
+
+			result = -1;
+		}
+		internal_file->descriptor            = -1;
+		internal_file->access_flags          = 0;
+		internal_file->current_offset        = 0;
+		internal_file->descriptor_offset     = 0;
+		internal_file->preallocated_offset   = 0;
+		internal_file->preallocation_step    = internal_file->preallocation_size;
+		internal_file->skip_holes            = 0;
+		internal_file->writeback_offset      = 0;
+		internal_file->writeback_wait_offset = 0;
+		internal_file->writeback_error_code  = 0;
+		internal_file->access_behavior       = LIBCFILE_ACCESS_BEHAVIOR_NORMAL;
+		internal_file->streaming_offset      = 0;
+		internal_file->streaming_end_offset  = 0;
+
+		libcfile_internal_file_store_size(
+		 internal_file,
+		 0 );
+	}
+	if( internal_file->block_cache != NULL )
+	{
+		if( libcfile_block_cache_empty(
+		     internal_file->block_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty block cache.",
+			 function );
+
+			return( -1 );
+		}
 	}
-	if( internal_file->block_data != NULL )
+	if( internal_file->readahead != NULL )
 	{
-		if( memory_set(
-		     internal_file->block_data,
-		     0,
-		     internal_file->block_size ) == NULL )
+		if( libcfile_readahead_reset(
+		     internal_file->readahead,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to clear block data.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to reset readahead.",
 			 function );
 
 			return( -1 );
 		}
 	}
-	return( 0 );
+	return( result );
 }
 
 #else
@@ -1509,9 +2282,8 @@ ssize_t libcfile_file_read_buffer(
 
 #if defined( WINAPI )
 
-/* Reads a buffer from the file
+/* Reads a buffer from the file at a specific offset
  * This is an internal function to wrap ReadFile in synchronous and asynchronous mode
- * the current_offset is only used in asynchronous mode.
  * Returns the number of bytes read if successful, or -1 on error
  */
 ssize_t libcfile_internal_file_read_buffer_at_offset_with_error_code(
@@ -1530,6 +2302,10 @@ ssize_t libcfile_internal_file_read_buffer_at_offset_with_error_code(
 	BOOL io_pending        = FALSE;
 	BOOL result            = FALSE;
 
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	uint64_t start_timestamp = 0;
+#endif
+
 	if( internal_file == NULL )
 	{
 		libcerror_error_set(
@@ -1594,28 +2370,33 @@ ssize_t libcfile_internal_file_read_buffer_at_offset_with_error_code(
 	 * if the device is read concurrently and the the block is too large
 	 * to fill. Using smaller block sizes decreases the likelyhood but
 	 * also impacts the performance.
+	 *
+	 * The overlapped data is also used in synchronous mode to read
+	 * at the offset, ReadFile then does not return until the read
+	 * has completed.
 	 */
-	if( internal_file->use_asynchronous_io != 0 )
+	if( memory_set(
+	     &overlapped_data,
+	     0,
+	     sizeof( OVERLAPPED ) ) == NULL )
 	{
-		if( memory_set(
-		     &overlapped_data,
-		     0,
-		     sizeof( OVERLAPPED ) ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to clear overlapped data.",
-			 function );
-
-			return( -1 );
-		}
-		overlapped = &overlapped_data;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear overlapped data.",
+		 function );
 
-		overlapped->Offset     = (DWORD) ( 0x0ffffffffUL & current_offset );
-		overlapped->OffsetHigh = (DWORD) ( current_offset >> 32 );
+		return( -1 );
 	}
+	overlapped = &overlapped_data;
+
+	overlapped->Offset     = (DWORD) ( 0x0ffffffffUL & current_offset );
+	overlapped->OffsetHigh = (DWORD) ( current_offset >> 32 );
+
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	start_timestamp = libcfile_statistics_get_timestamp();
+#endif
 #if ( WINVER <= 0x0500 )
 	result = libcfile_ReadFile(
 		  internal_file->handle,
@@ -1630,6 +2411,13 @@ ssize_t libcfile_internal_file_read_buffer_at_offset_with_error_code(
 		  (DWORD) size,
 		  &read_count,
 		  overlapped );
+#endif
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	libcfile_statistics_add_operation(
+	 &( internal_file->statistics ),
+	 LIBCFILE_OPERATION_TYPE_READ,
+	 ( result != 0 ) ? (ssize_t) read_count : -1,
+	 start_timestamp );
 #endif
 	if( result == 0 )
 	{
@@ -1696,27 +2484,33 @@ ssize_t libcfile_internal_file_read_buffer_at_offset_with_error_code(
 	return( (ssize_t) read_count );
 }
 
-/* Reads a buffer from the file
- * This function uses the WINAPI function for Windows XP (0x0501) or later
- * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
+#elif defined( HAVE_READ )
+
+/* Reads a buffer from the file at a specific offset
+ * This is an internal function to wrap pread, which does not change
+ * the offset of the file descriptor
  * Returns the number of bytes read if successful, or -1 on error
  */
-ssize_t libcfile_file_read_buffer_with_error_code(
-         libcfile_file_t *file,
+ssize_t libcfile_internal_file_read_buffer_at_offset_with_error_code(
+         libcfile_internal_file_t *internal_file,
+         off64_t current_offset,
          uint8_t *buffer,
          size_t size,
          uint32_t *error_code,
          libcerror_error_t **error )
 {
-	libcfile_internal_file_t *internal_file = NULL;
-	static char *function                   = "libcfile_file_read_buffer_with_error_code";
-	size_t buffer_offset                    = 0;
-	size_t read_size                        = 0;
-	size_t read_size_remainder              = 0;
-	ssize_t read_count                      = 0;
-	BOOL result                             = FALSE;
+	static char *function   = "libcfile_internal_file_read_buffer_at_offset_with_error_code";
+	ssize_t read_count      = 0;
 
-	if( file == NULL )
+#if !defined( HAVE_PREAD )
+	off_t descriptor_offset = 0;
+#endif
+
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	uint64_t start_timestamp = 0;
+#endif
+
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1727,15 +2521,24 @@ ssize_t libcfile_file_read_buffer_with_error_code(
 
 		return( -1 );
 	}
-	internal_file = (libcfile_internal_file_t *) file;
-
-	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	if( internal_file->descriptor == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing handle.",
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( current_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid current offset value out of bounds.",
 		 function );
 
 		return( -1 );
@@ -1751,11 +2554,7 @@ ssize_t libcfile_file_read_buffer_with_error_code(
 
 		return( -1 );
 	}
-#if ( UINT32_MAX < SSIZE_MAX )
-	if( size > (size_t) UINT32_MAX )
-#else
 	if( size > (size_t) SSIZE_MAX )
-#endif
 	{
 		libcerror_error_set(
 		 error,
@@ -1777,250 +2576,244 @@ ssize_t libcfile_file_read_buffer_with_error_code(
 
 		return( -1 );
 	}
-	if( internal_file->block_size != 0 )
+	if( internal_file->mapped_data != NULL )
 	{
-		if( internal_file->block_data == NULL )
+		if( (size64_t) current_offset >= (size64_t) internal_file->mapped_data_size )
+		{
+			return( 0 );
+		}
+		if( size > ( internal_file->mapped_data_size - (size_t) current_offset ) )
+		{
+			size = internal_file->mapped_data_size - (size_t) current_offset;
+		}
+		if( memory_copy(
+		     buffer,
+		     &( internal_file->mapped_data[ current_offset ] ),
+		     size ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid file - missing block data.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy mapped data to buffer.",
 			 function );
 
 			return( -1 );
 		}
+		return( (ssize_t) size );
 	}
-	if( internal_file->current_offset < 0 )
+	errno = 0;
+
+#if defined( HAVE_PREAD )
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	start_timestamp = libcfile_statistics_get_timestamp();
+#endif
+	read_count = pread(
+	              internal_file->descriptor,
+	              (void *) buffer,
+	              size,
+	              (off_t) current_offset );
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	libcfile_statistics_add_operation(
+	 &( internal_file->statistics ),
+	 LIBCFILE_OPERATION_TYPE_READ,
+	 read_count,
+	 start_timestamp );
+#endif
+
+#else
+	/* Without pread the offset of the file descriptor is restored afterwards
+	 */
+	descriptor_offset = lseek(
+	                     internal_file->descriptor,
+	                     0,
+	                     SEEK_CUR );
+
+	if( descriptor_offset < 0 )
 	{
-		libcerror_error_set(
+		*error_code = (uint32_t) errno;
+
+		libcerror_system_set_error(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid file - current offset value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 *error_code,
+		 "%s: unable to determine offset in file.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( size == 0 )
-	 || ( (size64_t) internal_file->current_offset > internal_file->size ) )
+	if( lseek(
+	     internal_file->descriptor,
+	     (off_t) current_offset,
+	     SEEK_SET ) < 0 )
 	{
-		return( 0 );
+		*error_code = (uint32_t) errno;
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 *error_code,
+		 "%s: unable to seek offset in file.",
+		 function );
+
+		return( -1 );
 	}
-	if( ( (size64_t) internal_file->current_offset + size ) > internal_file->size )
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	start_timestamp = libcfile_statistics_get_timestamp();
+#endif
+	read_count = read(
+	              internal_file->descriptor,
+	              (void *) buffer,
+	              size );
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	libcfile_statistics_add_operation(
+	 &( internal_file->statistics ),
+	 LIBCFILE_OPERATION_TYPE_READ,
+	 read_count,
+	 start_timestamp );
+#endif
+
+	if( read_count < 0 )
 	{
-		size = (size_t) ( internal_file->size - internal_file->current_offset );
+		*error_code = (uint32_t) errno;
 	}
-	if( internal_file->block_size != 0 )
+	if( lseek(
+	     internal_file->descriptor,
+	     descriptor_offset,
+	     SEEK_SET ) < 0 )
 	{
-		/* Read a block of data to align with the next block
-		 */
-		if( ( internal_file->block_data_offset > 0 )
-		 && ( internal_file->block_data_size == 0 ) )
-		{
-			if( memory_set(
-			     internal_file->block_data,
-			     0,
-			     internal_file->block_size ) == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-				 "%s: unable to clear block data.",
-				 function );
-
-				return( -1 );
-			}
-			read_count = libcfile_internal_file_read_buffer_at_offset_with_error_code(
-			              internal_file,
-			              internal_file->current_offset - internal_file->block_data_offset,
-			              internal_file->block_data,
-			              internal_file->block_size,
-			              error_code,
-			              error );
+		*error_code = (uint32_t) errno;
 
-			if( read_count != (ssize_t) internal_file->block_size )
-			{
-				libcerror_system_set_error(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 *error_code,
-				 "%s: unable to read from file (pre-aligned, count: %" PRIzd ").",
-				 function,
-				 read_count );
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 *error_code,
+		 "%s: unable to restore offset in file.",
+		 function );
 
-				return( -1 );
-			}
-			internal_file->block_data_size = (size_t) read_count;
-		}
-		if( ( internal_file->block_data_offset > 0 )
-		 && ( internal_file->block_data_offset < internal_file->block_data_size ) )
-		{
-			read_size = internal_file->block_data_size - internal_file->block_data_offset;
+		return( -1 );
+	}
+#endif /* defined( HAVE_PREAD ) */
 
-			if( read_size > size )
-			{
-				read_size = size;
-			}
-			if( memory_copy(
-			     buffer,
-			     &( internal_file->block_data[ internal_file->block_data_offset ] ),
-			     read_size ) == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to copy block data.",
-				 function );
+	if( read_count < 0 )
+	{
+#if defined( HAVE_PREAD )
+		*error_code = (uint32_t) errno;
+#endif
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 *error_code,
+		 "%s: unable to read from file.",
+		 function );
 
-				return( -1 );
-			}
-			buffer_offset                    += read_size;
-			size                             -= read_size;
-			internal_file->current_offset    += read_size;
-			internal_file->block_data_offset += read_size;
-		}
-		if( size == 0 )
-		{
-			return( (ssize_t) buffer_offset );
-		}
+		return( -1 );
 	}
-	read_size = size;
+	return( read_count );
+}
 
-	if( internal_file->block_size != 0 )
+#else
+#error Missing file read function
+#endif
+
+/* Allocates block data that is aligned to the block size if possible
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_internal_file_allocate_block_data(
+     libcfile_internal_file_t *internal_file,
+     size_t size,
+     uint8_t **block_data,
+     libcerror_error_t **error )
+{
+	uint8_t *safe_block_data = NULL;
+	static char *function    = "libcfile_internal_file_allocate_block_data";
+
+	if( internal_file == NULL )
 	{
-		/* Read block aligned
-		 */
-		read_size_remainder = read_size % internal_file->block_size;
-		read_size          -= read_size_remainder;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
 	}
-	if( read_size > 0 )
+	if( ( size == 0 )
+	 || ( size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
 	{
-		read_count = libcfile_internal_file_read_buffer_at_offset_with_error_code(
-		              internal_file,
-		              internal_file->current_offset,
-		              &( buffer[ buffer_offset ] ),
-		              read_size,
-		              error_code,
-		              error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
 
-		if( ( internal_file->block_size == 0 )
-		 && ( read_count < 0 ) )
-		{
-			result = 0;
-		}
-		else if( ( internal_file->block_size != 0 )
-		      && ( read_count != (ssize_t) read_size ) )
-		{
-			result = 0;
-		}
-		else
-		{
-			result = 1;
-		}
-		if( result == 0 )
-		{
-			libcerror_system_set_error(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 *error_code,
-			 "%s: unable to read from file.",
-			 function );
+		return( -1 );
+	}
+	if( block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block data.",
+		 function );
 
-			return( -1 );
-		}
-		buffer_offset                 += (size_t) read_count;
-		internal_file->current_offset += read_count;
+		return( -1 );
 	}
-	/* Read the non-aligned remainder
-	 */
-	if( read_size_remainder > 0 )
+#if defined( HAVE_POSIX_MEMALIGN )
+	if( ( internal_file->block_size != 0 )
+	 && ( ( internal_file->block_size & ( internal_file->block_size - 1 ) ) == 0 )
+	 && ( ( internal_file->block_size % sizeof( void * ) ) == 0 ) )
 	{
-		if( memory_set(
-		     internal_file->block_data,
-		     0,
-		     internal_file->block_size ) == NULL )
+		if( posix_memalign(
+		     (void **) &safe_block_data,
+		     internal_file->block_size,
+		     size ) != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to clear block data.",
-			 function );
-
-			return( -1 );
+			safe_block_data = NULL;
 		}
-		read_count = libcfile_internal_file_read_buffer_at_offset_with_error_code(
-		              internal_file,
-		              internal_file->current_offset,
-		              internal_file->block_data,
-		              internal_file->block_size,
-		              error_code,
-		              error );
-
-		if( read_count != (ssize_t) internal_file->block_size )
-		{
-			libcerror_system_set_error(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 *error_code,
-			 "%s: unable to read from file (post-aligned, count: %" PRIzd ").",
-			 function,
-			 read_count );
-
-			return( -1 );
-		}
-		internal_file->block_data_offset = 0;
-		internal_file->block_data_size   = (size_t) read_count;
-
-		if( memory_copy(
-		     &( buffer[ buffer_offset ] ),
-		     internal_file->block_data,
-		     read_size_remainder ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy block data.",
-			 function );
+	}
+	else
+#endif
+	{
+		safe_block_data = (uint8_t *) memory_allocate(
+		                               size );
+	}
+	if( safe_block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block data.",
+		 function );
 
-			return( -1 );
-		}
-		buffer_offset                    += read_size_remainder;
-		internal_file->current_offset    += read_size_remainder;
-		internal_file->block_data_offset += read_size_remainder;
+		return( -1 );
 	}
-	return( (ssize_t) buffer_offset );
-}
+	*block_data = safe_block_data;
 
-#elif defined( HAVE_READ )
+	return( 1 );
+}
 
-/* Reads a buffer from the file
- * This function uses the POSIX read function or equivalent
- * Returns the number of bytes read if successful, or -1 on error
+/* Allocates the bounce data of the file
+ * The bounce data is used to read block aligned data into a buffer that
+ * is not block aligned, without allocating block data for every read
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libcfile_file_read_buffer_with_error_code(
-         libcfile_file_t *file,
-         uint8_t *buffer,
-         size_t size,
-         uint32_t *error_code,
-         libcerror_error_t **error )
+int libcfile_internal_file_allocate_bounce_data(
+     libcfile_internal_file_t *internal_file,
+     libcerror_error_t **error )
 {
-	libcfile_internal_file_t *internal_file = NULL;
-	static char *function                   = "libcfile_file_read_buffer_with_error_code";
-	size_t buffer_offset                    = 0;
-	size_t read_size                        = 0;
-	size_t read_size_remainder              = 0;
-	ssize_t read_count                      = 0;
-	int result                              = 0;
+	static char *function   = "libcfile_internal_file_allocate_bounce_data";
+	size_t bounce_data_size = 0;
 
-	if( file == NULL )
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -2031,260 +2824,322 @@ ssize_t libcfile_file_read_buffer_with_error_code(
 
 		return( -1 );
 	}
-	internal_file = (libcfile_internal_file_t *) file;
-
-	if( internal_file->descriptor == -1 )
+	if( internal_file->block_size == 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing descriptor.",
+		 "%s: invalid file - missing block size.",
 		 function );
 
 		return( -1 );
 	}
-	if( buffer == NULL )
+	if( internal_file->bounce_data != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid buffer.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - bounce data value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( size > (size_t) SSIZE_MAX )
+	bounce_data_size = LIBCFILE_MAXIMUM_DIRECT_ACCESS_BOUNCE_SIZE - ( LIBCFILE_MAXIMUM_DIRECT_ACCESS_BOUNCE_SIZE % internal_file->block_size );
+
+	if( bounce_data_size == 0 )
+	{
+		bounce_data_size = internal_file->block_size;
+	}
+	if( libcfile_internal_file_allocate_block_data(
+	     internal_file,
+	     bounce_data_size,
+	     &( internal_file->bounce_data ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create bounce data.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->bounce_data_size = bounce_data_size;
+
+	return( 1 );
+}
+
+/* Retrieves block data of the block size for a read at a specific offset
+ * The block data of the file is reused if it is not used by another read,
+ * otherwise separate block data is allocated
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_internal_file_acquire_read_block_data(
+     libcfile_internal_file_t *internal_file,
+     uint8_t **block_data,
+     libcerror_error_t **error )
+{
+	uint8_t *safe_block_data = NULL;
+	static char *function    = "libcfile_internal_file_acquire_read_block_data";
+
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-	if( error_code == NULL )
+	if( block_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid error code.",
+		 "%s: invalid block data.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->block_size != 0 )
+#if defined( WINAPI )
+	safe_block_data = (uint8_t *) InterlockedExchangePointer(
+	                               (PVOID volatile *) &( internal_file->read_block_data ),
+	                               NULL );
+#elif defined( __GNUC__ )
+	safe_block_data = __atomic_exchange_n(
+	                   &( internal_file->read_block_data ),
+	                   NULL,
+	                   __ATOMIC_ACQUIRE );
+#endif
+	if( safe_block_data == NULL )
 	{
-		if( internal_file->block_data == NULL )
+		if( libcfile_internal_file_allocate_block_data(
+		     internal_file,
+		     internal_file->block_size,
+		     &safe_block_data,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid file - missing block data.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create block data.",
 			 function );
 
 			return( -1 );
 		}
 	}
-	if( internal_file->current_offset < 0 )
+	*block_data = safe_block_data;
+
+	return( 1 );
+}
+
+/* Releases block data that was retrieved for a read at a specific offset
+ * The block data is kept for reuse unless the file already has block data to reuse
+ */
+void libcfile_internal_file_release_read_block_data(
+      libcfile_internal_file_t *internal_file,
+      uint8_t *block_data )
+{
+#if !defined( WINAPI ) && defined( __GNUC__ )
+	uint8_t *read_block_data = NULL;
+#endif
+
+	if( ( internal_file == NULL )
+	 || ( block_data == NULL ) )
+	{
+		return;
+	}
+#if defined( WINAPI )
+	if( InterlockedCompareExchangePointer(
+	     (PVOID volatile *) &( internal_file->read_block_data ),
+	     (PVOID) block_data,
+	     NULL ) == NULL )
+	{
+		return;
+	}
+#elif defined( __GNUC__ )
+	if( __atomic_compare_exchange_n(
+	     &( internal_file->read_block_data ),
+	     &read_block_data,
+	     block_data,
+	     0,
+	     __ATOMIC_RELEASE,
+	     __ATOMIC_RELAXED ) != 0 )
+	{
+		return;
+	}
+#endif
+	memory_free(
+	 block_data );
+}
+
+/* Determines if a buffer can be used to read directly from the file
+ * For direct access the buffer must be aligned to the block size
+ * Returns 1 if aligned, 0 if not
+ */
+int libcfile_internal_file_buffer_is_block_aligned(
+     libcfile_internal_file_t *internal_file,
+     const uint8_t *buffer )
+{
+	if( ( ( internal_file->access_flags & LIBCFILE_ACCESS_FLAG_DIRECT ) == 0 )
+	 || ( internal_file->block_size == 0 ) )
+	{
+		return( 1 );
+	}
+	if( ( (uintptr_t) buffer % internal_file->block_size ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Reads block aligned data from the file at a specific offset
+ * If the buffer cannot be used for direct access the data is read into
+ * aligned block data of at most LIBCFILE_MAXIMUM_DIRECT_ACCESS_BOUNCE_SIZE
+ * and copied into the buffer
+ * The bounce data of the file is used if provided, otherwise the block data
+ * is allocated so that the function can be called concurrently
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libcfile_internal_file_read_aligned_buffer_at_offset_with_error_code(
+         libcfile_internal_file_t *internal_file,
+         off64_t offset,
+         uint8_t *buffer,
+         size_t size,
+         uint8_t *bounce_data,
+         uint32_t *error_code,
+         libcerror_error_t **error )
+{
+	uint8_t *block_data   = NULL;
+	static char *function = "libcfile_internal_file_read_aligned_buffer_at_offset_with_error_code";
+	size_t block_size     = 0;
+	size_t buffer_offset  = 0;
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid file - current offset value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( size == 0 )
-	 || ( (size64_t) internal_file->current_offset > internal_file->size ) )
+	if( libcfile_internal_file_buffer_is_block_aligned(
+	     internal_file,
+	     buffer ) != 0 )
 	{
-		return( 0 );
+		return( libcfile_internal_file_read_buffer_at_offset_with_error_code(
+		         internal_file,
+		         offset,
+		         buffer,
+		         size,
+		         error_code,
+		         error ) );
 	}
-	if( ( (size64_t) internal_file->current_offset + size ) > internal_file->size )
+	if( buffer == NULL )
 	{
-		size = (size_t) ( internal_file->size - internal_file->current_offset );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
 	}
-	if( internal_file->block_size != 0 )
+	if( error_code == NULL )
 	{
-		/* Read a block of data to align with the next block
-		 */
-		if( ( internal_file->block_data_offset > 0 )
-		 && ( internal_file->block_data_size == 0 ) )
-		{
-			if( memory_set(
-			     internal_file->block_data,
-			     0,
-			     internal_file->block_size ) == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-				 "%s: unable to clear block data.",
-				 function );
-
-				return( -1 );
-			}
-			errno = 0;
-
-			read_count = read(
-			              internal_file->descriptor,
-			              internal_file->block_data,
-			              internal_file->block_size );
-
-			if( read_count != (ssize_t) internal_file->block_size )
-			{
-				*error_code = (uint32_t) errno;
-
-				libcerror_system_set_error(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 *error_code,
-				 "%s: unable to read from file (pre-aligned, count: %" PRIzd ").",
-				 function,
-				 read_count );
-
-				return( -1 );
-			}
-			internal_file->block_data_size = (size_t) read_count;
-		}
-		if( ( internal_file->block_data_offset > 0 )
-		 && ( internal_file->block_data_offset < internal_file->block_data_size ) )
-		{
-			read_size = internal_file->block_data_size - internal_file->block_data_offset;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
+		 function );
 
-			if( read_size > size )
-			{
-				read_size = size;
-			}
-			if( memory_copy(
-			     buffer,
-			     &( internal_file->block_data[ internal_file->block_data_offset ] ),
-			     read_size ) == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to copy block data.",
-				 function );
+		return( -1 );
+	}
+	if( bounce_data != NULL )
+	{
+		block_data = bounce_data;
+		block_size = internal_file->bounce_data_size;
+	}
+	else
+	{
+		block_size = LIBCFILE_MAXIMUM_DIRECT_ACCESS_BOUNCE_SIZE - ( LIBCFILE_MAXIMUM_DIRECT_ACCESS_BOUNCE_SIZE % internal_file->block_size );
 
-				return( -1 );
-			}
-			buffer_offset                    += read_size;
-			size                             -= read_size;
-			internal_file->block_data_offset += read_size;
-			internal_file->current_offset    += read_size;
-		}
-		if( size == 0 )
+		if( block_size == 0 )
 		{
-			return( (ssize_t) buffer_offset );
+			block_size = internal_file->block_size;
 		}
 	}
-	read_size = size;
-
-	if( internal_file->block_size != 0 )
+	if( block_size > size )
 	{
-		/* Read block aligned
-		 */
-		read_size_remainder = read_size % internal_file->block_size;
-		read_size          -= read_size_remainder;
+		block_size = size;
 	}
-	if( read_size > 0 )
+	if( size == 0 )
 	{
-		errno = 0;
-
-		read_count = read(
-		              internal_file->descriptor,
-		              (void *) &( buffer[ buffer_offset ] ),
-		              read_size );
-
-		if( ( internal_file->block_size == 0 )
-		 && ( read_count < 0 ) )
+		return( 0 );
+	}
+	if( block_data == NULL )
+	{
+		if( libcfile_internal_file_allocate_block_data(
+		     internal_file,
+		     block_size,
+		     &block_data,
+		     error ) != 1 )
 		{
-			result = 0;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create block data.",
+			 function );
+
+			goto on_error;
 		}
-		else if( ( internal_file->block_size != 0 )
-		      && ( read_count != (ssize_t) read_size ) )
+	}
+	while( buffer_offset < size )
+	{
+		read_size = size - buffer_offset;
+
+		if( read_size > block_size )
 		{
-			result = 0;
+			read_size = block_size;
 		}
-		else
-		{
-			result = 1;
-		}
-		if( result == 0 )
-		{
-			*error_code = (uint32_t) errno;
-
-			libcerror_system_set_error(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 *error_code,
-			 "%s: unable to read from file.",
-			 function );
+		read_count = libcfile_internal_file_read_buffer_at_offset_with_error_code(
+		              internal_file,
+		              offset + (off64_t) buffer_offset,
+		              block_data,
+		              read_size,
+		              error_code,
+		              error );
 
-			return( -1 );
-		}
-		buffer_offset                 += (size_t) read_count;
-		internal_file->current_offset += read_count;
-	}
-	/* Read the non-aligned remainder
-	 */
-	if( read_size_remainder > 0 )
-	{
-		if( memory_set(
-		     internal_file->block_data,
-		     0,
-		     internal_file->block_size ) == NULL )
+		if( read_count < 0 )
 		{
 			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to clear block data.",
-			 function );
-
-			return( -1 );
-		}
-		errno = 0;
-
-		read_count = read(
-		              internal_file->descriptor,
-		              internal_file->block_data,
-		              internal_file->block_size );
-
-		if( read_count != (ssize_t) internal_file->block_size )
-		{
-			*error_code = (uint32_t) errno;
-
-			libcerror_system_set_error(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 *error_code,
-			 "%s: unable to read from file (post-aligned, count: %" PRIzd ").",
-			 function,
-			 read_count );
+			 "%s: unable to read block data from file.",
+			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		internal_file->block_data_offset = 0;
-		internal_file->block_data_size   = (size_t) read_count;
-
 		if( memory_copy(
 		     &( buffer[ buffer_offset ] ),
-		     internal_file->block_data,
-		     read_size_remainder ) == NULL )
+		     block_data,
+		     (size_t) read_count ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
@@ -2293,71 +3148,307 @@ ssize_t libcfile_file_read_buffer_with_error_code(
 			 "%s: unable to copy block data.",
 			 function );
 
-			return( -1 );
+			goto on_error;
+		}
+		buffer_offset += (size_t) read_count;
+
+		if( (size_t) read_count < read_size )
+		{
+			break;
 		}
-		buffer_offset                    += read_size_remainder;
-		internal_file->block_data_offset += read_size_remainder;
-		internal_file->current_offset    += read_size_remainder;
+	}
+	if( block_data != bounce_data )
+	{
+		memory_free(
+		 block_data );
 	}
 	return( (ssize_t) buffer_offset );
-}
 
-#else
-#error Missing file read function
-#endif
+on_error:
+	if( ( block_data != NULL )
+	 && ( block_data != bounce_data ) )
+	{
+		memory_free(
+		 block_data );
+	}
+	return( -1 );
+}
 
-/* Writes a buffer to the file
- * Returns the number of bytes written if successful, or -1 on error
+/* Reads a buffer from the file at a specific offset using the block cache
+ * Unaligned parts are read from the block cache, aligned parts are read directly into the buffer
+ * Returns the number of bytes read if successful, or -1 on error
  */
-ssize_t libcfile_file_write_buffer(
-         libcfile_file_t *file,
-         const uint8_t *buffer,
+ssize_t libcfile_internal_file_read_blocks_with_error_code(
+         libcfile_internal_file_t *internal_file,
+         off64_t offset,
+         uint8_t *buffer,
          size_t size,
+         uint32_t *error_code,
          libcerror_error_t **error )
 {
-	static char *function = "libcfile_file_write_buffer";
-	ssize_t write_count   = 0;
-	uint32_t error_code   = 0;
+	uint8_t *block_data        = NULL;
+	static char *function      = "libcfile_internal_file_read_blocks_with_error_code";
+	size_t block_data_offset   = 0;
+	size_t buffer_offset       = 0;
+	size_t expected_read_count = 0;
+	size_t read_size           = 0;
+	size64_t file_size         = 0;
+	ssize_t read_count         = 0;
+	off64_t block_offset       = 0;
+	int result                 = 0;
 
-	write_count = libcfile_file_write_buffer_with_error_code(
-	               file,
-	               buffer,
-	               size,
-	               &error_code,
-	               error );
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
 
-	if( write_count == -1 )
+		return( -1 );
+	}
+	if( internal_file->block_size == 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write to file.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing block size.",
 		 function );
 
 		return( -1 );
 	}
-	return( write_count );
+	if( internal_file->block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( error_code == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
+		 function );
+
+		return( -1 );
+	}
+	while( size > 0 )
+	{
+		block_data_offset = (size_t) ( offset % internal_file->block_size );
+
+		if( ( block_data_offset == 0 )
+		 && ( size >= internal_file->block_size ) )
+		{
+			/* Read block aligned data directly into the buffer
+			 */
+			read_size = size - ( size % internal_file->block_size );
+
+			read_count = libcfile_internal_file_read_aligned_buffer_at_offset_with_error_code(
+			              internal_file,
+			              offset,
+			              &( buffer[ buffer_offset ] ),
+			              read_size,
+			              internal_file->bounce_data,
+			              error_code,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 *error_code,
+				 "%s: unable to read from file (aligned, count: %" PRIzd ").",
+				 function,
+				 read_count );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			block_offset = offset - block_data_offset;
+
+			result = libcfile_block_cache_get_block(
+			          internal_file->block_cache,
+			          block_offset,
+			          &block_data,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve block at offset: %" PRIi64 " (0x%08" PRIx64 ") from cache.",
+				 function,
+				 block_offset,
+				 block_offset );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				if( libcfile_block_cache_allocate_block(
+				     internal_file->block_cache,
+				     block_offset,
+				     &block_data,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to allocate block at offset: %" PRIi64 " (0x%08" PRIx64 ") in cache.",
+					 function,
+					 block_offset,
+					 block_offset );
+
+					return( -1 );
+				}
+				/* The last block of the file can be smaller than the block size
+				 */
+				expected_read_count = internal_file->block_size;
+
+				file_size = libcfile_internal_file_load_size(
+				             internal_file );
+
+				if( ( file_size > (size64_t) block_offset )
+				 && ( ( file_size - block_offset ) < (size64_t) expected_read_count ) )
+				{
+					expected_read_count = (size_t) ( file_size - block_offset );
+				}
+				read_count = libcfile_internal_file_read_buffer_at_offset_with_error_code(
+				              internal_file,
+				              block_offset,
+				              block_data,
+				              internal_file->block_size,
+				              error_code,
+				              error );
+
+				if( read_count != (ssize_t) expected_read_count )
+				{
+					libcerror_system_set_error(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 *error_code,
+					 "%s: unable to read from file (unaligned, count: %" PRIzd ").",
+					 function,
+					 read_count );
+
+					libcfile_block_cache_invalidate_range(
+					 internal_file->block_cache,
+					 block_offset,
+					 (size64_t) internal_file->block_size,
+					 NULL );
+
+					return( -1 );
+				}
+#if defined( HAVE_LIBCFILE_STATISTICS )
+				/* The bytes of the block that were not requested count as read amplification
+				 */
+				read_size = (size_t) read_count - block_data_offset;
+
+				if( read_size > size )
+				{
+					read_size = size;
+				}
+				libcfile_statistics_add_read_amplification(
+				 &( internal_file->statistics ),
+				 (size_t) read_count - read_size );
+#endif
+			}
+			read_size = internal_file->block_size - block_data_offset;
+
+			if( read_size > size )
+			{
+				read_size = size;
+			}
+			if( memory_copy(
+			     &( buffer[ buffer_offset ] ),
+			     &( block_data[ block_data_offset ] ),
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy block data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		buffer_offset += read_size;
+		offset        += (off64_t) read_size;
+		size          -= read_size;
+	}
+	return( (ssize_t) buffer_offset );
 }
 
 #if defined( WINAPI )
 
-/* Writes a buffer to the file
+/* Reads a buffer from the file
  * This function uses the WINAPI function for Windows XP (0x0501) or later
  * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
- * Returns the number of bytes written if successful, or -1 on error
+ * Returns the number of bytes read if successful, or -1 on error
  */
-ssize_t libcfile_file_write_buffer_with_error_code(
+ssize_t libcfile_file_read_buffer_with_error_code(
          libcfile_file_t *file,
-         const uint8_t *buffer,
+         uint8_t *buffer,
          size_t size,
          uint32_t *error_code,
          libcerror_error_t **error )
 {
 	libcfile_internal_file_t *internal_file = NULL;
-	static char *function                   = "libcfile_file_write_buffer_with_error_code";
-	ssize_t write_count                     = 0;
-	BOOL result                             = FALSE;
+	static char *function                   = "libcfile_file_read_buffer_with_error_code";
+	size64_t file_size                      = 0;
+	ssize_t read_count                      = 0;
 
 	if( file == NULL )
 	{
@@ -2420,72 +3511,141 @@ ssize_t libcfile_file_write_buffer_with_error_code(
 
 		return( -1 );
 	}
-#if ( WINVER <= 0x0500 )
-	result = libcfile_WriteFile(
-	          internal_file->handle,
-	          (VOID *) buffer,
-	          (DWORD) size,
-	          (DWORD *) &write_count,
-	          NULL );
-#else
-	result = WriteFile(
-	          internal_file->handle,
-	          (VOID *) buffer,
-	          (DWORD) size,
-	          (DWORD *) &write_count,
-	          NULL );
-#endif
-	if( result == 0 )
+	if( internal_file->write_buffer_data_size > 0 )
 	{
-		*error_code = (uint32_t) GetLastError();
+		if( libcfile_internal_file_flush_write_buffer(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write buffer.",
+			 function );
 
-		libcerror_system_set_error(
+			return( -1 );
+		}
+	}
+	if( internal_file->current_offset < 0 )
+	{
+		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 *error_code,
-		 "%s: unable to write to file.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file - current offset value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( write_count < 0 )
+	file_size = libcfile_internal_file_load_size(
+	             internal_file );
+
+	if( ( size == 0 )
+	 || ( (size64_t) internal_file->current_offset > file_size ) )
 	{
-		libcerror_error_set(
+		return( 0 );
+	}
+	if( ( (size64_t) internal_file->current_offset + size ) > file_size )
+	{
+		size = (size_t) ( file_size - internal_file->current_offset );
+	}
+	if( internal_file->block_size != 0 )
+	{
+		read_count = libcfile_internal_file_read_blocks_with_error_code(
+		              internal_file,
+		              internal_file->current_offset,
+		              buffer,
+		              size,
+		              error_code,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read blocks from file.",
+			 function );
+
+			return( -1 );
+		}
+		internal_file->current_offset += (off64_t) read_count;
+
+		return( read_count );
+	}
+	if( internal_file->skip_holes != 0 )
+	{
+		read_count = libcfile_internal_file_read_buffer_at_offset_skipping_holes(
+		              internal_file,
+		              internal_file->current_offset,
+		              buffer,
+		              size,
+		              error_code,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from file.",
+			 function );
+
+			return( -1 );
+		}
+		internal_file->current_offset += (off64_t) read_count;
+
+		return( read_count );
+	}
+	read_count = libcfile_internal_file_read_buffer_at_offset_with_error_code(
+	              internal_file,
+	              internal_file->current_offset,
+	              buffer,
+	              size,
+	              error_code,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_system_set_error(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: invalid write count: %" PRIzd " returned.",
-		 function,
-		 write_count );
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 *error_code,
+		 "%s: unable to read from file.",
+		 function );
 
 		return( -1 );
 	}
-	internal_file->current_offset += write_count;
+	internal_file->current_offset += (off64_t) read_count;
 
-	if( (size64_t) internal_file->current_offset > internal_file->size )
-	{
-		internal_file->size = (size64_t) internal_file->current_offset;
-	}
-	return( write_count );
+	return( read_count );
 }
 
-#elif defined( HAVE_WRITE )
+#elif defined( HAVE_READ )
 
-/* Writes a buffer to the file
- * This function uses the POSIX write function or equivalent
- * Returns the number of bytes written if successful, or -1 on error
+/* Reads a buffer from the file
+ * This function uses the POSIX read function or equivalent
+ * Returns the number of bytes read if successful, or -1 on error
  */
-ssize_t libcfile_file_write_buffer_with_error_code(
+ssize_t libcfile_file_read_buffer_with_error_code(
          libcfile_file_t *file,
-         const uint8_t *buffer,
+         uint8_t *buffer,
          size_t size,
          uint32_t *error_code,
          libcerror_error_t **error )
 {
 	libcfile_internal_file_t *internal_file = NULL;
-	static char *function                   = "libcfile_file_write_buffer_with_error_code";
-	ssize_t write_count                     = 0;
+	static char *function                   = "libcfile_file_read_buffer_with_error_code";
+	size64_t file_size                      = 0;
+	ssize_t read_count                      = 0;
+
+#if defined( HAVE_LIBCFILE_STATISTICS ) && !defined( HAVE_PREAD )
+	uint64_t start_timestamp = 0;
+#endif
 
 	if( file == NULL )
 	{
@@ -2544,349 +3704,303 @@ ssize_t libcfile_file_write_buffer_with_error_code(
 
 		return( -1 );
 	}
-	write_count = write(
-	               internal_file->descriptor,
-	               (void *) buffer,
-	               size );
-
-	if( write_count < 0 )
-	{
-		*error_code = (uint32_t) errno;
-
-		libcerror_system_set_error(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 *error_code,
-		 "%s: unable to write to file.",
-		 function );
-
-		return( -1 );
-	}
-	internal_file->current_offset += write_count;
-
-	if( (size64_t) internal_file->current_offset > internal_file->size )
-	{
-		internal_file->size = (size64_t) internal_file->current_offset;
-	}
-	return( write_count );
-}
-
-#else
-#error Missing file write function
-#endif
-
-#if defined( WINAPI )
-
-/* Seeks a certain offset within the file
- * This function uses the WINAPI function for Windows XP (0x0501) or later
- * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
- * Returns the offset if the seek is successful or -1 on error
- */
-off64_t libcfile_file_seek_offset(
-         libcfile_file_t *file,
-         off64_t offset,
-         int whence,
-         libcerror_error_t **error )
-{
-	libcfile_internal_file_t *internal_file = NULL;
-	static char *function                   = "libcfile_file_seek_offset";
-	off64_t calculated_offset               = 0;
-	off64_t offset_remainder                = 0;
-	LARGE_INTEGER large_integer_offset      = LIBCFILE_LARGE_INTEGER_ZERO;
-	DWORD error_code                        = 0;
-	DWORD move_method                       = 0;
-
-	if( file == NULL )
+	if( internal_file->write_buffer_data_size > 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
-		 function );
+		if( libcfile_internal_file_flush_write_buffer(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write buffer.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
-	internal_file = (libcfile_internal_file_t *) file;
-
-	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	if( internal_file->current_offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing handle.",
-		 function );
-
-		return( -1 );
-	}
-	if( offset > (off64_t) INT64_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid offset value exceeds maximum.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file - current offset value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	calculated_offset = offset;
+	file_size = libcfile_internal_file_load_size(
+	             internal_file );
 
-	if( whence == SEEK_CUR )
+	if( ( size == 0 )
+	 || ( (size64_t) internal_file->current_offset > file_size ) )
 	{
-		calculated_offset += internal_file->current_offset;
+		return( 0 );
 	}
-	else if( whence == SEEK_END )
+	if( ( (size64_t) internal_file->current_offset + size ) > file_size )
 	{
-		calculated_offset += internal_file->size;
+		size = (size_t) ( file_size - internal_file->current_offset );
 	}
-	else if( whence != SEEK_SET )
+#if defined( HAVE_POSIX_FADVISE )
+	if( internal_file->access_behavior == LIBCFILE_ACCESS_BEHAVIOR_STREAMING )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported whence.",
-		 function );
+		if( libcfile_internal_file_drop_read_data(
+		     internal_file,
+		     internal_file->current_offset,
+		     size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to remove read data from page cache.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
-	if( calculated_offset < 0 )
+	if( internal_file->readahead != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid offset value out of bounds.",
-		 function );
+		if( libcfile_internal_file_readahead(
+		     internal_file,
+		     internal_file->current_offset,
+		     size,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to prefetch data.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
-	if( internal_file->block_size != 0 )
+#endif /* defined( HAVE_POSIX_FADVISE ) */
+	if( internal_file->mapped_data != NULL )
 	{
-		whence           = SEEK_SET;
-		offset_remainder = calculated_offset % internal_file->block_size;
-		offset           = calculated_offset - offset_remainder;
+		read_count = libcfile_internal_file_read_buffer_at_offset_with_error_code(
+		              internal_file,
+		              internal_file->current_offset,
+		              buffer,
+		              size,
+		              error_code,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from mapped data.",
+			 function );
+
+			return( -1 );
+		}
+		internal_file->current_offset += (off64_t) read_count;
+
+		return( read_count );
 	}
-	if( whence == SEEK_SET )
+	if( internal_file->block_size != 0 )
 	{
-		move_method = FILE_BEGIN;
-	}
-	else if( whence == SEEK_CUR )
-	{
-		move_method = FILE_CURRENT;
-	}
-	else if( whence == SEEK_END )
-	{
-		move_method = FILE_END;
-	}
-	/* SetFilePointerEx cannot be used in combination with FILE_FLAG_OVERLAPPED.
-	 */
-	if( internal_file->use_asynchronous_io == 0 )
-	{
-#if defined( __BORLANDC__ ) && __BORLANDC__ <= 0x0520
-		large_integer_offset.QuadPart = (LONGLONG) offset;
-#else
-		large_integer_offset.LowPart  = (DWORD) ( 0x0ffffffffUL & offset );
-		large_integer_offset.HighPart = (LONG) ( offset >> 32 );
-#endif
+		/* Block-based reads do not use the offset of the file descriptor
+		 */
+		read_count = libcfile_internal_file_read_blocks_with_error_code(
+		              internal_file,
+		              internal_file->current_offset,
+		              buffer,
+		              size,
+		              error_code,
+		              error );
 
-#if ( WINVER <= 0x0500 )
-		if( libcfile_SetFilePointerEx(
-		     internal_file->handle,
-		     large_integer_offset,
-		     &large_integer_offset,
-		     move_method ) == 0 )
-#else
-		if( SetFilePointerEx(
-		     internal_file->handle,
-		     large_integer_offset,
-		     &large_integer_offset,
-		     move_method ) == 0 )
-#endif
+		if( read_count < 0 )
 		{
-			error_code = GetLastError();
-
-			libcerror_system_set_error(
+			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_SEEK_FAILED,
-			 error_code,
-			 "%s: unable to seek offset in file.",
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read blocks from file.",
 			 function );
 
 			return( -1 );
 		}
-#if defined( __BORLANDC__ ) && __BORLANDC__ <= 0x0520
-		offset = (off64_t) large_integer_offset.QuadPart;
-#else
-		offset = ( (off64_t) large_integer_offset.HighPart << 32 ) + large_integer_offset.LowPart;
-#endif
-		if( offset < 0 )
+		internal_file->current_offset += (off64_t) read_count;
+
+		return( read_count );
+	}
+	if( internal_file->skip_holes != 0 )
+	{
+		read_count = libcfile_internal_file_read_buffer_at_offset_skipping_holes(
+		              internal_file,
+		              internal_file->current_offset,
+		              buffer,
+		              size,
+		              error_code,
+		              error );
+
+		if( read_count < 0 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_SEEK_FAILED,
-			 "%s: invalid offset: %" PRIi64 " returned.",
-			 function,
-			 offset );
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from file.",
+			 function );
 
 			return( -1 );
 		}
-	}
-	internal_file->current_offset = offset;
-
-	if( internal_file->block_size != 0 )
-	{
-		internal_file->current_offset   += offset_remainder;
-		internal_file->block_data_offset = (size_t) offset_remainder;
-		internal_file->block_data_size   = 0;
-	}
-	return( internal_file->current_offset );
-}
+		internal_file->current_offset += (off64_t) read_count;
 
-#elif defined( HAVE_LSEEK )
-
-/* Seeks a certain offset within the file
- * This function uses the POSIX lseek function or equivalent
- * Returns the offset if the seek is successful or -1 on error
- */
-off64_t libcfile_file_seek_offset(
-         libcfile_file_t *file,
-         off64_t offset,
-         int whence,
-         libcerror_error_t **error )
-{
-	libcfile_internal_file_t *internal_file = NULL;
-	static char *function                   = "libcfile_file_seek_offset";
-	off64_t calculated_offset               = 0;
-	off64_t offset_remainder                = 0;
-
-	if( file == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
-		 function );
-
-		return( -1 );
+		return( read_count );
 	}
-	internal_file = (libcfile_internal_file_t *) file;
+#if defined( HAVE_PREAD )
+	/* The read is done at the current offset so that a seek does not
+	 * require the offset of the file descriptor to be changed
+	 */
+	read_count = libcfile_internal_file_read_buffer_at_offset_with_error_code(
+	              internal_file,
+	              internal_file->current_offset,
+	              buffer,
+	              size,
+	              error_code,
+	              error );
 
-	if( internal_file->descriptor == -1 )
+	if( read_count < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing descriptor.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file.",
 		 function );
 
 		return( -1 );
 	}
-	if( offset > (off64_t) INT64_MAX )
+#else
+	if( libcfile_internal_file_seek_descriptor_offset(
+	     internal_file,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid offset value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek file descriptor offset.",
 		 function );
 
 		return( -1 );
 	}
-	calculated_offset = offset;
-
-	if( whence == SEEK_CUR )
-	{
-		calculated_offset += internal_file->current_offset;
-	}
-	else if( whence == SEEK_END )
-	{
-		calculated_offset += internal_file->size;
-	}
-	else if( whence != SEEK_SET )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported whence.",
-		 function );
+	errno = 0;
 
-		return( -1 );
-	}
-	if( calculated_offset < 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid offset value out of bounds.",
-		 function );
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	start_timestamp = libcfile_statistics_get_timestamp();
+#endif
+	read_count = read(
+	              internal_file->descriptor,
+	              (void *) buffer,
+	              size );
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	libcfile_statistics_add_operation(
+	 &( internal_file->statistics ),
+	 LIBCFILE_OPERATION_TYPE_READ,
+	 read_count,
+	 start_timestamp );
+#endif
 
-		return( -1 );
-	}
-	if( internal_file->block_size != 0 )
+	if( read_count < 0 )
 	{
-		whence           = SEEK_SET;
-		offset_remainder = calculated_offset % internal_file->block_size;
-		offset           = calculated_offset - offset_remainder;
-	}
-	offset = lseek(
-	          internal_file->descriptor,
-	          (off_t) offset,
-	          whence );
+		*error_code = (uint32_t) errno;
 
-	if( offset < 0 )
-	{
 		libcerror_system_set_error(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 errno,
-		 "%s: unable to seek offset in file.",
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 *error_code,
+		 "%s: unable to read from file.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file->current_offset = offset;
+	internal_file->descriptor_offset += (off64_t) read_count;
+#endif /* defined( HAVE_PREAD ) */
 
-	if( internal_file->block_size != 0 )
-	{
-		internal_file->current_offset   += offset_remainder;
-		internal_file->block_data_offset = (size_t) offset_remainder;
-		internal_file->block_data_size   = 0;
-	}
-	return( internal_file->current_offset );
+	internal_file->current_offset += (off64_t) read_count;
+
+	return( read_count );
 }
 
 #else
-#error Missing file lseek function
+#error Missing file read function
 #endif
 
-#if defined( WINAPI )
+/* Reads a buffer from the file at a specific offset
+ * This function does not change the current offset of the file
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libcfile_file_read_buffer_at_offset(
+         libcfile_file_t *file,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libcfile_file_read_buffer_at_offset";
+	ssize_t read_count    = 0;
+	uint32_t error_code   = 0;
 
-/* Resizes the file
- * This function uses the WINAPI function for Windows XP (0x0501) or later
- * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
- * Returns 1 if successful or -1 on error
+	read_count = libcfile_file_read_buffer_at_offset_with_error_code(
+	              file,
+	              buffer,
+	              size,
+	              offset,
+	              &error_code,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Reads a buffer from the file at a specific offset
+ * This function does not change the current offset of the file nor the block data
+ * and can be used concurrently on the same file if no write buffer is set
+ * On systems without pread the offset of the file descriptor is changed during the read
+ * hence the function cannot be used concurrently
+ * Returns the number of bytes read if successful, or -1 on error
  */
-int libcfile_file_resize(
-     libcfile_file_t *file,
-     size64_t size,
-     libcerror_error_t **error )
+ssize_t libcfile_file_read_buffer_at_offset_with_error_code(
+         libcfile_file_t *file,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         uint32_t *error_code,
+         libcerror_error_t **error )
 {
 	libcfile_internal_file_t *internal_file = NULL;
-	static char *function                   = "libcfile_file_resize";
-	off64_t offset                          = 0;
-	LARGE_INTEGER large_integer_offset      = LIBCFILE_LARGE_INTEGER_ZERO;
-	DWORD error_code                        = 0;
+	uint8_t *block_data                     = NULL;
+	static char *function                   = "libcfile_file_read_buffer_at_offset_with_error_code";
+	size_t block_data_offset                = 0;
+	size_t buffer_offset                    = 0;
+	size_t expected_read_count              = 0;
+	size_t read_size                        = 0;
+	size64_t file_size                      = 0;
+	ssize_t read_count                      = 0;
 
 	if( file == NULL )
 	{
@@ -2901,6 +4015,7 @@ int libcfile_file_resize(
 	}
 	internal_file = (libcfile_internal_file_t *) file;
 
+#if defined( WINAPI )
 	if( internal_file->handle == INVALID_HANDLE_VALUE )
 	{
 		libcerror_error_set(
@@ -2912,107 +4027,274 @@ int libcfile_file_resize(
 
 		return( -1 );
 	}
-	if( size > (size64_t) INT64_MAX )
+#else
+	if( internal_file->descriptor == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( __BORLANDC__ ) && __BORLANDC__ <= 0x0520
-	large_integer_offset.QuadPart = (LONGLONG) size;
-#else
-	large_integer_offset.LowPart  = (DWORD) ( 0x0ffffffffUL & size );
-	large_integer_offset.HighPart = (LONG) ( size >> 32 );
 #endif
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
 
-#if ( WINVER <= 0x0500 )
-	if( libcfile_SetFilePointerEx(
-	     internal_file->handle,
-	     large_integer_offset,
-	     &large_integer_offset,
-	     FILE_BEGIN ) == 0 )
+		return( -1 );
+	}
+#if defined( WINAPI ) && ( UINT32_MAX < SSIZE_MAX )
+	if( size > (size_t) UINT32_MAX )
 #else
-	if( SetFilePointerEx(
-	     internal_file->handle,
-	     large_integer_offset,
-	     &large_integer_offset,
-	     FILE_BEGIN ) == 0 )
+	if( size > (size_t) SSIZE_MAX )
 #endif
 	{
-		error_code = GetLastError();
-
-		libcerror_system_set_error(
+		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 error_code,
-		 "%s: unable to seek offset in file.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( __BORLANDC__ ) && __BORLANDC__ <= 0x0520
-	offset = (off64_t) large_integer_offset.QuadPart;
-#else
-	offset = ( (off64_t) large_integer_offset.HighPart << 32 ) + large_integer_offset.LowPart;
-#endif
-
 	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: invalid offset: %" PRIi64 " returned.",
-		 function,
-		 offset );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
 
 		return( -1 );
 	}
-	internal_file->current_offset = offset;
-
-#if ( WINVER <= 0x0500 )
-	if( libcfile_SetEndOfFile(
-	     internal_file->handle ) == 0 )
-#else
-	if( SetEndOfFile(
-	     internal_file->handle ) == 0 )
-#endif
+	if( error_code == NULL )
 	{
-		error_code = GetLastError();
-
-		libcerror_system_set_error(
+		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 error_code,
-		 "%s: unable to resize file.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
+	if( internal_file->write_buffer_data_size > 0 )
+	{
+		if( libcfile_internal_file_flush_write_buffer(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write buffer.",
+			 function );
 
-#elif defined( HAVE_FTRUNCATE )
+			return( -1 );
+		}
+	}
+	file_size = libcfile_internal_file_load_size(
+	             internal_file );
 
-/* Resizes the file
- * This function uses the POSIX truncate function or equivalent
- * Returns 1 if successful or -1 on error
+	if( ( size == 0 )
+	 || ( (size64_t) offset >= file_size ) )
+	{
+		return( 0 );
+	}
+	if( ( (size64_t) offset + size ) > file_size )
+	{
+		size = (size_t) ( file_size - offset );
+	}
+	/* Holes are not skipped since the cached data extent and the offset
+	 * of the file descriptor cannot be shared by concurrent reads
+	 */
+	if( ( internal_file->block_size == 0 )
+	 || ( internal_file->mapped_data != NULL ) )
+	{
+		read_count = libcfile_internal_file_read_buffer_at_offset_with_error_code(
+		              internal_file,
+		              offset,
+		              buffer,
+		              size,
+		              error_code,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 *error_code,
+			 "%s: unable to read from file.",
+			 function );
+
+			return( -1 );
+		}
+		return( read_count );
+	}
+	/* The block data of the file is not used so that the function
+	 * can be called concurrently, non-aligned parts are read into
+	 * read block data that is only used by one read at a time
+	 */
+	while( size > 0 )
+	{
+		block_data_offset = (size_t) ( offset % internal_file->block_size );
+
+		if( ( block_data_offset != 0 )
+		 || ( size < internal_file->block_size ) )
+		{
+			if( block_data == NULL )
+			{
+				if( libcfile_internal_file_acquire_read_block_data(
+				     internal_file,
+				     &block_data,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to retrieve block data.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			/* The last block of the file can be smaller than the block size
+			 */
+			expected_read_count = internal_file->block_size;
+
+			if( ( file_size - (size64_t) ( offset - block_data_offset ) ) < (size64_t) expected_read_count )
+			{
+				expected_read_count = (size_t) ( file_size - ( offset - block_data_offset ) );
+			}
+			read_count = libcfile_internal_file_read_buffer_at_offset_with_error_code(
+			              internal_file,
+			              offset - block_data_offset,
+			              block_data,
+			              internal_file->block_size,
+			              error_code,
+			              error );
+
+			if( read_count != (ssize_t) expected_read_count )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 *error_code,
+				 "%s: unable to read from file (non-aligned, count: %" PRIzd ").",
+				 function,
+				 read_count );
+
+				goto on_error;
+			}
+#if defined( HAVE_LIBCFILE_STATISTICS )
+			/* The bytes of the block that were not requested count as read amplification
+			 */
+			read_size = (size_t) read_count - block_data_offset;
+
+			if( read_size > size )
+			{
+				read_size = size;
+			}
+			libcfile_statistics_add_read_amplification(
+			 &( internal_file->statistics ),
+			 (size_t) read_count - read_size );
+#endif
+			read_size = internal_file->block_size - block_data_offset;
+
+			if( read_size > size )
+			{
+				read_size = size;
+			}
+			if( memory_copy(
+			     &( buffer[ buffer_offset ] ),
+			     &( block_data[ block_data_offset ] ),
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy block data.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			read_size = size - ( size % internal_file->block_size );
+
+			read_count = libcfile_internal_file_read_aligned_buffer_at_offset_with_error_code(
+			              internal_file,
+			              offset,
+			              &( buffer[ buffer_offset ] ),
+			              read_size,
+			              NULL,
+			              error_code,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 *error_code,
+				 "%s: unable to read from file (aligned, count: %" PRIzd ").",
+				 function,
+				 read_count );
+
+				goto on_error;
+			}
+		}
+		buffer_offset += read_size;
+		offset        += (off64_t) read_size;
+		size          -= read_size;
+	}
+	libcfile_internal_file_release_read_block_data(
+	 internal_file,
+	 block_data );
+
+	return( (ssize_t) buffer_offset );
+
+on_error:
+	libcfile_internal_file_release_read_block_data(
+	 internal_file,
+	 block_data );
+
+	return( -1 );
+}
+
+/* Retrieves a pointer to the data at a specific offset of a memory mapped file
+ * The data is only valid until the file is closed and must not be modified
+ * The data size is truncated to the end of the file
+ * Returns 1 if successful, 0 if the file is not memory mapped or -1 on error
  */
-int libcfile_file_resize(
+int libcfile_file_get_data_at_offset(
      libcfile_file_t *file,
-     size64_t size,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     size_t *data_size,
      libcerror_error_t **error )
 {
 	libcfile_internal_file_t *internal_file = NULL;
-	static char *function                   = "libcfile_file_resize";
-	off_t offset                            = 0;
+	static char *function                   = "libcfile_file_get_data_at_offset";
 
 	if( file == NULL )
 	{
@@ -3027,22 +4309,18 @@ int libcfile_file_resize(
 	}
 	internal_file = (libcfile_internal_file_t *) file;
 
-	if( internal_file->descriptor == -1 )
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing descriptor.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-#if SIZEOF_OFF_T >= 8
-	if( size > (size64_t) INT64_MAX )
-#else
-	if( size > (size64_t) INT32_MAX )
-#endif
+	if( size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
@@ -3053,385 +4331,458 @@ int libcfile_file_resize(
 
 		return( -1 );
 	}
-	if( ftruncate(
-	     internal_file->descriptor,
-	     (off_t) size ) != 0 )
+	if( data == NULL )
 	{
-		libcerror_system_set_error(
+		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_GENERIC,
-		 errno,
-		 "%s: unable to resize file.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
 		 function );
 
 		return( -1 );
 	}
-	offset = lseek(
-	          internal_file->descriptor,
-	          0,
-	          SEEK_CUR );
-
-	if( offset < 0 )
+	if( data_size == NULL )
 	{
-		libcerror_system_set_error(
+		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 errno,
-		 "%s: unable to seek offset in file.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file->current_offset = (off64_t) offset;
+	if( internal_file->write_buffer_data_size > 0 )
+	{
+		if( libcfile_internal_file_flush_write_buffer(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_file->mapped_data == NULL )
+	{
+		return( 0 );
+	}
+	if( (size64_t) offset >= (size64_t) internal_file->mapped_data_size )
+	{
+		*data      = NULL;
+		*data_size = 0;
+
+		return( 1 );
+	}
+	if( size > ( internal_file->mapped_data_size - (size_t) offset ) )
+	{
+		size = internal_file->mapped_data_size - (size_t) offset;
+	}
+	*data      = &( internal_file->mapped_data[ offset ] );
+	*data_size = size;
 
 	return( 1 );
 }
 
+/* Extends the size of the file if the end offset exceeds it
+ * The size is updated with an atomic compare and exchange so that
+ * concurrent writes at different offsets cannot lose an update
+ */
+void libcfile_internal_file_extend_size(
+      libcfile_internal_file_t *internal_file,
+      size64_t end_offset )
+{
+#if defined( WINAPI )
+	LONGLONG previous_size = 0;
+	LONGLONG size          = 0;
 #else
-#error Missing file truncate function
+	size64_t size          = 0;
 #endif
 
-/* Checks if the file is open
- * Returns 1 if open, 0 if not or -1 on error
- */
-int libcfile_file_is_open(
-     libcfile_file_t *file,
-     libcerror_error_t **error )
-{
-	libcfile_internal_file_t *internal_file = NULL;
-	static char *function                   = "libcfile_file_is_open";
+	if( internal_file == NULL )
+	{
+		return;
+	}
+#if defined( WINAPI )
+	size = InterlockedCompareExchange64(
+	        (LONGLONG volatile *) &( internal_file->size ),
+	        0,
+	        0 );
 
-	if( file == NULL )
+	while( (size64_t) size < end_offset )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
-		 function );
+		previous_size = InterlockedCompareExchange64(
+		                 (LONGLONG volatile *) &( internal_file->size ),
+		                 (LONGLONG) end_offset,
+		                 size );
 
-		return( -1 );
+		if( previous_size == size )
+		{
+			break;
+		}
+		size = previous_size;
 	}
-	internal_file = (libcfile_internal_file_t *) file;
+#elif defined( __GNUC__ )
+	size = __atomic_load_n(
+	        &( internal_file->size ),
+	        __ATOMIC_RELAXED );
 
-#if defined( WINAPI )
-	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	/* On failure size is updated with the current value
+	 */
+	while( size < end_offset )
+	{
+		if( __atomic_compare_exchange_n(
+		     &( internal_file->size ),
+		     &size,
+		     end_offset,
+		     0,
+		     __ATOMIC_RELAXED,
+		     __ATOMIC_RELAXED ) != 0 )
+		{
+			break;
+		}
+	}
 #else
-	if( internal_file->descriptor == -1 )
+	size = internal_file->size;
+
+	if( size < end_offset )
+	{
+		internal_file->size = end_offset;
+	}
+#endif
+}
+
+/* Retrieves the size of the file
+ * The size is read with an atomic load so that reads at a specific offset
+ * see a consistent value while concurrent writes extend the size
+ * Returns the size of the file
+ */
+size64_t libcfile_internal_file_load_size(
+          libcfile_internal_file_t *internal_file )
+{
+#if defined( WINAPI )
+	LONGLONG size = 0;
 #endif
+
+	if( internal_file == NULL )
 	{
 		return( 0 );
 	}
-	return( 1 );
+#if defined( WINAPI )
+	size = InterlockedCompareExchange64(
+	        (LONGLONG volatile *) &( internal_file->size ),
+	        0,
+	        0 );
+
+	return( (size64_t) size );
+#elif defined( __GNUC__ )
+	return( __atomic_load_n(
+	         &( internal_file->size ),
+	         __ATOMIC_RELAXED ) );
+#else
+	return( internal_file->size );
+#endif
 }
 
-/* Retrieves the current offset in the file
- * Returns 1 if successful or -1 on error
+/* Sets the size of the file
+ * The size is written with an atomic store so that concurrent reads
+ * of the size see either the previous or the new value
  */
-int libcfile_file_get_offset(
-     libcfile_file_t *file,
-     off64_t *offset,
-     libcerror_error_t **error )
+void libcfile_internal_file_store_size(
+      libcfile_internal_file_t *internal_file,
+      size64_t size )
 {
-	libcfile_internal_file_t *internal_file = NULL;
-	static char *function                   = "libcfile_file_get_offset";
+	if( internal_file == NULL )
+	{
+		return;
+	}
+#if defined( WINAPI )
+	InterlockedExchange64(
+	 (LONGLONG volatile *) &( internal_file->size ),
+	 (LONGLONG) size );
+#elif defined( __GNUC__ )
+	__atomic_store_n(
+	 &( internal_file->size ),
+	 size,
+	 __ATOMIC_RELAXED );
+#else
+	internal_file->size = size;
+#endif
+}
 
-	if( file == NULL )
+/* Writes a buffer to the file
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t libcfile_file_write_buffer(
+         libcfile_file_t *file,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "libcfile_file_write_buffer";
+	ssize_t write_count   = 0;
+	uint32_t error_code   = 0;
+
+	write_count = libcfile_file_write_buffer_with_error_code(
+	               file,
+	               buffer,
+	               size,
+	               &error_code,
+	               error );
+
+	if( write_count == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write to file.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (libcfile_internal_file_t *) file;
+	return( write_count );
+}
 
 #if defined( WINAPI )
-	if( internal_file->handle == INVALID_HANDLE_VALUE )
+
+/* Writes a buffer to the file at a specific offset
+ * This is an internal function to wrap WriteFile in synchronous and asynchronous mode
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t libcfile_internal_file_write_buffer_at_offset_with_error_code(
+         libcfile_internal_file_t *internal_file,
+         off64_t current_offset,
+         const uint8_t *buffer,
+         size_t size,
+         uint32_t *error_code,
+         libcerror_error_t **error )
+{
+	OVERLAPPED overlapped_data;
+
+	static char *function = "libcfile_internal_file_write_buffer_at_offset_with_error_code";
+	DWORD write_count     = 0;
+	BOOL io_pending       = FALSE;
+	BOOL result           = FALSE;
+
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	uint64_t start_timestamp = 0;
+#endif
+
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-#else
-	if( internal_file->descriptor == -1 )
+	if( internal_file->handle == INVALID_HANDLE_VALUE )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing descriptor.",
+		 "%s: invalid file - missing handle.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( offset == NULL )
+	if( current_offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid offset.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid current offset value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	*offset = internal_file->current_offset;
-
-	return( 1 );
-}
-
-#if defined( WINAPI )
-
-#if !defined( IOCTL_DISK_GET_LENGTH_INFO )
-#define IOCTL_DISK_GET_LENGTH_INFO \
-	CTL_CODE( IOCTL_DISK_BASE, 0x0017, METHOD_BUFFERED, FILE_READ_ACCESS )
-
-typedef struct
-{
-	LARGE_INTEGER Length;
-}
-GET_LENGTH_INFORMATION;
-
-#endif /* !defined( IOCTL_DISK_GET_LENGTH_INFO ) */
-
-/* Retrieves the size of the file
- * This function uses the WINAPI function for Windows XP (0x0501) or later
- * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
- * Returns 1 if successful or -1 on error
- */
-int libcfile_internal_file_get_size(
-     libcfile_internal_file_t *internal_file,
-     size64_t *size,
-     libcerror_error_t **error )
-{
-	DISK_GEOMETRY disk_geometry;
-	GET_LENGTH_INFORMATION length_information;
-
-	static char *function            = "libcfile_internal_file_get_size";
-	LARGE_INTEGER large_integer_size = LIBCFILE_LARGE_INTEGER_ZERO;
-	size_t read_count                = 0;
-	uint32_t error_code              = 0;
-	int result                       = 0;
-
-	if( internal_file == NULL )
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 "%s: invalid buffer.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->handle == INVALID_HANDLE_VALUE )
+#if ( UINT32_MAX < SSIZE_MAX )
+	if( size > (size_t) UINT32_MAX )
+#else
+	if( size > (size_t) SSIZE_MAX )
+#endif
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( size == NULL )
+	if( error_code == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid size.",
+		 "%s: invalid error code.",
 		 function );
 
 		return( -1 );
 	}
-	result = libcfile_file_is_device(
-	          (libcfile_file_t *) internal_file,
-	          error );
+	if( internal_file->block_cache != NULL )
+	{
+		if( libcfile_block_cache_invalidate_range(
+		     internal_file->block_cache,
+		     current_offset,
+		     (size64_t) size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to invalidate cached blocks.",
+			 function );
 
-	if( result == -1 )
+			return( -1 );
+		}
+	}
+	/* The overlapped data is used to write at the offset
+	 * since the file pointer is not maintained by the read functions
+	 */
+	if( memory_set(
+	     &overlapped_data,
+	     0,
+	     sizeof( OVERLAPPED ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if file is a device.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear overlapped data.",
 		 function );
 
 		return( -1 );
 	}
-	else if( result != 0 )
+	overlapped_data.Offset     = (DWORD) ( 0x0ffffffffUL & current_offset );
+	overlapped_data.OffsetHigh = (DWORD) ( current_offset >> 32 );
+
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	start_timestamp = libcfile_statistics_get_timestamp();
+#endif
+#if ( WINVER <= 0x0500 )
+	result = libcfile_WriteFile(
+	          internal_file->handle,
+	          (VOID *) buffer,
+	          (DWORD) size,
+	          &write_count,
+	          &overlapped_data );
+#else
+	result = WriteFile(
+	          internal_file->handle,
+	          (VOID *) buffer,
+	          (DWORD) size,
+	          &write_count,
+	          &overlapped_data );
+#endif
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	libcfile_statistics_add_operation(
+	 &( internal_file->statistics ),
+	 LIBCFILE_OPERATION_TYPE_WRITE,
+	 ( result != 0 ) ? (ssize_t) write_count : -1,
+	 start_timestamp );
+#endif
+	if( result == 0 )
 	{
-#if defined( LIBCFILE_HAVE_IO_CONTROL )
-		read_count = libcfile_internal_file_io_control_read_with_error_code(
-		              internal_file,
-		              IOCTL_DISK_GET_LENGTH_INFO,
-		              NULL,
-		              0,
-		              (uint8_t *) &length_information,
-		              sizeof( GET_LENGTH_INFORMATION ),
-		              &error_code,
-		              error );
+		*error_code = (uint32_t) GetLastError();
 
-		if( read_count == -1 )
+		if( *error_code != ERROR_IO_PENDING )
 		{
-			libcerror_error_set(
+			libcerror_system_set_error(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-			 "%s: unable to query device for: IOCTL_DISK_GET_LENGTH_INFO.",
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 *error_code,
+			 "%s: unable to write to file.",
 			 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				if( ( error != NULL )
-				 && ( *error != NULL ) )
-				{
-					libcnotify_print_error_backtrace(
-					 *error );
-				}
-			}
+			return( -1 );
+		}
+		io_pending = TRUE;
+	}
+	if( io_pending == TRUE )
+	{
+#if ( WINVER <= 0x0500 )
+		result = libcfile_GetOverlappedResult(
+			  internal_file->handle,
+			  &overlapped_data,
+			  &write_count,
+			  TRUE );
+#else
+		result = GetOverlappedResult(
+			  internal_file->handle,
+			  &overlapped_data,
+			  &write_count,
+			  TRUE );
 #endif
-			libcerror_error_free(
-			 error );
+		if( result == 0 )
+		{
+			*error_code = (uint32_t) GetLastError();
 
-			if( error_code == ERROR_NOT_SUPPORTED )
-			{
-				/* A floppy device does not support IOCTL_DISK_GET_LENGTH_INFO
-				 */
-				read_count = libcfile_internal_file_io_control_read_with_error_code(
-				              internal_file,
-				              IOCTL_DISK_GET_DRIVE_GEOMETRY,
-				              NULL,
-				              0,
-				              (uint8_t *) &disk_geometry,
-				              sizeof( DISK_GEOMETRY ),
-				              &error_code,
-				              error );
-
-				if( read_count == -1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-					 "%s: unable to query device for: IOCTL_DISK_GET_DRIVE_GEOMETRY.",
-					 function );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-					if( libcnotify_verbose != 0 )
-					{
-						if( ( error != NULL )
-						 && ( *error != NULL ) )
-						{
-							libcnotify_print_error_backtrace(
-							 *error );
-						}
-					}
-#endif
-					libcerror_error_free(
-					 error );
-				}
-				else
-				{
-					*size  = disk_geometry.Cylinders.QuadPart;
-					*size *= disk_geometry.TracksPerCylinder;
-					*size *= disk_geometry.SectorsPerTrack;
-					*size *= disk_geometry.BytesPerSector;
-				}
-			}
-		}
-		else
-		{
-			*size  = (size64_t) length_information.Length.HighPart << 32;
-			*size += (uint32_t) length_information.Length.LowPart;
-		}
-#else
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine size of device.",
-		 function );
-
-		return( -1 );
-
-#endif /* defined( LIBCFILE_HAVE_IO_CONTROL ) */
-	}
-	else
-	{
-#if ( WINVER <= 0x0500 )
-		if( libcfile_GetFileSizeEx(
-		     internal_file->handle,
-		     &large_integer_size ) == 0 )
-#else
-		if( GetFileSizeEx(
-		     internal_file->handle,
-		     &large_integer_size ) == 0 )
-#endif
-		{
-			libcerror_error_set(
+			libcerror_system_set_error(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve file size.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 *error_code,
+			 "%s: unable to write to file - overlapped result.",
 			 function );
 
 			return( -1 );
 		}
-#if defined( __BORLANDC__ ) && __BORLANDC__ <= 0x520
-		*size = (size64_t) large_integer_size.QuadPart;
-#else
-		*size  = (size64_t) large_integer_size.HighPart << 32;
-		*size += (uint32_t) large_integer_size.LowPart;
-#endif
 	}
-	return( 1 );
+	return( (ssize_t) write_count );
 }
 
-#elif defined( HAVE_FSTAT )
+#elif defined( HAVE_WRITE )
 
-/* Retrieves the size of the file
- * This function uses the POSIX fstat function or equivalent
- * Returns 1 if successful or -1 on error
+/* Writes a buffer to the file at a specific offset
+ * This is an internal function to wrap pwrite, which does not change
+ * the offset of the file descriptor
+ * Returns the number of bytes written if successful, or -1 on error
  */
-int libcfile_internal_file_get_size(
-     libcfile_internal_file_t *internal_file,
-     size64_t *size,
-     libcerror_error_t **error )
+ssize_t libcfile_internal_file_write_buffer_at_offset_with_error_code(
+         libcfile_internal_file_t *internal_file,
+         off64_t current_offset,
+         const uint8_t *buffer,
+         size_t size,
+         uint32_t *error_code,
+         libcerror_error_t **error )
 {
-	struct stat file_statistics;
+	static char *function   = "libcfile_internal_file_write_buffer_at_offset_with_error_code";
+	ssize_t write_count     = 0;
 
-	static char *function     = "libcfile_internal_file_get_size";
-	size64_t safe_size        = 0;
-	ssize_t read_count        = 0;
-	off64_t current_offset    = 0;
-	off64_t offset            = 0;
-
-#if defined( BLKGETSIZE64 ) || defined( DIOCGMEDIASIZE ) || defined( DIOCGDINFO ) || ( defined( DKIOCGETBLOCKCOUNT ) && defined( DKIOCGETBLOCKSIZE ) )
-	uint32_t error_code       = 0;
+#if !defined( HAVE_PWRITE )
+	off_t descriptor_offset = 0;
 #endif
 
-#if !defined( DIOCGMEDIASIZE ) && defined( DIOCGDINFO )
-	struct disklabel disk_label;
-#endif
-#if defined( DKIOCGETBLOCKCOUNT ) && defined( DKIOCGETBLOCKSIZE )
-	uint64_t block_count      = 0;
-	uint32_t bytes_per_sector = 0;
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	uint64_t start_timestamp = 0;
 #endif
 
 	if( internal_file == NULL )
@@ -3456,377 +4807,204 @@ int libcfile_internal_file_get_size(
 
 		return( -1 );
 	}
-	if( size == NULL )
+	if( current_offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid size.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid current offset value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( memory_set(
-	     &file_statistics,
-	     0,
-	     sizeof( struct stat ) ) == NULL )
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear file statistics.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
 		 function );
 
 		return( -1 );
 	}
-	if( fstat(
-	     internal_file->descriptor,
-	     &file_statistics ) != 0 )
+	if( size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file statistics.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( S_ISBLK( file_statistics.st_mode )
-	 || S_ISCHR( file_statistics.st_mode ) )
+	if( error_code == NULL )
 	{
-#if defined( LIBCFILE_HAVE_IO_CONTROL )
-#if defined( BLKGETSIZE64 )
-		read_count = libcfile_internal_file_io_control_read_with_error_code(
-		              internal_file,
-		              (uint32_t) BLKGETSIZE64,
-		              NULL,
-		              0,
-		              (uint8_t *) &safe_size,
-		              8,
-		              &error_code,
-		              error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
+		 function );
 
-		if( read_count == -1 )
+		return( -1 );
+	}
+	if( internal_file->block_cache != NULL )
+	{
+		if( libcfile_block_cache_invalidate_range(
+		     internal_file->block_cache,
+		     current_offset,
+		     (size64_t) size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-			 "%s: unable to query device for: BLKGETSIZE64.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to invalidate cached blocks.",
 			 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				if( ( error != NULL )
-				 && ( *error != NULL ) )
-				{
-					libcnotify_print_error_backtrace(
-					 *error );
-				}
-			}
-#endif
-			libcerror_error_free(
-			 error );
+			return( -1 );
 		}
-#elif defined( DIOCGMEDIASIZE )
-		read_count = libcfile_internal_file_io_control_read_with_error_code(
-		              internal_file,
-		              (uint32_t) DIOCGMEDIASIZE,
-		              NULL,
-		              0,
-		              (uint8_t *) &safe_size,
-		              8,
-		              &error_code,
-		              error );
-
-		if( read_count == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-			 "%s: unable to query device for: DIOCGMEDIASIZE.",
-			 function );
+	}
+	errno = 0;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				if( ( error != NULL )
-				 && ( *error != NULL ) )
-				{
-					libcnotify_print_error_backtrace(
-					 *error );
-				}
-			}
+#if defined( HAVE_PWRITE )
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	start_timestamp = libcfile_statistics_get_timestamp();
+#endif
+	write_count = pwrite(
+	               internal_file->descriptor,
+	               (void *) buffer,
+	               size,
+	               (off_t) current_offset );
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	libcfile_statistics_add_operation(
+	 &( internal_file->statistics ),
+	 LIBCFILE_OPERATION_TYPE_WRITE,
+	 write_count,
+	 start_timestamp );
 #endif
-			libcerror_error_free(
-			 error );
-		}
-#elif defined( DIOCGDINFO )
-		read_count = libcfile_internal_file_io_control_read_with_error_code(
-		              internal_file,
-		              (uint32_t) DIOCGDINFO,
-		              NULL,
-		              0,
-		              (uint8_t *) &disk_label,
-		              sizeof( struct disklabel ),
-		              &error_code,
-		              error );
 
-		if( read_count == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-			 "%s: unable to query device for: DIOCGDINFO.",
-			 function );
+#else
+	/* Without pwrite the offset of the file descriptor is restored afterwards
+	 */
+	descriptor_offset = lseek(
+	                     internal_file->descriptor,
+	                     0,
+	                     SEEK_CUR );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				if( ( error != NULL )
-				 && ( *error != NULL ) )
-				{
-					libcnotify_print_error_backtrace(
-					 *error );
-				}
-			}
-#endif
-			libcerror_error_free(
-			 error );
-		}
-		else
-		{
-			safe_size = disk_label.d_secperunit * disk_label.d_secsize;
-		}
-#elif defined( DKIOCGETBLOCKCOUNT ) && defined( DKIOCGETBLOCKSIZE )
-		read_count = libcfile_internal_file_io_control_read_with_error_code(
-		              internal_file,
-		              (uint32_t) DKIOCGETBLOCKSIZE,
-		              NULL,
-		              0,
-		              (uint8_t *) &bytes_per_sector,
-		              4,
-		              &error_code,
-		              error );
+	if( descriptor_offset < 0 )
+	{
+		*error_code = (uint32_t) errno;
 
-		if( read_count == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-			 "%s: unable to query device for: DKIOCGETBLOCKSIZE.",
-			 function );
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 *error_code,
+		 "%s: unable to determine offset in file.",
+		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				if( ( error != NULL )
-				 && ( *error != NULL ) )
-				{
-					libcnotify_print_error_backtrace(
-					 *error );
-				}
-			}
-#endif
-			libcerror_error_free(
-			 error );
-		}
-		else
-		{
-			read_count = libcfile_internal_file_io_control_read_with_error_code(
-			              internal_file,
-			              (uint32_t) DKIOCGETBLOCKCOUNT,
-			              NULL,
-			              0,
-			              (uint8_t *) &block_count,
-			              4,
-			              &error_code,
-			              error );
+		return( -1 );
+	}
+	if( lseek(
+	     internal_file->descriptor,
+	     (off_t) current_offset,
+	     SEEK_SET ) < 0 )
+	{
+		*error_code = (uint32_t) errno;
 
-			if( read_count == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-				 "%s: unable to query device for: DKIOCGETBLOCKCOUNT.",
-				 function );
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 *error_code,
+		 "%s: unable to seek offset in file.",
+		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					if( ( error != NULL )
-					 && ( *error != NULL ) )
-					{
-						libcnotify_print_error_backtrace(
-						 *error );
-					}
-				}
-#endif
-				libcerror_error_free(
-				 error );
-			}
-			else
-			{
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: block size: %" PRIu32 " block count: %" PRIu64 " ",
-					 function,
-					 bytes_per_sector,
-					 block_count );
-				}
+		return( -1 );
+	}
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	start_timestamp = libcfile_statistics_get_timestamp();
 #endif
-				safe_size = (size64_t) ( block_count * bytes_per_sector );
-			}
-		}
+	write_count = write(
+	               internal_file->descriptor,
+	               (void *) buffer,
+	               size );
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	libcfile_statistics_add_operation(
+	 &( internal_file->statistics ),
+	 LIBCFILE_OPERATION_TYPE_WRITE,
+	 write_count,
+	 start_timestamp );
 #endif
-#endif /* defined( LIBCFILE_HAVE_IO_CONTROL ) */
-
-		if( read_count <= 0 )
-		{
-			/* Try to seek the end of the file and determine the size based on the offset
-			 */
-			if( libcfile_file_get_offset(
-			     (libcfile_file_t *) internal_file,
-			     &current_offset,
-			     error ) != 1  )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve current offset.",
-				 function );
-
-				return( -1 );
-			}
-			offset = libcfile_file_seek_offset(
-			          (libcfile_file_t *) internal_file,
-				  0,
-				  SEEK_END,
-				  error );
-
-			if( offset == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_SEEK_FAILED,
-				 "%s: unable to seek end of file.",
-				 function );
-
-				return( -1 );
-			}
-			safe_size = (size64_t) offset;
-
-			offset = libcfile_file_seek_offset(
-			          (libcfile_file_t *) internal_file,
-				  current_offset,
-				  SEEK_SET,
-				  error );
-
-			if( offset == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_SEEK_FAILED,
-				 "%s: unable to seek offset: %" PRIi64 ".",
-				 function,
-				 current_offset );
 
-				return( -1 );
-			}
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: device media size: %" PRIu64 "\n",
-			 function,
-			 safe_size );
-		}
-#endif
-	}
-	else
+	if( write_count < 0 )
 	{
-		safe_size = (size64_t) file_statistics.st_size;
+		*error_code = (uint32_t) errno;
 	}
-	*size = safe_size;
-
-	return( 1 );
-}
-
-#else
-#error Missing file get size function
-#endif
-
-/* Retrieves the size of the file
- * Returns 1 if successful or -1 on error
- */
-int libcfile_file_get_size(
-     libcfile_file_t *file,
-     size64_t *size,
-     libcerror_error_t **error )
-{
-	libcfile_internal_file_t *internal_file = NULL;
-	static char *function                   = "libcfile_file_get_size";
-
-	if( file == NULL )
+	if( lseek(
+	     internal_file->descriptor,
+	     descriptor_offset,
+	     SEEK_SET ) < 0 )
 	{
-		libcerror_error_set(
+		*error_code = (uint32_t) errno;
+
+		libcerror_system_set_error(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 *error_code,
+		 "%s: unable to restore offset in file.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (libcfile_internal_file_t *) file;
+#endif /* defined( HAVE_PWRITE ) */
 
-	if( size == NULL )
+	if( write_count < 0 )
 	{
-		libcerror_error_set(
+#if defined( HAVE_PWRITE )
+		*error_code = (uint32_t) errno;
+#endif
+		libcerror_system_set_error(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid size.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 *error_code,
+		 "%s: unable to write to file.",
 		 function );
 
 		return( -1 );
 	}
-	*size = internal_file->size;
-
-	return( 1 );
+	return( write_count );
 }
 
+#else
+#error Missing file write function
+#endif
+
 #if defined( WINAPI )
 
-/* Determines if a file is a device
+/* Writes a buffer to the file bypassing the write buffer
  * This function uses the WINAPI function for Windows XP (0x0501) or later
  * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
- * Returns 1 if true, 0 if not or -1 on error
+ * Returns the number of bytes written if successful, or -1 on error
  */
-int libcfile_file_is_device(
-     libcfile_file_t *file,
-     libcerror_error_t **error )
+ssize_t libcfile_internal_file_write_buffer_with_error_code(
+         libcfile_internal_file_t *internal_file,
+         const uint8_t *buffer,
+         size_t size,
+         uint32_t *error_code,
+         libcerror_error_t **error )
 {
-	libcfile_internal_file_t *internal_file = NULL;
-	static char *function                   = "libcfile_file_is_device";
-	DWORD file_type                         = 0;
-	int result                              = 0;
+	static char *function = "libcfile_internal_file_write_buffer_with_error_code";
+	ssize_t write_count   = 0;
 
-	if( file == NULL )
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -3837,8 +5015,6 @@ int libcfile_file_is_device(
 
 		return( -1 );
 	}
-	internal_file = (libcfile_internal_file_t *) file;
-
 	if( internal_file->handle == INVALID_HANDLE_VALUE )
 	{
 		libcerror_error_set(
@@ -3850,57 +5026,93 @@ int libcfile_file_is_device(
 
 		return( -1 );
 	}
-/* TODO what about FILE_ATTRIBUTE_DEVICE using GetFileAttributes() */
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
 
-	/* Use the GetFileType function to rule out certain file types
-	 * like pipes, sockets, etc.
-	 */
-#if ( WINVER <= 0x0500 )
-	file_type = libcfile_GetFileType(
-	             internal_file->handle );
+		return( -1 );
+	}
+#if ( UINT32_MAX < SSIZE_MAX )
+	if( size > (size_t) UINT32_MAX )
 #else
-	file_type = GetFileType(
-	             internal_file->handle );
+	if( size > (size_t) SSIZE_MAX )
 #endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
 
-	if( file_type == FILE_TYPE_UNKNOWN )
+		return( -1 );
+	}
+	if( error_code == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine file type.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
 		 function );
 
 		return( -1 );
 	}
-	else if( file_type == FILE_TYPE_DISK )
+	write_count = libcfile_internal_file_write_buffer_at_offset_with_error_code(
+	               internal_file,
+	               internal_file->current_offset,
+	               buffer,
+	               size,
+	               error_code,
+	               error );
+
+	if( write_count < 0 )
 	{
-		if( internal_file->is_device_filename )
-		{
-			result = 1;
-		}
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 *error_code,
+		 "%s: unable to write to file.",
+		 function );
+
+		return( -1 );
 	}
-	return( result );
+	internal_file->current_offset += write_count;
+
+	libcfile_internal_file_extend_size(
+	 internal_file,
+	 (size64_t) internal_file->current_offset );
+
+	return( write_count );
 }
 
-#elif defined( HAVE_FSTAT )
+#elif defined( HAVE_WRITE )
 
-/* Determines if a file is a device
- * This function uses the POSIX fstat function or equivalent
- * Returns 1 if true, 0 if not or -1 on error
+/* Writes a buffer to the file bypassing the write buffer
+ * This function uses the POSIX write function or equivalent
+ * Returns the number of bytes written if successful, or -1 on error
  */
-int libcfile_file_is_device(
-     libcfile_file_t *file,
-     libcerror_error_t **error )
+ssize_t libcfile_internal_file_write_buffer_with_error_code(
+         libcfile_internal_file_t *internal_file,
+         const uint8_t *buffer,
+         size_t size,
+         uint32_t *error_code,
+         libcerror_error_t **error )
 {
-	struct stat file_statistics;
+	static char *function = "libcfile_internal_file_write_buffer_with_error_code";
+	ssize_t write_count   = 0;
 
-	libcfile_internal_file_t *internal_file = NULL;
-	static char *function                   = "libcfile_file_is_device";
-	int result                              = 0;
+#if defined( HAVE_LIBCFILE_STATISTICS ) && !defined( HAVE_PWRITE )
+	uint64_t start_timestamp = 0;
+#endif
 
-	if( file == NULL )
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -3911,8 +5123,6 @@ int libcfile_file_is_device(
 
 		return( -1 );
 	}
-	internal_file = (libcfile_internal_file_t *) file;
-
 	if( internal_file->descriptor == -1 )
 	{
 		libcerror_error_set(
@@ -3924,67 +5134,170 @@ int libcfile_file_is_device(
 
 		return( -1 );
 	}
-	if( memory_set(
-	     &file_statistics,
-	     0,
-	     sizeof( struct stat ) ) == NULL )
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear file statistics.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
 		 function );
 
 		return( -1 );
 	}
-	if( fstat(
-	     internal_file->descriptor,
-	     &file_statistics ) != 0 )
+	if( size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file statistics.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( S_ISBLK( file_statistics.st_mode )
-	 || S_ISCHR( file_statistics.st_mode ) )
+	if( error_code == NULL )
 	{
-		result = 1;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
+		 function );
+
+		return( -1 );
 	}
-	return( result );
+#if defined( HAVE_PWRITE )
+	/* The write is done at the current offset so that a seek does not
+	 * require the offset of the file descriptor to be changed
+	 */
+	write_count = libcfile_internal_file_write_buffer_at_offset_with_error_code(
+	               internal_file,
+	               internal_file->current_offset,
+	               buffer,
+	               size,
+	               error_code,
+	               error );
+#else
+	if( internal_file->block_size != 0 )
+	{
+		/* Block-based reads do not use the offset of the file descriptor
+		 * hence the write is done at the current offset
+		 */
+		write_count = libcfile_internal_file_write_buffer_at_offset_with_error_code(
+		               internal_file,
+		               internal_file->current_offset,
+		               buffer,
+		               size,
+		               error_code,
+		               error );
+	}
+	else
+	{
+		if( libcfile_internal_file_seek_descriptor_offset(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek file descriptor offset.",
+			 function );
+
+			return( -1 );
+		}
+#if defined( HAVE_LIBCFILE_STATISTICS )
+		start_timestamp = libcfile_statistics_get_timestamp();
+#endif
+		write_count = write(
+		               internal_file->descriptor,
+		               (void *) buffer,
+		               size );
+#if defined( HAVE_LIBCFILE_STATISTICS )
+		libcfile_statistics_add_operation(
+		 &( internal_file->statistics ),
+		 LIBCFILE_OPERATION_TYPE_WRITE,
+		 write_count,
+		 start_timestamp );
+#endif
+
+		if( write_count < 0 )
+		{
+			*error_code = (uint32_t) errno;
+		}
+		else
+		{
+			internal_file->descriptor_offset += (off64_t) write_count;
+		}
+	}
+#endif /* defined( HAVE_PWRITE ) */
+
+	if( write_count < 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 *error_code,
+		 "%s: unable to write to file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->current_offset += write_count;
+
+	libcfile_internal_file_extend_size(
+	 internal_file,
+	 (size64_t) internal_file->current_offset );
+
+#if defined( HAVE_SYNC_FILE_RANGE )
+	if( internal_file->writeback_size > 0 )
+	{
+		if( libcfile_internal_file_writeback(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write back data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( write_count );
 }
 
 #else
-#error Missing file is device function
+#error Missing file write function
 #endif
 
-/* Read data from a device file using IO control
- * This function uses the POSIX ioctl function or WINAPI DeviceIoControl
- * Returns the number of bytes read if successful or -1 on error
+/* Writes a buffer to the file
+ * Sequential writes are coalesced in the write buffer if one was set
+ * If flushing the write buffer fails after part of the buffer was consumed
+ * the number of bytes consumed is returned and the flush is retried later
+ * Returns the number of bytes written if successful, or -1 on error
  */
-ssize_t libcfile_internal_file_io_control_read_with_error_code(
-         libcfile_internal_file_t *internal_file,
-         uint32_t control_code,
-         uint8_t *control_data,
-         size_t control_data_size,
-         uint8_t *data,
-         size_t data_size,
+ssize_t libcfile_file_write_buffer_with_error_code(
+         libcfile_file_t *file,
+         const uint8_t *buffer,
+         size_t size,
          uint32_t *error_code,
          libcerror_error_t **error )
 {
-	static char *function = "libcfile_internal_file_io_control_read_with_error_code";
-
-#if defined( WINAPI )
-	BOOL result           = 0;
-	DWORD response_count  = 0;
-#endif
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_write_buffer_with_error_code";
+	size_t buffer_offset                    = 0;
+	size_t write_buffer_alignment           = 0;
+	size_t write_size                       = 0;
+	ssize_t write_count                     = 0;
+	off64_t end_offset                      = 0;
 
-	if( internal_file == NULL )
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -3995,6 +5308,8 @@ ssize_t libcfile_internal_file_io_control_read_with_error_code(
 
 		return( -1 );
 	}
+	internal_file = (libcfile_internal_file_t *) file;
+
 #if defined( WINAPI )
 	if( internal_file->handle == INVALID_HANDLE_VALUE )
 	{
@@ -4020,182 +5335,361 @@ ssize_t libcfile_internal_file_io_control_read_with_error_code(
 		return( -1 );
 	}
 #endif
-	if( control_data == NULL )
+	if( buffer == NULL )
 	{
-		if( control_data_size != 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-			 "%s: invalid control data size value exceeds maximum.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
-	else
+	if( size > (size_t) SSIZE_MAX )
 	{
-#if ( UINT32_MAX < SSIZE_MAX )
-		if( control_data_size > (size_t) UINT32_MAX )
-#else
-		if( control_data_size > (size_t) SSIZE_MAX )
-#endif
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-			 "%s: invalid control data size value exceeds maximum.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
 
-			return( -1 );
+		return( -1 );
+	}
+	if( error_code == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->preallocation_step > 0 )
+	 && ( ( (size64_t) internal_file->current_offset + size ) > internal_file->preallocated_offset ) )
+	{
+		if( libcfile_internal_file_preallocate(
+		     internal_file,
+		     (size64_t) internal_file->current_offset + size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to preallocate storage.",
+			 function );
+
+			return( -1 );
 		}
 	}
-	if( data == NULL )
+	if( internal_file->write_buffer == NULL )
 	{
-		if( data_size != 0 )
+		write_count = libcfile_internal_file_write_buffer_with_error_code(
+		               internal_file,
+		               buffer,
+		               size,
+		               error_code,
+		               error );
+
+		if( write_count < 0 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-			 "%s: invalid data size value exceeds maximum.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write to file.",
 			 function );
 
 			return( -1 );
 		}
+		return( write_count );
 	}
-	else
+	/* Only writes that continue the buffered data are coalesced
+	 */
+	if( ( internal_file->write_buffer_data_size > 0 )
+	 && ( internal_file->current_offset != ( internal_file->write_buffer_offset + (off64_t) internal_file->write_buffer_data_size ) ) )
 	{
-#if ( UINT32_MAX < SSIZE_MAX )
-		if( data_size > (size_t) UINT32_MAX )
-#else
-		if( data_size > (size_t) SSIZE_MAX )
-#endif
+		if( libcfile_internal_file_flush_write_buffer(
+		     internal_file,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-			 "%s: invalid data size value exceeds maximum.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write buffer.",
 			 function );
 
 			return( -1 );
 		}
 	}
-	if( error_code == NULL )
+	while( buffer_offset < size )
+	{
+		if( internal_file->write_buffer_data_size == 0 )
+		{
+			internal_file->write_buffer_offset = internal_file->current_offset;
+
+			/* Data that fills at least the write buffer is written directly
+			 * up to a multiple of the write buffer size, the remainder is buffered
+			 */
+			if( ( size - buffer_offset ) >= internal_file->write_buffer_size )
+			{
+				end_offset = internal_file->current_offset + (off64_t) ( size - buffer_offset );
+				write_size = ( size - buffer_offset ) - (size_t) ( end_offset % internal_file->write_buffer_size );
+
+				write_count = libcfile_internal_file_write_buffer_with_error_code(
+				               internal_file,
+				               &( buffer[ buffer_offset ] ),
+				               write_size,
+				               error_code,
+				               error );
+
+				if( ( write_count < 0 )
+				 && ( buffer_offset > 0 ) )
+				{
+					libcerror_error_free(
+					 error );
+
+					break;
+				}
+				else if( write_count < 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write to file.",
+					 function );
+
+					return( -1 );
+				}
+				else if( write_count == 0 )
+				{
+					break;
+				}
+				buffer_offset += (size_t) write_count;
+
+				continue;
+			}
+		}
+		/* The buffered data is flushed at a multiple of the write buffer size
+		 */
+		write_buffer_alignment = (size_t) ( internal_file->write_buffer_offset % internal_file->write_buffer_size );
+
+		write_size = internal_file->write_buffer_size - write_buffer_alignment - internal_file->write_buffer_data_size;
+
+		if( write_size > ( size - buffer_offset ) )
+		{
+			write_size = size - buffer_offset;
+		}
+		if( memory_copy(
+		     &( internal_file->write_buffer[ internal_file->write_buffer_data_size ] ),
+		     &( buffer[ buffer_offset ] ),
+		     write_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to write buffer.",
+			 function );
+
+			return( -1 );
+		}
+		internal_file->write_buffer_data_size += write_size;
+		internal_file->current_offset         += (off64_t) write_size;
+		buffer_offset                         += write_size;
+
+		libcfile_internal_file_extend_size(
+		 internal_file,
+		 (size64_t) internal_file->current_offset );
+
+		if( ( write_buffer_alignment + internal_file->write_buffer_data_size ) == internal_file->write_buffer_size )
+		{
+			if( libcfile_internal_file_flush_write_buffer(
+			     internal_file,
+			     error ) != 1 )
+			{
+				/* The data that was copied into the write buffer is kept there
+				 * so that the flush can be retried, hence it was written
+				 */
+				if( buffer_offset > 0 )
+				{
+					libcerror_error_free(
+					 error );
+
+					break;
+				}
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to flush write buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Flushes the data in the write buffer to the file
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_internal_file_flush_write_buffer(
+     libcfile_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	static char *function  = "libcfile_internal_file_flush_write_buffer";
+	size_t buffer_index    = 0;
+	size_t flush_offset    = 0;
+	ssize_t write_count    = 0;
+	off64_t current_offset = 0;
+	uint32_t error_code    = 0;
+
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid error code.",
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( WINAPI )
-	result = DeviceIoControl(
-	          internal_file->handle,
-	          (DWORD) control_code,
-	          control_data,
-	          (DWORD) control_data_size,
-	          data,
-	          (DWORD) data_size,
-	          &response_count,
-	          NULL );
+	if( internal_file->write_buffer_data_size == 0 )
+	{
+		return( 1 );
+	}
+	/* The buffered data is written at the offset it was buffered at
+	 * which also moves the offset of the file descriptor or handle
+	 * back in sync with the current offset
+	 */
+	current_offset = internal_file->current_offset;
 
-	if( result == FALSE )
+	internal_file->current_offset = internal_file->write_buffer_offset;
+
+	while( flush_offset < internal_file->write_buffer_data_size )
 	{
-		*error_code = (uint32_t) GetLastError();
+		write_count = libcfile_internal_file_write_buffer_with_error_code(
+		               internal_file,
+		               &( internal_file->write_buffer[ flush_offset ] ),
+		               internal_file->write_buffer_data_size - flush_offset,
+		               &error_code,
+		               error );
 
-		/* TODO: handle if( *error_code == ERROR_MORE_DATA ) */
+		if( write_count <= 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write buffered data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 internal_file->current_offset,
+			 internal_file->current_offset );
 
-		libcerror_system_set_error(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-		 *error_code,
-		 "%s: unable to IO control device.",
-		 function );
+			goto on_error;
+		}
+		flush_offset += (size_t) write_count;
+	}
+	internal_file->current_offset         = current_offset;
+	internal_file->write_buffer_data_size = 0;
 
-		return( -1 );
+	return( 1 );
+
+on_error:
+	/* Keep the data that was not written so the flush can be retried
+	 */
+	if( flush_offset > 0 )
+	{
+		internal_file->write_buffer_data_size -= flush_offset;
+		internal_file->write_buffer_offset    += (off64_t) flush_offset;
+
+		/* The source and destination overlap hence memory_copy cannot be used
+		 */
+		for( buffer_index = 0;
+		     buffer_index < internal_file->write_buffer_data_size;
+		     buffer_index++ )
+		{
+			internal_file->write_buffer[ buffer_index ] = internal_file->write_buffer[ flush_offset + buffer_index ];
+		}
 	}
-#if ( SSIZE_MAX < UINT32_MAX )
-	if( response_count > (size_t) SSIZE_MAX )
+	internal_file->current_offset = current_offset;
+
+	return( -1 );
+}
+
+/* Flushes the data in the write buffer to the file
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_file_flush(
+     libcfile_file_t *file,
+     libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_flush";
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid response count value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( (ssize_t) response_count );
+	internal_file = (libcfile_internal_file_t *) file;
 
-#elif defined( HAVE_IOCTL )
-	if( control_data != NULL )
+	if( libcfile_internal_file_flush_write_buffer(
+	     internal_file,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported control data.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush write buffer.",
 		 function );
 
 		return( -1 );
 	}
-	if( ioctl(
-	     internal_file->descriptor,
-	     (int) control_code,
-	     data ) == -1 )
+	if( libcfile_internal_file_get_writeback_error(
+	     internal_file,
+	     error ) != 1 )
 	{
-		*error_code = (uint32_t) errno;
-
-		libcerror_system_set_error(
+		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-		 *error_code,
-		 "%s: unable to IO control device.",
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write back data.",
 		 function );
 
 		return( -1 );
 	}
-	return( (size_t) data_size );
-#else
-	libcerror_error_set(
-	 error,
-	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-	 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-	 "%s: missing IO control support.",
-	 function );
-
-	return( -1 );
-
-#endif /* defined( HAVE_IOCTL ) || defined( WINAPI ) */
+	return( 1 );
 }
 
-/* Read data from a device file using IO control
- * Returns the number of bytes read if successful or -1 on error
+/* Sets the size of the write buffer
+ * A size of 0 disables the write buffer
+ * Any data in the current write buffer is flushed first
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libcfile_file_io_control_read(
-         libcfile_file_t *file,
-         uint32_t control_code,
-         uint8_t *control_data,
-         size_t control_data_size,
-         uint8_t *data,
-         size_t data_size,
-         libcerror_error_t **error )
+int libcfile_file_set_write_buffer_size(
+     libcfile_file_t *file,
+     size_t write_buffer_size,
+     libcerror_error_t **error )
 {
 	libcfile_internal_file_t *internal_file = NULL;
-	static char *function                   = "libcfile_file_io_control_read";
-	ssize_t read_count                      = 0;
-	uint32_t error_code                     = 0;
+	static char *function                   = "libcfile_file_set_write_buffer_size";
 
 	if( file == NULL )
 	{
@@ -4210,48 +5704,79 @@ ssize_t libcfile_file_io_control_read(
 	}
 	internal_file = (libcfile_internal_file_t *) file;
 
-	read_count = libcfile_internal_file_io_control_read_with_error_code(
-	              internal_file,
-	              control_code,
-	              control_data,
-	              control_data_size,
-	              data,
-	              data_size,
-	              &error_code,
-	              error );
+	if( write_buffer_size > (size_t) LIBCFILE_MAXIMUM_WRITE_BUFFER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid write buffer size value exceeds maximum.",
+		 function );
 
-	if( read_count == -1 )
+		return( -1 );
+	}
+	if( libcfile_internal_file_flush_write_buffer(
+	     internal_file,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-		 "%s: unable to to IO control device.",
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush write buffer.",
 		 function );
 
 		return( -1 );
 	}
-	return( read_count );
-}
+	if( write_buffer_size == internal_file->write_buffer_size )
+	{
+		return( 1 );
+	}
+	if( internal_file->write_buffer != NULL )
+	{
+		memory_free(
+		 internal_file->write_buffer );
 
-/* Read data from a device file using IO control
- * Returns the number of bytes read if successful or -1 on error
+		internal_file->write_buffer      = NULL;
+		internal_file->write_buffer_size = 0;
+	}
+	if( write_buffer_size > 0 )
+	{
+		internal_file->write_buffer = (uint8_t *) memory_allocate(
+		                                           sizeof( uint8_t ) * write_buffer_size );
+
+		if( internal_file->write_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create write buffer.",
+			 function );
+
+			return( -1 );
+		}
+		internal_file->write_buffer_size = write_buffer_size;
+	}
+	return( 1 );
+}
+
+/* Synchronizes the data written to the file with the storage device
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libcfile_file_io_control_read_with_error_code(
-         libcfile_file_t *file,
-         uint32_t control_code,
-         uint8_t *control_data,
-         size_t control_data_size,
-         uint8_t *data,
-         size_t data_size,
-         uint32_t *error_code,
-         libcerror_error_t **error )
+int libcfile_internal_file_sync_with_error_code(
+     libcfile_internal_file_t *internal_file,
+     int sync_flags LIBCFILE_ATTRIBUTE_UNUSED,
+     uint32_t *error_code,
+     libcerror_error_t **error )
 {
-	libcfile_internal_file_t *internal_file = NULL;
-	static char *function                   = "libcfile_file_io_control_read_with_error_code";
-	ssize_t read_count                      = 0;
+	static char *function = "libcfile_internal_file_sync_with_error_code";
 
-	if( file == NULL )
+#if !defined( WINAPI )
+	int result            = 0;
+#endif
+
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -4262,65 +5787,84 @@ ssize_t libcfile_file_io_control_read_with_error_code(
 
 		return( -1 );
 	}
-	internal_file = (libcfile_internal_file_t *) file;
-
-	read_count = libcfile_internal_file_io_control_read_with_error_code(
-	              internal_file,
-	              control_code,
-	              control_data,
-	              control_data_size,
-	              data,
-	              data_size,
-	              error_code,
-	              error );
-
-	if( read_count == -1 )
+	if( error_code == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-		 "%s: unable to to IO control device.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
 		 function );
 
 		return( -1 );
 	}
-	return( read_count );
-}
+#if defined( WINAPI ) || !defined( HAVE_FDATASYNC )
+	LIBCFILE_UNREFERENCED_PARAMETER( sync_flags )
+#endif
 
-/* On some versions of Linux the FADVISE definions seem to be missing from fcntl.h
- */
-#if defined( HAVE_POSIX_FADVISE ) && !defined( WINAPI )
+#if defined( WINAPI )
+	/* FlushFileBuffers also writes the metadata of the file
+	 */
+	if( FlushFileBuffers(
+	     internal_file->handle ) == 0 )
+	{
+		*error_code = (uint32_t) GetLastError();
 
-#if !defined( POSIX_FADV_NORMAL )
-#define POSIX_FADV_NORMAL		0
-#endif
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 *error_code,
+		 "%s: unable to flush file buffers.",
+		 function );
 
-#if !defined( POSIX_FADV_RANDOM )
-#define POSIX_FADV_RANDOM		1
+		return( -1 );
+	}
+#elif defined( HAVE_FSYNC )
+#if defined( HAVE_FDATASYNC )
+	if( ( sync_flags & LIBCFILE_SYNC_FLAG_DATA_ONLY ) != 0 )
+	{
+		result = fdatasync(
+		          internal_file->descriptor );
+	}
+	else
 #endif
+	{
+		result = fsync(
+		          internal_file->descriptor );
+	}
+	if( result != 0 )
+	{
+		*error_code = (uint32_t) errno;
 
-#if !defined( POSIX_FADV_SEQUENTIAL )
-#define POSIX_FADV_SEQUENTIAL		2
-#endif
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 *error_code,
+		 "%s: unable to synchronize file.",
+		 function );
 
-#endif /* #if defined( HAVE_POSIX_FADVISE ) && !defined( WINAPI ) */
+		return( -1 );
+	}
+#else
+#error Missing file synchronize function
+#endif
+	return( 1 );
+}
 
-/* Sets the expected access behavior so the system can optimize the access
+/* Synchronizes the data written to the file with the storage device
+ * The data in the write buffer is flushed first
  * Returns 1 if successful or -1 on error
  */
-int libcfile_file_set_access_behavior(
+int libcfile_file_sync(
      libcfile_file_t *file,
-     int access_behavior,
+     int sync_flags,
      libcerror_error_t **error )
 {
 	libcfile_internal_file_t *internal_file = NULL;
-	static char *function                   = "libcfile_file_set_access_behavior";
-
-#if defined( HAVE_POSIX_FADVISE ) && !defined( WINAPI )
-	int advice                              = POSIX_FADV_NORMAL;
-	int result                              = 0;
-#endif
+	static char *function                   = "libcfile_file_sync";
+	uint32_t error_code                     = 0;
 
 	if( file == NULL )
 	{
@@ -4360,94 +5904,96 @@ int libcfile_file_set_access_behavior(
 		return( -1 );
 	}
 #endif
-	if( ( access_behavior != LIBCFILE_ACCESS_BEHAVIOR_NORMAL )
-	 && ( access_behavior != LIBCFILE_ACCESS_BEHAVIOR_RANDOM )
-	 && ( access_behavior != LIBCFILE_ACCESS_BEHAVIOR_SEQUENTIAL ) )
+	if( ( internal_file->access_flags & LIBCFILE_ACCESS_FLAG_WRITE ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: sync not supported without write access.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sync_flags & ~( LIBCFILE_SYNC_FLAG_DATA_ONLY ) ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access behavior: %d.",
+		 "%s: unsupported sync flags: 0x%02x.",
 		 function,
-		 access_behavior );
+		 sync_flags );
 
 		return( -1 );
 	}
-#if defined( HAVE_POSIX_FADVISE ) && !defined( WINAPI )
-	if( access_behavior == LIBCFILE_ACCESS_BEHAVIOR_NORMAL )
-	{
-		advice = POSIX_FADV_NORMAL;
-	}
-	else if( access_behavior == LIBCFILE_ACCESS_BEHAVIOR_RANDOM )
+	if( internal_file->write_buffer_data_size > 0 )
 	{
-		advice = POSIX_FADV_RANDOM;
+		if( libcfile_internal_file_flush_write_buffer(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write buffer.",
+			 function );
+
+			return( -1 );
+		}
 	}
-	else if( access_behavior == LIBCFILE_ACCESS_BEHAVIOR_SEQUENTIAL )
+	if( libcfile_internal_file_get_writeback_error(
+	     internal_file,
+	     error ) != 1 )
 	{
-		advice = POSIX_FADV_SEQUENTIAL;
-	}
-	result = posix_fadvise(
-	          internal_file->descriptor,
-	          0,
-	          0,
-	          advice );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write back data.",
+		 function );
 
-	/* Safely ignore if the device does not support fadvise.
-	 * Note that FreeBSD 10.0 had a bug and was returning -1
-	 * and setting errno.
-	 */
-	if( ( result != 0 )
-	 && ( result != ENODEV ) )
+		return( -1 );
+	}
+	if( libcfile_internal_file_sync_with_error_code(
+	     internal_file,
+	     sync_flags,
+	     &error_code,
+	     error ) != 1 )
 	{
-		libcerror_system_set_error(
+		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_GENERIC,
-		 errno,
-		 "%s: unable to advice file descriptor on access behavior.",
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to synchronize file.",
 		 function );
 
 		return( -1 );
 	}
-#endif /* defined( HAVE_POSIX_FADVISE ) && !defined( WINAPI ) */
-
 	return( 1 );
 }
 
-/* Determines the block size
- * Returns the 1 if successful, 0 if not or -1 on error
+/* Synchronizes a range of the data written to the file with the storage device
+ * A size of 0 represents the range from the offset up to the end of the file
+ * Returns 1 if successful or -1 on error
  */
-int libcfile_internal_file_determine_block_size(
-     libcfile_internal_file_t *internal_file,
+int libcfile_file_sync_range(
+     libcfile_file_t *file,
+     off64_t offset,
+     size64_t size,
+     int sync_range_flags,
      libcerror_error_t **error )
 {
-#if defined( WINAPI )
-#if ( WINVER >= 0x0600 )
-	FILE_ALIGNMENT_INFO file_alignment_information;
-#else
-	DISK_GEOMETRY disk_geometry;
-	DISK_GEOMETRY_EX disk_geometry_extended;
-#endif
-#endif /* defined( WINAPI ) */
-
-	static char *function     = "libcfile_internal_file_get_bytes_per_sector";
-	uint32_t error_code       = 0;
-
-#if defined( WINAPI )
-	uint32_t bytes_per_sector = 0;
-	BOOL result               = 0;
-#else
-	ssize_t read_count        = 0;
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_sync_range";
+	uint32_t error_code                     = 0;
 
-#if !defined( BLKSSZGET ) && defined( DIOCGSECTORSIZE )
-	u_int bytes_per_sector    = 0;
-#else
-	uint32_t bytes_per_sector = 0;
+#if defined( HAVE_SYNC_FILE_RANGE ) && !defined( WINAPI )
+	unsigned int flags                      = 0;
 #endif
-#endif /* defined( WINAPI ) */
 
-	if( internal_file == NULL )
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -4458,345 +6004,9669 @@ int libcfile_internal_file_determine_block_size(
 
 		return( -1 );
 	}
-#if defined( WINAPI )
-#if ( WINVER >= 0x0600 )
-	result = GetFileInformationByHandleEx(
-		  internal_file->handle,
-		  FileAlignmentInfo,
-		  (void *) &file_alignment_information,
-		  (DWORD) sizeof( FILE_ALIGNMENT_INFO ) );
+	internal_file = (libcfile_internal_file_t *) file;
 
-	if( result == FALSE )
+#if defined( WINAPI )
+	if( internal_file->handle == INVALID_HANDLE_VALUE )
 	{
-		error_code = (uint32_t) GetLastError();
-
-		libcerror_system_set_error(
+		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-		 error_code,
-		 "%s: unable to retrieve file alignment information.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing handle.",
 		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			if( ( error != NULL )
-			 && ( *error != NULL ) )
-			{
-				libcnotify_print_error_backtrace(
-				 *error );
-			}
-		}
-#endif
-		libcerror_error_free(
-		 error );
+		return( -1 );
 	}
-	else
+#else
+	if( internal_file->descriptor == -1 )
 	{
-		if( (size64_t) file_alignment_information.AlignmentRequirement >= (size64_t) UINT32_MAX )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid file alignment requirement value out of bounds.",
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_file->access_flags & LIBCFILE_ACCESS_FLAG_WRITE ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: sync range not supported without write access.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) ( INT64_MAX - offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sync_range_flags & ~( LIBCFILE_SYNC_RANGE_FLAG_NO_WAIT ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported sync range flags: 0x%02x.",
+		 function,
+		 sync_range_flags );
+
+		return( -1 );
+	}
+	if( internal_file->write_buffer_data_size > 0 )
+	{
+		if( libcfile_internal_file_flush_write_buffer(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write buffer.",
 			 function );
 
 			return( -1 );
 		}
-		bytes_per_sector = (size_t) file_alignment_information.AlignmentRequirement;
+	}
+	if( libcfile_internal_file_get_writeback_error(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write back data.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_SYNC_FILE_RANGE ) && !defined( WINAPI )
+	if( ( sync_range_flags & LIBCFILE_SYNC_RANGE_FLAG_NO_WAIT ) != 0 )
+	{
+		flags = SYNC_FILE_RANGE_WRITE;
+	}
+	else
+	{
+		flags = SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE | SYNC_FILE_RANGE_WAIT_AFTER;
+	}
+	if( sync_file_range(
+	     internal_file->descriptor,
+	     (off_t) offset,
+	     (off_t) size,
+	     flags ) == 0 )
+	{
+		return( 1 );
+	}
+	/* Fall back to synchronizing the entire file if the kernel does not support sync_file_range
+	 */
+	if( errno != ENOSYS )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 errno,
+		 "%s: unable to synchronize range of file.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_SYNC_FILE_RANGE ) && !defined( WINAPI ) */
+
+	/* Without support for starting the write back of a range the request is ignored
+	 */
+	if( ( sync_range_flags & LIBCFILE_SYNC_RANGE_FLAG_NO_WAIT ) != 0 )
+	{
+		return( 1 );
+	}
+	if( libcfile_internal_file_sync_with_error_code(
+	     internal_file,
+	     LIBCFILE_SYNC_FLAG_DATA_ONLY,
+	     &error_code,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to synchronize file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Commits the data written to the file to the storage device
+ * Concurrent commits of the same file are combined into a single synchronization
+ * of the data of the file, which is delayed up to the commit interval
+ * On systems without futex support the commits are not combined
+ * The write buffer is flushed by the caller that synchronizes on behalf of the other callers
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_file_commit(
+     libcfile_file_t *file,
+     libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_commit";
+	uint64_t sequence                       = 0;
+	uint64_t sync_sequence                  = 0;
+	uint32_t error_code                     = 0;
+	uint8_t is_synced                       = 0;
+	int result                              = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+#if defined( WINAPI )
+	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing handle.",
+		 function );
+
+		return( -1 );
 	}
 #else
-	result = DeviceIoControl(
-		  internal_file->handle,
-		  IOCTL_DISK_GET_DRIVE_GEOMETRY_EX,
-		  NULL,
-		  0,
-		  &disk_geometry_extended,
-		  (DWORD) sizeof( DISK_GEOMETRY_EX ),
-		  &response_count,
-		  NULL );
+	if( internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
 
-	if( result == FALSE )
+		return( -1 );
+	}
+#endif
+	if( ( internal_file->access_flags & LIBCFILE_ACCESS_FLAG_WRITE ) == 0 )
 	{
-		error_code = (uint32_t) GetLastError();
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: commit not supported without write access.",
+		 function );
 
-		if( error_code == ERROR_NOT_SUPPORTED )
+		return( -1 );
+	}
+	if( libcfile_group_commit_request(
+	     &( internal_file->group_commit ),
+	     &sequence,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to request commit.",
+		 function );
+
+		return( -1 );
+	}
+	result = libcfile_group_commit_begin(
+	          &( internal_file->group_commit ),
+	          sequence,
+	          &sync_sequence,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to begin commit.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 1 );
+	}
+	/* Only the caller that syncs on behalf of the other callers flushes the write buffer
+	 * and retrieves the write back error, so that these are not accessed concurrently
+	 */
+	if( libcfile_internal_file_flush_write_buffer(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush write buffer.",
+		 function );
+	}
+	else
+	{
+		error_code = internal_file->writeback_error_code;
+
+		if( libcfile_internal_file_get_writeback_error(
+		     internal_file,
+		     error ) != 1 )
 		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write back data.",
+			 function );
 		}
-		else if( error_code != ERROR_MORE_DATA )
+		else if( libcfile_internal_file_sync_with_error_code(
+		          internal_file,
+		          LIBCFILE_SYNC_FLAG_DATA_ONLY,
+		          &error_code,
+		          error ) != 1 )
 		{
-			libcerror_system_set_error(
+			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-			 error_code,
-			 "%s: unable to query device for: IOCTL_DISK_GET_DRIVE_GEOMETRY_EX.",
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to synchronize file.",
 			 function );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				if( ( error != NULL )
-				 && ( *error != NULL ) )
-				{
-					libcnotify_print_error_backtrace(
-					 *error );
-				}
-			}
-#endif
-			libcerror_error_free(
-			 error );
 		}
-		else if( response_count < sizeof( DISK_GEOMETRY_EX ) )
+		else
+		{
+			is_synced = 1;
+		}
+	}
+	if( libcfile_group_commit_end(
+	     &( internal_file->group_commit ),
+	     sync_sequence,
+	     is_synced,
+	     error_code,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to end commit.",
+		 function );
+
+		return( -1 );
+	}
+	if( is_synced == 0 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the commit interval
+ * The commit interval is the minimum time in microseconds between the start of
+ * consecutive synchronizations by libcfile_file_commit
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_file_set_commit_interval(
+     libcfile_file_t *file,
+     uint32_t commit_interval,
+     libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_set_commit_interval";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+	if( libcfile_group_commit_set_interval(
+	     &( internal_file->group_commit ),
+	     (uint64_t) commit_interval * 1000,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set group commit interval.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_SYNC_FILE_RANGE ) && !defined( WINAPI )
+
+/* Writes back the data written behind the current offset
+ * Once at least the writeback size of data was written since the last write back,
+ * the write back of that data is started and the data of which the write back was
+ * started previously is waited for and removed from the page cache
+ * Since the data was already written a failed write back is not returned as an error
+ * but recorded to be reported by the next flush or synchronization
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_internal_file_writeback(
+     libcfile_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_internal_file_writeback";
+	size64_t wait_size    = 0;
+	size64_t write_size   = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->writeback_size == 0 )
+	{
+		return( 1 );
+	}
+	/* Data that is rewritten before the last write back restarts the write back
+	 * at the current offset, the data of which the write back was already started
+	 * is written by the system without waiting for it
+	 */
+	if( internal_file->current_offset < internal_file->writeback_offset )
+	{
+		internal_file->writeback_offset      = internal_file->current_offset;
+		internal_file->writeback_wait_offset = internal_file->current_offset;
+
+		return( 1 );
+	}
+	write_size = (size64_t) ( internal_file->current_offset - internal_file->writeback_offset );
+
+	if( write_size < (size64_t) internal_file->writeback_size )
+	{
+		return( 1 );
+	}
+	write_size -= write_size % internal_file->writeback_size;
+
+	if( sync_file_range(
+	     internal_file->descriptor,
+	     (off_t) internal_file->writeback_offset,
+	     (off_t) write_size,
+	     SYNC_FILE_RANGE_WRITE ) != 0 )
+	{
+		/* The write back is an optimization hence it is disabled
+		 * if the file does not support it
+		 */
+		if( ( errno == ENOSYS )
+		 || ( errno == ESPIPE )
+		 || ( errno == EINVAL ) )
+		{
+			internal_file->writeback_size = 0;
+
+			return( 1 );
+		}
+		if( internal_file->writeback_error_code == 0 )
+		{
+			internal_file->writeback_error_code = (uint32_t) errno;
+		}
+		internal_file->writeback_offset += (off64_t) write_size;
+
+		return( 1 );
+	}
+	wait_size = (size64_t) ( internal_file->writeback_offset - internal_file->writeback_wait_offset );
+
+	if( wait_size > 0 )
+	{
+		if( sync_file_range(
+		     internal_file->descriptor,
+		     (off_t) internal_file->writeback_wait_offset,
+		     (off_t) wait_size,
+		     SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE | SYNC_FILE_RANGE_WAIT_AFTER ) != 0 )
+		{
+			if( internal_file->writeback_error_code == 0 )
+			{
+				internal_file->writeback_error_code = (uint32_t) errno;
+			}
+		}
+#if defined( HAVE_POSIX_FADVISE )
+		/* The advice is only a hint, a failure does not affect the write
+		 */
+		posix_fadvise(
+		 internal_file->descriptor,
+		 (off_t) internal_file->writeback_wait_offset,
+		 (off_t) wait_size,
+		 POSIX_FADV_DONTNEED );
+#endif
+	}
+	internal_file->writeback_wait_offset = internal_file->writeback_offset;
+	internal_file->writeback_offset     += (off64_t) write_size;
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_SYNC_FILE_RANGE ) && !defined( WINAPI ) */
+
+/* Retrieves the error of a failed write back that was not yet reported
+ * The error is reported only once
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_internal_file_get_writeback_error(
+     libcfile_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	static char *function         = "libcfile_internal_file_get_writeback_error";
+	uint32_t writeback_error_code = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->writeback_error_code != 0 )
+	{
+		writeback_error_code = internal_file->writeback_error_code;
+
+		internal_file->writeback_error_code = 0;
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 writeback_error_code,
+		 "%s: unable to write back data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the size of the window in which written data is written back behind the current offset
+ * Every time the writeback size of data was written, the write back of that data is started
+ * and the previous window is waited for and removed from the page cache
+ * A size of 0 disables the write back
+ * The write back has no effect on systems that do not support sync_file_range
+ * A failed write back does not fail the write but is reported by the next flush, sync or close
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_file_set_writeback_size(
+     libcfile_file_t *file,
+     size_t writeback_size,
+     libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_set_writeback_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+	if( writeback_size > (size_t) LIBCFILE_MAXIMUM_WRITEBACK_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid writeback size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->writeback_size        = writeback_size;
+	internal_file->writeback_offset      = internal_file->current_offset;
+	internal_file->writeback_wait_offset = internal_file->current_offset;
+
+	return( 1 );
+}
+
+/* Writes a buffer to the file at a specific offset
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t libcfile_file_write_buffer_at_offset(
+         libcfile_file_t *file,
+         const uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libcfile_file_write_buffer_at_offset";
+	ssize_t write_count   = 0;
+	uint32_t error_code   = 0;
+
+	write_count = libcfile_file_write_buffer_at_offset_with_error_code(
+	               file,
+	               buffer,
+	               size,
+	               offset,
+	               &error_code,
+	               error );
+
+	if( write_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write to file at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	return( write_count );
+}
+
+/* Writes a buffer to the file at a specific offset
+ * This function does not change the current offset of the file
+ * and can be used concurrently on the same file if no write buffer and no block size is set
+ * The block cache of a file with a block size is invalidated without a lock
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t libcfile_file_write_buffer_at_offset_with_error_code(
+         libcfile_file_t *file,
+         const uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         uint32_t *error_code,
+         libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_write_buffer_at_offset_with_error_code";
+	ssize_t write_count                     = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+#if defined( WINAPI )
+	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing handle.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI ) && ( UINT32_MAX < SSIZE_MAX )
+	if( size > (size_t) UINT32_MAX )
+#else
+	if( size > (size_t) SSIZE_MAX )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( error_code == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->write_buffer_data_size > 0 )
+	{
+		if( libcfile_internal_file_flush_write_buffer(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( size == 0 )
+	{
+		return( 0 );
+	}
+	write_count = libcfile_internal_file_write_buffer_at_offset_with_error_code(
+	               internal_file,
+	               offset,
+	               buffer,
+	               size,
+	               error_code,
+	               error );
+
+	if( write_count < 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 *error_code,
+		 "%s: unable to write to file.",
+		 function );
+
+		return( -1 );
+	}
+	libcfile_internal_file_extend_size(
+	 internal_file,
+	 (size64_t) offset + write_count );
+
+	return( write_count );
+}
+
+/* Determines the size of a vector of buffers
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_internal_file_get_vector_size(
+     libcfile_internal_file_t *internal_file,
+     const uint8_t **buffers,
+     const size_t *buffer_sizes,
+     int number_of_buffers,
+     size_t *vector_size,
+     libcerror_error_t **error )
+{
+	static char *function   = "libcfile_internal_file_get_vector_size";
+	size_t safe_vector_size = 0;
+	int buffer_index        = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_buffers < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of buffers value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( vector_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid vector size.",
+		 function );
+
+		return( -1 );
+	}
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		if( buffers[ buffer_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid buffer: %d.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+#if defined( WINAPI ) && ( UINT32_MAX < SSIZE_MAX )
+		if( buffer_sizes[ buffer_index ] > ( (size_t) UINT32_MAX - safe_vector_size ) )
+#else
+		if( buffer_sizes[ buffer_index ] > ( (size_t) SSIZE_MAX - safe_vector_size ) )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid buffer: %d size value exceeds maximum.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+		safe_vector_size += buffer_sizes[ buffer_index ];
+	}
+	*vector_size = safe_vector_size;
+
+	return( 1 );
+}
+
+/* Determines if a vector of buffers is aligned with the block size
+ * For direct access the buffers must also be aligned in memory
+ * Returns 1 if aligned, 0 if not
+ */
+int libcfile_internal_file_vector_is_block_aligned(
+     libcfile_internal_file_t *internal_file,
+     off64_t offset,
+     uint8_t **buffers,
+     const size_t *buffer_sizes,
+     int number_of_buffers )
+{
+	int buffer_index = 0;
+
+	if( internal_file->block_size == 0 )
+	{
+		return( 1 );
+	}
+	if( ( offset % internal_file->block_size ) != 0 )
+	{
+		return( 0 );
+	}
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		if( ( buffer_sizes[ buffer_index ] % internal_file->block_size ) != 0 )
+		{
+			return( 0 );
+		}
+		if( libcfile_internal_file_buffer_is_block_aligned(
+		     internal_file,
+		     buffers[ buffer_index ] ) == 0 )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads a vector of buffers from the file at a specific offset
+ * This is an internal function to wrap preadv, which does not change the offset
+ * of the file descriptor, the buffers are passed in batches of at most
+ * LIBCFILE_MAXIMUM_NUMBER_OF_IO_VECTORS and reading stops at the first short read
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libcfile_internal_file_read_vector_at_offset_with_error_code(
+         libcfile_internal_file_t *internal_file,
+         off64_t current_offset,
+         uint8_t **buffers,
+         const size_t *buffer_sizes,
+         int number_of_buffers,
+         uint32_t *error_code,
+         libcerror_error_t **error )
+{
+#if defined( HAVE_PREADV ) && !defined( WINAPI )
+	struct iovec io_vectors[ LIBCFILE_MAXIMUM_NUMBER_OF_IO_VECTORS ];
+
+	size_t batch_size        = 0;
+	int number_of_io_vectors = 0;
+
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	uint64_t start_timestamp = 0;
+#endif
+#endif
+
+	static char *function    = "libcfile_internal_file_read_vector_at_offset_with_error_code";
+	size_t total_read_count  = 0;
+	ssize_t read_count       = 0;
+	int buffer_index         = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( current_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid current offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( error_code == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_PREADV ) && !defined( WINAPI )
+	if( internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_index < number_of_buffers )
+	{
+		batch_size           = 0;
+		number_of_io_vectors = 0;
+
+		while( ( buffer_index < number_of_buffers )
+		    && ( number_of_io_vectors < LIBCFILE_MAXIMUM_NUMBER_OF_IO_VECTORS ) )
+		{
+			io_vectors[ number_of_io_vectors ].iov_base = (void *) buffers[ buffer_index ];
+			io_vectors[ number_of_io_vectors ].iov_len  = buffer_sizes[ buffer_index ];
+
+			batch_size += buffer_sizes[ buffer_index ];
+
+			number_of_io_vectors++;
+			buffer_index++;
+		}
+		errno = 0;
+
+#if defined( HAVE_LIBCFILE_STATISTICS )
+		start_timestamp = libcfile_statistics_get_timestamp();
+#endif
+		read_count = preadv(
+		              internal_file->descriptor,
+		              io_vectors,
+		              number_of_io_vectors,
+		              (off_t) current_offset );
+#if defined( HAVE_LIBCFILE_STATISTICS )
+		libcfile_statistics_add_operation(
+		 &( internal_file->statistics ),
+		 LIBCFILE_OPERATION_TYPE_READ,
+		 read_count,
+		 start_timestamp );
+#endif
+
+		if( read_count < 0 )
+		{
+			*error_code = (uint32_t) errno;
+
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 *error_code,
+			 "%s: unable to read vector from file.",
+			 function );
+
+			return( -1 );
+		}
+		total_read_count += (size_t) read_count;
+		current_offset   += (off64_t) read_count;
+
+		if( (size_t) read_count < batch_size )
+		{
+			break;
+		}
+	}
+#else
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		read_count = libcfile_internal_file_read_buffer_at_offset_with_error_code(
+		              internal_file,
+		              current_offset,
+		              buffers[ buffer_index ],
+		              buffer_sizes[ buffer_index ],
+		              error_code,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer: %d from file.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+		total_read_count += (size_t) read_count;
+		current_offset   += (off64_t) read_count;
+
+		if( (size_t) read_count < buffer_sizes[ buffer_index ] )
+		{
+			break;
+		}
+	}
+#endif /* defined( HAVE_PREADV ) && !defined( WINAPI ) */
+
+	return( (ssize_t) total_read_count );
+}
+
+/* Reads a vector of buffers from the file
+ * The buffers are filled in order, as if read by consecutive calls to libcfile_file_read_buffer
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libcfile_file_read_vector(
+         libcfile_file_t *file,
+         uint8_t **buffers,
+         const size_t *buffer_sizes,
+         int number_of_buffers,
+         libcerror_error_t **error )
+{
+#if defined( HAVE_READV ) && !defined( WINAPI )
+	struct iovec io_vectors[ LIBCFILE_MAXIMUM_NUMBER_OF_IO_VECTORS ];
+
+	size_t batch_size                       = 0;
+	int number_of_io_vectors                = 0;
+
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	uint64_t start_timestamp = 0;
+#endif
+#endif
+
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_read_vector";
+	size_t total_read_count                 = 0;
+	size_t vector_size                      = 0;
+	ssize_t read_count                      = 0;
+	uint32_t error_code                     = 0;
+	int buffer_index                        = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+#if defined( WINAPI )
+	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing handle.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->write_buffer_data_size > 0 )
+	{
+		if( libcfile_internal_file_flush_write_buffer(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcfile_internal_file_get_vector_size(
+	     internal_file,
+	     (const uint8_t **) buffers,
+	     buffer_sizes,
+	     number_of_buffers,
+	     &vector_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine vector size.",
+		 function );
+
+		return( -1 );
+	}
+	if( vector_size == 0 )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_READV ) && !defined( WINAPI )
+	if( ( internal_file->block_size == 0 )
+	 && ( internal_file->mapped_data == NULL ) )
+	{
+		/* The vector is read at the current offset, which without positional I/O
+		 * requires the offset of the file descriptor to be seeked first
+		 */
+#if !defined( HAVE_PREADV )
+		if( libcfile_internal_file_seek_descriptor_offset(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek file descriptor offset.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+#if defined( HAVE_POSIX_FADVISE )
+		if( internal_file->access_behavior == LIBCFILE_ACCESS_BEHAVIOR_STREAMING )
+		{
+			if( libcfile_internal_file_drop_read_data(
+			     internal_file,
+			     internal_file->current_offset,
+			     vector_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_GENERIC,
+				 "%s: unable to remove read data from page cache.",
+				 function );
+
+				return( -1 );
+			}
+		}
+#endif
+		while( buffer_index < number_of_buffers )
+		{
+			batch_size           = 0;
+			number_of_io_vectors = 0;
+
+			while( ( buffer_index < number_of_buffers )
+			    && ( number_of_io_vectors < LIBCFILE_MAXIMUM_NUMBER_OF_IO_VECTORS ) )
+			{
+				io_vectors[ number_of_io_vectors ].iov_base = (void *) buffers[ buffer_index ];
+				io_vectors[ number_of_io_vectors ].iov_len  = buffer_sizes[ buffer_index ];
+
+				batch_size += buffer_sizes[ buffer_index ];
+
+				number_of_io_vectors++;
+				buffer_index++;
+			}
+#if defined( HAVE_LIBCFILE_STATISTICS )
+			start_timestamp = libcfile_statistics_get_timestamp();
+#endif
+#if defined( HAVE_PREADV )
+			read_count = preadv(
+			              internal_file->descriptor,
+			              io_vectors,
+			              number_of_io_vectors,
+			              (off_t) internal_file->current_offset );
+#else
+			read_count = readv(
+			              internal_file->descriptor,
+			              io_vectors,
+			              number_of_io_vectors );
+#endif
+#if defined( HAVE_LIBCFILE_STATISTICS )
+			libcfile_statistics_add_operation(
+			 &( internal_file->statistics ),
+			 LIBCFILE_OPERATION_TYPE_READ,
+			 read_count,
+			 start_timestamp );
+#endif
+
+			if( read_count < 0 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 errno,
+				 "%s: unable to read vector from file.",
+				 function );
+
+				return( -1 );
+			}
+#if !defined( HAVE_PREADV )
+			internal_file->descriptor_offset += (off64_t) read_count;
+#endif
+			total_read_count              += (size_t) read_count;
+			internal_file->current_offset += (off64_t) read_count;
+
+			if( (size_t) read_count < batch_size )
+			{
+				break;
+			}
+		}
+		return( (ssize_t) total_read_count );
+	}
+#endif /* defined( HAVE_READV ) && !defined( WINAPI ) */
+
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		read_count = libcfile_file_read_buffer_with_error_code(
+		              file,
+		              buffers[ buffer_index ],
+		              buffer_sizes[ buffer_index ],
+		              &error_code,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer: %d from file.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+		total_read_count += (size_t) read_count;
+
+		if( (size_t) read_count < buffer_sizes[ buffer_index ] )
+		{
+			break;
+		}
+	}
+	return( (ssize_t) total_read_count );
+}
+
+/* Reads a vector of buffers from the file at a specific offset
+ * This function does not change the current offset of the file
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libcfile_file_read_vector_at_offset(
+         libcfile_file_t *file,
+         uint8_t **buffers,
+         const size_t *buffer_sizes,
+         int number_of_buffers,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_read_vector_at_offset";
+	size_t total_read_count                 = 0;
+	size_t vector_size                      = 0;
+	size64_t file_size                      = 0;
+	ssize_t read_count                      = 0;
+	uint32_t error_code                     = 0;
+	int buffer_index                        = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+#if defined( WINAPI )
+	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing handle.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->write_buffer_data_size > 0 )
+	{
+		if( libcfile_internal_file_flush_write_buffer(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcfile_internal_file_get_vector_size(
+	     internal_file,
+	     (const uint8_t **) buffers,
+	     buffer_sizes,
+	     number_of_buffers,
+	     &vector_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine vector size.",
+		 function );
+
+		return( -1 );
+	}
+	file_size = libcfile_internal_file_load_size(
+	             internal_file );
+
+	if( ( vector_size == 0 )
+	 || ( (size64_t) offset >= file_size ) )
+	{
+		return( 0 );
+	}
+	if( libcfile_internal_file_vector_is_block_aligned(
+	     internal_file,
+	     offset,
+	     buffers,
+	     buffer_sizes,
+	     number_of_buffers ) != 0 )
+	{
+		read_count = libcfile_internal_file_read_vector_at_offset_with_error_code(
+		              internal_file,
+		              offset,
+		              buffers,
+		              buffer_sizes,
+		              number_of_buffers,
+		              &error_code,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read vector from file at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		return( read_count );
+	}
+	/* A vector that is not block aligned is read per buffer
+	 * so that the non-aligned parts are handled
+	 */
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		read_count = libcfile_file_read_buffer_at_offset_with_error_code(
+		              file,
+		              buffers[ buffer_index ],
+		              buffer_sizes[ buffer_index ],
+		              offset,
+		              &error_code,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer: %d from file.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+		total_read_count += (size_t) read_count;
+		offset           += (off64_t) read_count;
+
+		if( (size_t) read_count < buffer_sizes[ buffer_index ] )
+		{
+			break;
+		}
+	}
+	return( (ssize_t) total_read_count );
+}
+
+/* Compares two read ranges by their offset
+ * Returns -1 if the first range is before the second, 0 if they start at the same offset
+ * or 1 if the first range is after the second
+ */
+int libcfile_internal_read_range_compare(
+     const void *first_range,
+     const void *second_range )
+{
+	off64_t first_offset  = ( (libcfile_internal_read_range_t *) first_range )->offset;
+	off64_t second_offset = ( (libcfile_internal_read_range_t *) second_range )->offset;
+
+	if( first_offset < second_offset )
+	{
+		return( -1 );
+	}
+	else if( first_offset > second_offset )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Reads multiple ranges from the file
+ * The ranges do not need to be sorted and can overlap. Ranges that are adjacent
+ * or separated by at most maximum_gap_size bytes are combined into a single read
+ * of at most LIBCFILE_MAXIMUM_COALESCED_READ_SIZE bytes
+ * This function does not change the current offset of the file
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_file_read_ranges(
+     libcfile_file_t *file,
+     uint8_t **buffers,
+     const off64_t *offsets,
+     const size_t *sizes,
+     int number_of_ranges,
+     size_t maximum_gap_size,
+     libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	libcfile_internal_read_range_t *ranges  = NULL;
+	uint8_t *coalesced_data                 = NULL;
+	uint8_t *reallocation                   = NULL;
+	static char *function                   = "libcfile_file_read_ranges";
+	size_t coalesced_data_size              = 0;
+	size_t read_size                        = 0;
+	size64_t file_size                      = 0;
+	ssize_t read_count                      = 0;
+	off64_t range_end_offset                = 0;
+	off64_t read_end_offset                 = 0;
+	off64_t read_offset                     = 0;
+	uint32_t error_code                     = 0;
+	int first_range_index                   = 0;
+	int last_range_index                    = 0;
+	int range_index                         = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+#if defined( WINAPI )
+	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing handle.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->write_buffer_data_size > 0 )
+	{
+		if( libcfile_internal_file_flush_write_buffer(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( number_of_ranges < 0 )
+	 || ( (size_t) number_of_ranges > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libcfile_internal_read_range_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of ranges value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI ) && ( UINT32_MAX < SSIZE_MAX )
+	if( maximum_gap_size > (size_t) UINT32_MAX )
+#else
+	if( maximum_gap_size > (size_t) SSIZE_MAX )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum gap size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_ranges == 0 )
+	{
+		return( 1 );
+	}
+	file_size = libcfile_internal_file_load_size(
+	             internal_file );
+
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		if( buffers[ range_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid buffer: %d.",
+			 function,
+			 range_index );
+
+			return( -1 );
+		}
+#if defined( WINAPI ) && ( UINT32_MAX < SSIZE_MAX )
+		if( sizes[ range_index ] > (size_t) UINT32_MAX )
+#else
+		if( sizes[ range_index ] > (size_t) SSIZE_MAX )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid size: %d value exceeds maximum.",
+			 function,
+			 range_index );
+
+			return( -1 );
+		}
+		if( ( offsets[ range_index ] < 0 )
+		 || ( (size64_t) offsets[ range_index ] > file_size )
+		 || ( (size64_t) sizes[ range_index ] > ( file_size - (size64_t) offsets[ range_index ] ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid range: %d value out of bounds.",
+			 function,
+			 range_index );
+
+			return( -1 );
+		}
+	}
+	ranges = (libcfile_internal_read_range_t *) memory_allocate(
+	                                             sizeof( libcfile_internal_read_range_t ) * number_of_ranges );
+
+	if( ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create ranges.",
+		 function );
+
+		goto on_error;
+	}
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		ranges[ range_index ].offset = offsets[ range_index ];
+		ranges[ range_index ].size   = sizes[ range_index ];
+		ranges[ range_index ].buffer = buffers[ range_index ];
+	}
+	qsort(
+	 ranges,
+	 (size_t) number_of_ranges,
+	 sizeof( libcfile_internal_read_range_t ),
+	 &libcfile_internal_read_range_compare );
+
+	first_range_index = 0;
+
+	while( first_range_index < number_of_ranges )
+	{
+		read_offset     = ranges[ first_range_index ].offset;
+		read_end_offset = read_offset + (off64_t) ranges[ first_range_index ].size;
+
+		/* Determine the ranges that can be combined into a single read
+		 */
+		for( last_range_index = first_range_index + 1;
+		     last_range_index < number_of_ranges;
+		     last_range_index++ )
+		{
+			if( ( ranges[ last_range_index ].offset - read_end_offset ) > (off64_t) maximum_gap_size )
+			{
+				break;
+			}
+			range_end_offset = ranges[ last_range_index ].offset + (off64_t) ranges[ last_range_index ].size;
+
+			if( range_end_offset > read_end_offset )
+			{
+				if( ( range_end_offset - read_offset ) > (off64_t) LIBCFILE_MAXIMUM_COALESCED_READ_SIZE )
+				{
+					break;
+				}
+				read_end_offset = range_end_offset;
+			}
+		}
+		read_size = (size_t) ( read_end_offset - read_offset );
+
+		if( last_range_index == ( first_range_index + 1 ) )
+		{
+			/* A range that could not be combined is read directly into its buffer
+			 */
+			read_count = libcfile_file_read_buffer_at_offset_with_error_code(
+			              file,
+			              ranges[ first_range_index ].buffer,
+			              read_size,
+			              read_offset,
+			              &error_code,
+			              error );
+		}
+		else
+		{
+			if( read_size > coalesced_data_size )
+			{
+				reallocation = (uint8_t *) memory_reallocate(
+				                            coalesced_data,
+				                            sizeof( uint8_t ) * read_size );
+
+				if( reallocation == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize coalesced data.",
+					 function );
+
+					goto on_error;
+				}
+				coalesced_data      = reallocation;
+				coalesced_data_size = read_size;
+			}
+			read_count = libcfile_file_read_buffer_at_offset_with_error_code(
+			              file,
+			              coalesced_data,
+			              read_size,
+			              read_offset,
+			              &error_code,
+			              error );
+		}
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read: %" PRIzd " bytes from file at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 read_size,
+			 read_offset,
+			 read_offset );
+
+			goto on_error;
+		}
+		if( last_range_index > ( first_range_index + 1 ) )
+		{
+			for( range_index = first_range_index;
+			     range_index < last_range_index;
+			     range_index++ )
+			{
+				if( memory_copy(
+				     ranges[ range_index ].buffer,
+				     &( coalesced_data[ ranges[ range_index ].offset - read_offset ] ),
+				     ranges[ range_index ].size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy range: %d data.",
+					 function,
+					 range_index );
+
+					goto on_error;
+				}
+			}
+		}
+		first_range_index = last_range_index;
+	}
+	if( coalesced_data != NULL )
+	{
+		memory_free(
+		 coalesced_data );
+	}
+	memory_free(
+	 ranges );
+
+	return( 1 );
+
+on_error:
+	if( coalesced_data != NULL )
+	{
+		memory_free(
+		 coalesced_data );
+	}
+	if( ranges != NULL )
+	{
+		memory_free(
+		 ranges );
+	}
+	return( -1 );
+}
+
+/* Writes a vector of buffers to the file at a specific offset
+ * This is an internal function to wrap pwritev, which does not change the offset
+ * of the file descriptor, the buffers are passed in batches of at most
+ * LIBCFILE_MAXIMUM_NUMBER_OF_IO_VECTORS and writing stops at the first short write
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t libcfile_internal_file_write_vector_at_offset_with_error_code(
+         libcfile_internal_file_t *internal_file,
+         off64_t current_offset,
+         const uint8_t **buffers,
+         const size_t *buffer_sizes,
+         int number_of_buffers,
+         uint32_t *error_code,
+         libcerror_error_t **error )
+{
+#if defined( HAVE_PWRITEV ) && !defined( WINAPI )
+	struct iovec io_vectors[ LIBCFILE_MAXIMUM_NUMBER_OF_IO_VECTORS ];
+
+	size_t batch_size        = 0;
+	int number_of_io_vectors = 0;
+
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	uint64_t start_timestamp = 0;
+#endif
+#endif
+
+	static char *function    = "libcfile_internal_file_write_vector_at_offset_with_error_code";
+	size_t total_write_count = 0;
+	ssize_t write_count      = 0;
+	int buffer_index         = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( current_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid current offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( error_code == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_PWRITEV ) && !defined( WINAPI )
+	if( internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_index < number_of_buffers )
+	{
+		batch_size           = 0;
+		number_of_io_vectors = 0;
+
+		while( ( buffer_index < number_of_buffers )
+		    && ( number_of_io_vectors < LIBCFILE_MAXIMUM_NUMBER_OF_IO_VECTORS ) )
+		{
+			io_vectors[ number_of_io_vectors ].iov_base = (void *) buffers[ buffer_index ];
+			io_vectors[ number_of_io_vectors ].iov_len  = buffer_sizes[ buffer_index ];
+
+			batch_size += buffer_sizes[ buffer_index ];
+
+			number_of_io_vectors++;
+			buffer_index++;
+		}
+		if( internal_file->block_cache != NULL )
+		{
+			if( libcfile_block_cache_invalidate_range(
+			     internal_file->block_cache,
+			     current_offset,
+			     (size64_t) batch_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to invalidate cached blocks.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		errno = 0;
+
+#if defined( HAVE_LIBCFILE_STATISTICS )
+		start_timestamp = libcfile_statistics_get_timestamp();
+#endif
+		write_count = pwritev(
+		               internal_file->descriptor,
+		               io_vectors,
+		               number_of_io_vectors,
+		               (off_t) current_offset );
+#if defined( HAVE_LIBCFILE_STATISTICS )
+		libcfile_statistics_add_operation(
+		 &( internal_file->statistics ),
+		 LIBCFILE_OPERATION_TYPE_WRITE,
+		 write_count,
+		 start_timestamp );
+#endif
+
+		if( write_count < 0 )
+		{
+			*error_code = (uint32_t) errno;
+
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 *error_code,
+			 "%s: unable to write vector to file.",
+			 function );
+
+			return( -1 );
+		}
+		total_write_count += (size_t) write_count;
+		current_offset    += (off64_t) write_count;
+
+		if( (size_t) write_count < batch_size )
+		{
+			break;
+		}
+	}
+#else
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		write_count = libcfile_internal_file_write_buffer_at_offset_with_error_code(
+		               internal_file,
+		               current_offset,
+		               buffers[ buffer_index ],
+		               buffer_sizes[ buffer_index ],
+		               error_code,
+		               error );
+
+		if( write_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write buffer: %d to file.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+		total_write_count += (size_t) write_count;
+		current_offset    += (off64_t) write_count;
+
+		if( (size_t) write_count < buffer_sizes[ buffer_index ] )
+		{
+			break;
+		}
+	}
+#endif /* defined( HAVE_PWRITEV ) && !defined( WINAPI ) */
+
+	return( (ssize_t) total_write_count );
+}
+
+/* Writes a vector of buffers to the file
+ * The buffers are written in order, as if written by consecutive calls to libcfile_file_write_buffer
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t libcfile_file_write_vector(
+         libcfile_file_t *file,
+         const uint8_t **buffers,
+         const size_t *buffer_sizes,
+         int number_of_buffers,
+         libcerror_error_t **error )
+{
+#if defined( HAVE_WRITEV ) && !defined( WINAPI )
+	struct iovec io_vectors[ LIBCFILE_MAXIMUM_NUMBER_OF_IO_VECTORS ];
+
+	size_t batch_size                       = 0;
+	int number_of_io_vectors                = 0;
+
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	uint64_t start_timestamp = 0;
+#endif
+#endif
+
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_write_vector";
+	size_t total_write_count                = 0;
+	size_t vector_size                      = 0;
+	ssize_t write_count                     = 0;
+	uint32_t error_code                     = 0;
+	int buffer_index                        = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+#if defined( WINAPI )
+	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing handle.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->write_buffer_data_size > 0 )
+	{
+		if( libcfile_internal_file_flush_write_buffer(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcfile_internal_file_get_vector_size(
+	     internal_file,
+	     buffers,
+	     buffer_sizes,
+	     number_of_buffers,
+	     &vector_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine vector size.",
+		 function );
+
+		return( -1 );
+	}
+	if( vector_size == 0 )
+	{
+		return( 0 );
+	}
+	if( ( internal_file->preallocation_step > 0 )
+	 && ( ( (size64_t) internal_file->current_offset + vector_size ) > internal_file->preallocated_offset ) )
+	{
+		if( libcfile_internal_file_preallocate(
+		     internal_file,
+		     (size64_t) internal_file->current_offset + vector_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to preallocate storage.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#if defined( HAVE_WRITEV ) && !defined( WINAPI )
+	if( internal_file->block_size == 0 )
+	{
+		/* The vector is written at the current offset, which without positional I/O
+		 * requires the offset of the file descriptor to be seeked first
+		 */
+#if !defined( HAVE_PWRITEV )
+		if( libcfile_internal_file_seek_descriptor_offset(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek file descriptor offset.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		while( buffer_index < number_of_buffers )
+		{
+			batch_size           = 0;
+			number_of_io_vectors = 0;
+
+			while( ( buffer_index < number_of_buffers )
+			    && ( number_of_io_vectors < LIBCFILE_MAXIMUM_NUMBER_OF_IO_VECTORS ) )
+			{
+				io_vectors[ number_of_io_vectors ].iov_base = (void *) buffers[ buffer_index ];
+				io_vectors[ number_of_io_vectors ].iov_len  = buffer_sizes[ buffer_index ];
+
+				batch_size += buffer_sizes[ buffer_index ];
+
+				number_of_io_vectors++;
+				buffer_index++;
+			}
+#if defined( HAVE_LIBCFILE_STATISTICS )
+			start_timestamp = libcfile_statistics_get_timestamp();
+#endif
+#if defined( HAVE_PWRITEV )
+			write_count = pwritev(
+			               internal_file->descriptor,
+			               io_vectors,
+			               number_of_io_vectors,
+			               (off_t) internal_file->current_offset );
+#else
+			write_count = writev(
+			               internal_file->descriptor,
+			               io_vectors,
+			               number_of_io_vectors );
+#endif
+#if defined( HAVE_LIBCFILE_STATISTICS )
+			libcfile_statistics_add_operation(
+			 &( internal_file->statistics ),
+			 LIBCFILE_OPERATION_TYPE_WRITE,
+			 write_count,
+			 start_timestamp );
+#endif
+
+			if( write_count < 0 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 errno,
+				 "%s: unable to write vector to file.",
+				 function );
+
+				return( -1 );
+			}
+#if !defined( HAVE_PWRITEV )
+			internal_file->descriptor_offset += (off64_t) write_count;
+#endif
+			total_write_count             += (size_t) write_count;
+			internal_file->current_offset += (off64_t) write_count;
+
+			libcfile_internal_file_extend_size(
+			 internal_file,
+			 (size64_t) internal_file->current_offset );
+
+			if( (size_t) write_count < batch_size )
+			{
+				break;
+			}
+		}
+#if defined( HAVE_SYNC_FILE_RANGE )
+		if( internal_file->writeback_size > 0 )
+		{
+			if( libcfile_internal_file_writeback(
+			     internal_file,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write back data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+#endif
+		return( (ssize_t) total_write_count );
+	}
+#endif /* defined( HAVE_WRITEV ) && !defined( WINAPI ) */
+
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		write_count = libcfile_file_write_buffer_with_error_code(
+		               file,
+		               buffers[ buffer_index ],
+		               buffer_sizes[ buffer_index ],
+		               &error_code,
+		               error );
+
+		if( write_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write buffer: %d to file.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+		total_write_count += (size_t) write_count;
+
+		if( (size_t) write_count < buffer_sizes[ buffer_index ] )
+		{
+			break;
+		}
+	}
+	return( (ssize_t) total_write_count );
+}
+
+/* Writes a vector of buffers to the file at a specific offset
+ * This function does not change the current offset of the file
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t libcfile_file_write_vector_at_offset(
+         libcfile_file_t *file,
+         const uint8_t **buffers,
+         const size_t *buffer_sizes,
+         int number_of_buffers,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_write_vector_at_offset";
+	size_t vector_size                      = 0;
+	ssize_t write_count                     = 0;
+	uint32_t error_code                     = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+#if defined( WINAPI )
+	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing handle.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->write_buffer_data_size > 0 )
+	{
+		if( libcfile_internal_file_flush_write_buffer(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcfile_internal_file_get_vector_size(
+	     internal_file,
+	     buffers,
+	     buffer_sizes,
+	     number_of_buffers,
+	     &vector_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine vector size.",
+		 function );
+
+		return( -1 );
+	}
+	write_count = libcfile_internal_file_write_vector_at_offset_with_error_code(
+	               internal_file,
+	               offset,
+	               buffers,
+	               buffer_sizes,
+	               number_of_buffers,
+	               &error_code,
+	               error );
+
+	if( write_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write vector to file at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	libcfile_internal_file_extend_size(
+	 internal_file,
+	 (size64_t) offset + write_count );
+
+	return( write_count );
+}
+
+#if defined( HAVE_IOCTL ) && defined( FICLONERANGE ) && !defined( WINAPI )
+
+/* Copies a range of a file into another file by cloning the extents (reflink)
+ * Returns the number of bytes copied, which is 0 if cloning is not supported, or -1 on error
+ */
+ssize_t libcfile_internal_file_clone_range(
+         libcfile_internal_file_t *source_internal_file,
+         off64_t source_offset,
+         libcfile_internal_file_t *destination_internal_file,
+         off64_t destination_offset,
+         size_t size,
+         libcerror_error_t **error )
+{
+	struct file_clone_range clone_range;
+
+	static char *function = "libcfile_internal_file_clone_range";
+
+	if( source_internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source file.",
+		 function );
+
+		return( -1 );
+	}
+	if( destination_internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination file.",
+		 function );
+
+		return( -1 );
+	}
+	/* A clone range with a length of 0 clones up to the end of the source file
+	 */
+	if( size == 0 )
+	{
+		return( 0 );
+	}
+	clone_range.src_fd      = (int64_t) source_internal_file->descriptor;
+	clone_range.src_offset  = (uint64_t) source_offset;
+	clone_range.src_length  = (uint64_t) size;
+	clone_range.dest_offset = (uint64_t) destination_offset;
+
+	/* Cloning fails if the file system does not support it, the files are
+	 * on different file systems or the range is not aligned to the file
+	 * system block size, in which case the range is copied otherwise
+	 */
+	if( ioctl(
+	     destination_internal_file->descriptor,
+	     FICLONERANGE,
+	     &clone_range ) == -1 )
+	{
+		return( 0 );
+	}
+	return( (ssize_t) size );
+}
+
+#endif /* defined( HAVE_IOCTL ) && defined( FICLONERANGE ) && !defined( WINAPI ) */
+
+#if defined( HAVE_COPY_FILE_RANGE ) && !defined( WINAPI )
+
+/* Copies a range of a file into another file using copy_file_range
+ * Returns the number of bytes copied, which is 0 if copy_file_range is not supported, or -1 on error
+ */
+ssize_t libcfile_internal_file_copy_file_range(
+         libcfile_internal_file_t *source_internal_file,
+         off64_t source_offset,
+         libcfile_internal_file_t *destination_internal_file,
+         off64_t destination_offset,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function    = "libcfile_internal_file_copy_file_range";
+	size_t copy_size         = 0;
+	ssize_t copy_count       = 0;
+	ssize_t total_copy_count = 0;
+	loff_t input_offset      = 0;
+	loff_t output_offset     = 0;
+
+	if( source_internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source file.",
+		 function );
+
+		return( -1 );
+	}
+	if( destination_internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination file.",
+		 function );
+
+		return( -1 );
+	}
+	input_offset  = (loff_t) source_offset;
+	output_offset = (loff_t) destination_offset;
+
+	while( (size_t) total_copy_count < size )
+	{
+		copy_size = size - (size_t) total_copy_count;
+
+		if( copy_size > (size_t) LIBCFILE_MAXIMUM_COPY_RANGE_SIZE )
+		{
+			copy_size = (size_t) LIBCFILE_MAXIMUM_COPY_RANGE_SIZE;
+		}
+		/* copy_file_range updates the input and output offsets
+		 */
+		copy_count = copy_file_range(
+		              source_internal_file->descriptor,
+		              &input_offset,
+		              destination_internal_file->descriptor,
+		              &output_offset,
+		              copy_size,
+		              0 );
+
+		/* On failure the remainder of the range is copied otherwise, which
+		 * also reports the error if the failure is not specific to copy_file_range
+		 */
+		if( copy_count <= 0 )
+		{
+			break;
+		}
+		total_copy_count += copy_count;
+	}
+	return( total_copy_count );
+}
+
+#endif /* defined( HAVE_COPY_FILE_RANGE ) && !defined( WINAPI ) */
+
+#if defined( HAVE_SENDFILE ) && defined( HAVE_SYS_SENDFILE_H ) && !defined( WINAPI )
+
+/* Copies a range of a file into another file using sendfile
+ * Returns the number of bytes copied, which is 0 if sendfile is not supported, or -1 on error
+ */
+ssize_t libcfile_internal_file_sendfile_range(
+         libcfile_internal_file_t *source_internal_file,
+         off64_t source_offset,
+         libcfile_internal_file_t *destination_internal_file,
+         off64_t destination_offset,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function    = "libcfile_internal_file_sendfile_range";
+	size_t copy_size         = 0;
+	ssize_t copy_count       = 0;
+	ssize_t total_copy_count = 0;
+	off_t input_offset       = 0;
+
+	if( source_internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source file.",
+		 function );
+
+		return( -1 );
+	}
+	if( destination_internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination file.",
+		 function );
+
+		return( -1 );
+	}
+	/* sendfile writes at the offset of the destination file descriptor
+	 * which is seeked to the current offset when it is used next
+	 */
+	if( lseek(
+	     destination_internal_file->descriptor,
+	     (off_t) destination_offset,
+	     SEEK_SET ) < 0 )
+	{
+		return( 0 );
+	}
+	input_offset = (off_t) source_offset;
+
+	while( (size_t) total_copy_count < size )
+	{
+		copy_size = size - (size_t) total_copy_count;
+
+		if( copy_size > (size_t) LIBCFILE_MAXIMUM_COPY_RANGE_SIZE )
+		{
+			copy_size = (size_t) LIBCFILE_MAXIMUM_COPY_RANGE_SIZE;
+		}
+		copy_count = sendfile(
+		              destination_internal_file->descriptor,
+		              source_internal_file->descriptor,
+		              &input_offset,
+		              copy_size );
+
+		if( copy_count <= 0 )
+		{
+			break;
+		}
+		total_copy_count += copy_count;
+	}
+	destination_internal_file->descriptor_offset = (off64_t) destination_offset + total_copy_count;
+
+	return( total_copy_count );
+}
+
+#endif /* defined( HAVE_SENDFILE ) && defined( HAVE_SYS_SENDFILE_H ) && !defined( WINAPI ) */
+
+/* Copies a range of a file into another file using a buffer
+ * Returns the number of bytes copied or -1 on error
+ */
+ssize_t libcfile_internal_file_copy_range_with_buffer(
+         libcfile_internal_file_t *source_internal_file,
+         off64_t source_offset,
+         libcfile_internal_file_t *destination_internal_file,
+         off64_t destination_offset,
+         size_t size,
+         libcerror_error_t **error )
+{
+	uint8_t *buffer          = NULL;
+	static char *function    = "libcfile_internal_file_copy_range_with_buffer";
+	size_t buffer_size       = 0;
+	size_t read_size         = 0;
+	ssize_t read_count       = 0;
+	ssize_t total_copy_count = 0;
+	ssize_t write_count      = 0;
+	uint32_t error_code      = 0;
+
+	if( source_internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source file.",
+		 function );
+
+		return( -1 );
+	}
+	if( destination_internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination file.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		return( 0 );
+	}
+	buffer_size = size;
+
+	if( buffer_size > (size_t) LIBCFILE_COPY_RANGE_BUFFER_SIZE )
+	{
+		buffer_size = (size_t) LIBCFILE_COPY_RANGE_BUFFER_SIZE;
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * buffer_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	while( (size_t) total_copy_count < size )
+	{
+		read_size = size - (size_t) total_copy_count;
+
+		if( read_size > buffer_size )
+		{
+			read_size = buffer_size;
+		}
+		/* The source is read with the public function so that the block
+		 * cache, memory mapped data and direct access are respected
+		 */
+		read_count = libcfile_file_read_buffer_at_offset(
+		              (libcfile_file_t *) source_internal_file,
+		              buffer,
+		              read_size,
+		              source_offset + total_copy_count,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from source file.",
+			 function );
+
+			goto on_error;
+		}
+		else if( read_count == 0 )
+		{
+			break;
+		}
+		write_count = libcfile_internal_file_write_buffer_at_offset_with_error_code(
+		               destination_internal_file,
+		               destination_offset + total_copy_count,
+		               buffer,
+		               (size_t) read_count,
+		               &error_code,
+		               error );
+
+		if( write_count != read_count )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write to destination file.",
+			 function );
+
+			goto on_error;
+		}
+		total_copy_count += write_count;
+	}
+	memory_free(
+	 buffer );
+
+	return( total_copy_count );
+
+on_error:
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( -1 );
+}
+
+/* Copies a range of a file into another file
+ * The copy is done by the kernel where possible, by cloning the extents (reflink),
+ * copy_file_range or sendfile, and otherwise by reading and writing the data
+ * The current offsets of the source and destination file are not changed
+ * Returns the number of bytes copied, which is less than size if the end of the source file was reached, or -1 on error
+ */
+ssize_t libcfile_file_copy_range(
+         libcfile_file_t *source_file,
+         off64_t source_offset,
+         libcfile_file_t *destination_file,
+         off64_t destination_offset,
+         size_t size,
+         libcerror_error_t **error )
+{
+	libcfile_internal_file_t *destination_internal_file = NULL;
+	libcfile_internal_file_t *source_internal_file      = NULL;
+	static char *function                               = "libcfile_file_copy_range";
+	size64_t source_file_size                           = 0;
+	ssize_t copy_count                                  = 0;
+	ssize_t total_copy_count                            = 0;
+
+	if( source_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source file.",
+		 function );
+
+		return( -1 );
+	}
+	source_internal_file = (libcfile_internal_file_t *) source_file;
+
+	if( destination_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination file.",
+		 function );
+
+		return( -1 );
+	}
+	destination_internal_file = (libcfile_internal_file_t *) destination_file;
+
+#if defined( WINAPI )
+	if( source_internal_file->handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid source file - missing handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( destination_internal_file->handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid destination file - missing handle.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( source_internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid source file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( destination_internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid destination file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( source_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( destination_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid destination offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_internal_file == destination_internal_file )
+	{
+		if( ( ( source_offset <= destination_offset )
+		  && ( (size64_t) destination_offset < ( (size64_t) source_offset + size ) ) )
+		 || ( ( destination_offset <= source_offset )
+		  && ( (size64_t) source_offset < ( (size64_t) destination_offset + size ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid source and destination range overlap.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( source_internal_file->write_buffer_data_size > 0 )
+	{
+		if( libcfile_internal_file_flush_write_buffer(
+		     source_internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( destination_internal_file->write_buffer_data_size > 0 )
+	{
+		if( libcfile_internal_file_flush_write_buffer(
+		     destination_internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	source_file_size = libcfile_internal_file_load_size(
+	                    source_internal_file );
+
+	/* Copy up to the end of the source file
+	 */
+	if( (size64_t) source_offset >= source_file_size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) size > ( source_file_size - source_offset ) )
+	{
+		size = (size_t) ( source_file_size - source_offset );
+	}
+	if( destination_internal_file->block_cache != NULL )
+	{
+		if( libcfile_block_cache_invalidate_range(
+		     destination_internal_file->block_cache,
+		     destination_offset,
+		     (size64_t) size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to invalidate cached blocks.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#if defined( HAVE_IOCTL ) && defined( FICLONERANGE ) && !defined( WINAPI )
+	total_copy_count = libcfile_internal_file_clone_range(
+	                    source_internal_file,
+	                    source_offset,
+	                    destination_internal_file,
+	                    destination_offset,
+	                    size,
+	                    error );
+
+	if( total_copy_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to clone range.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+#if defined( HAVE_COPY_FILE_RANGE ) && !defined( WINAPI )
+	if( (size_t) total_copy_count < size )
+	{
+		copy_count = libcfile_internal_file_copy_file_range(
+		              source_internal_file,
+		              source_offset + total_copy_count,
+		              destination_internal_file,
+		              destination_offset + total_copy_count,
+		              size - (size_t) total_copy_count,
+		              error );
+
+		if( copy_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to copy range with copy_file_range.",
+			 function );
+
+			return( -1 );
+		}
+		total_copy_count += copy_count;
+	}
+#endif
+#if defined( HAVE_SENDFILE ) && defined( HAVE_SYS_SENDFILE_H ) && !defined( WINAPI )
+	if( (size_t) total_copy_count < size )
+	{
+		copy_count = libcfile_internal_file_sendfile_range(
+		              source_internal_file,
+		              source_offset + total_copy_count,
+		              destination_internal_file,
+		              destination_offset + total_copy_count,
+		              size - (size_t) total_copy_count,
+		              error );
+
+		if( copy_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to copy range with sendfile.",
+			 function );
+
+			return( -1 );
+		}
+		total_copy_count += copy_count;
+	}
+#endif
+	if( (size_t) total_copy_count < size )
+	{
+		copy_count = libcfile_internal_file_copy_range_with_buffer(
+		              source_internal_file,
+		              source_offset + total_copy_count,
+		              destination_internal_file,
+		              destination_offset + total_copy_count,
+		              size - (size_t) total_copy_count,
+		              error );
+
+		if( copy_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to copy range with buffer.",
+			 function );
+
+			return( -1 );
+		}
+		total_copy_count += copy_count;
+	}
+	libcfile_internal_file_extend_size(
+	 destination_internal_file,
+	 (size64_t) destination_offset + total_copy_count );
+
+	return( total_copy_count );
+}
+
+#if ( defined( HAVE_SENDFILE ) && defined( HAVE_SYS_SENDFILE_H ) ) || defined( HAVE_SPLICE )
+#if !defined( WINAPI )
+
+/* Transfers a range of the file to a file descriptor in the kernel using splice or sendfile
+ * The range is expected to be block aligned if the file has a block size
+ * Returns the number of bytes transferred, which is 0 if not supported, or -1 on error
+ */
+ssize_t libcfile_internal_file_splice_range_to_descriptor(
+         libcfile_internal_file_t *internal_file,
+         off64_t offset,
+         size_t size,
+         int target_descriptor,
+         libcerror_error_t **error )
+{
+	static char *function        = "libcfile_internal_file_splice_range_to_descriptor";
+	size_t transfer_size         = 0;
+	ssize_t total_transfer_count = 0;
+	ssize_t transfer_count       = 0;
+
+#if defined( HAVE_SPLICE )
+	struct stat file_statistics;
+
+	loff_t splice_offset         = 0;
+	int use_splice               = 0;
+#endif
+#if defined( HAVE_SENDFILE ) && defined( HAVE_SYS_SENDFILE_H )
+	off_t input_offset           = 0;
+#endif
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_SPLICE )
+	/* splice requires one of the file descriptors to refer to a pipe
+	 */
+	if( fstat(
+	     target_descriptor,
+	     &file_statistics ) == 0 )
+	{
+		use_splice = S_ISFIFO( file_statistics.st_mode );
+	}
+	splice_offset = (loff_t) offset;
+#endif
+#if defined( HAVE_SENDFILE ) && defined( HAVE_SYS_SENDFILE_H )
+	input_offset = (off_t) offset;
+#endif
+
+	while( (size_t) total_transfer_count < size )
+	{
+		transfer_size = size - (size_t) total_transfer_count;
+
+		if( transfer_size > (size_t) LIBCFILE_MAXIMUM_COPY_RANGE_SIZE )
+		{
+			transfer_size = (size_t) LIBCFILE_MAXIMUM_COPY_RANGE_SIZE;
+		}
+#if defined( HAVE_SPLICE )
+		if( use_splice != 0 )
+		{
+			transfer_count = splice(
+			                  internal_file->descriptor,
+			                  &splice_offset,
+			                  target_descriptor,
+			                  NULL,
+			                  transfer_size,
+			                  SPLICE_F_MOVE | SPLICE_F_MORE );
+		}
+		else
+#endif
+		{
+#if defined( HAVE_SENDFILE ) && defined( HAVE_SYS_SENDFILE_H )
+			input_offset = (off_t) offset + total_transfer_count;
+
+			transfer_count = sendfile(
+			                  target_descriptor,
+			                  internal_file->descriptor,
+			                  &input_offset,
+			                  transfer_size );
+#else
+			transfer_count = 0;
+#endif
+		}
+		/* On failure the remainder of the range is transferred with a buffer,
+		 * which also reports the error if the failure is not specific to
+		 * splice or sendfile
+		 */
+		if( transfer_count <= 0 )
+		{
+			break;
+		}
+		total_transfer_count += transfer_count;
+	}
+	return( total_transfer_count );
+}
+
+#endif /* !defined( WINAPI ) */
+#endif /* ( defined( HAVE_SENDFILE ) && defined( HAVE_SYS_SENDFILE_H ) ) || defined( HAVE_SPLICE ) */
+
+/* Transfers a range of the file to a file descriptor using a buffer
+ * Returns the number of bytes transferred or -1 on error
+ */
+ssize_t libcfile_internal_file_write_range_to_descriptor(
+         libcfile_internal_file_t *internal_file,
+         off64_t offset,
+         size_t size,
+         int target_descriptor,
+         libcerror_error_t **error )
+{
+	uint8_t *buffer              = NULL;
+	static char *function        = "libcfile_internal_file_write_range_to_descriptor";
+	size_t buffer_offset         = 0;
+	size_t buffer_size           = 0;
+	size_t read_size             = 0;
+	ssize_t read_count           = 0;
+	ssize_t total_transfer_count = 0;
+	ssize_t write_count          = 0;
+
+#if defined( WINAPI )
+	HANDLE target_handle          = INVALID_HANDLE_VALUE;
+	DWORD number_of_bytes_written = 0;
+#endif
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		return( 0 );
+	}
+#if defined( WINAPI )
+	target_handle = (HANDLE) _get_osfhandle(
+	                          target_descriptor );
+
+	if( target_handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid target descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	buffer_size = size;
+
+	if( buffer_size > (size_t) LIBCFILE_COPY_RANGE_BUFFER_SIZE )
+	{
+		buffer_size = (size_t) LIBCFILE_COPY_RANGE_BUFFER_SIZE;
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * buffer_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	while( (size_t) total_transfer_count < size )
+	{
+		read_size = size - (size_t) total_transfer_count;
+
+		if( read_size > buffer_size )
+		{
+			read_size = buffer_size;
+		}
+		/* The file is read with the public function so that the block
+		 * cache, memory mapped data and direct access are respected
+		 */
+		read_count = libcfile_file_read_buffer_at_offset(
+		              (libcfile_file_t *) internal_file,
+		              buffer,
+		              read_size,
+		              offset + total_transfer_count,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from file.",
+			 function );
+
+			goto on_error;
+		}
+		else if( read_count == 0 )
+		{
+			break;
+		}
+		buffer_offset = 0;
+
+		while( buffer_offset < (size_t) read_count )
+		{
+#if defined( WINAPI )
+			if( WriteFile(
+			     target_handle,
+			     (VOID *) &( buffer[ buffer_offset ] ),
+			     (DWORD) ( read_count - buffer_offset ),
+			     &number_of_bytes_written,
+			     NULL ) == 0 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 (uint32_t) GetLastError(),
+				 "%s: unable to write to target descriptor.",
+				 function );
+
+				goto on_error;
+			}
+			write_count = (ssize_t) number_of_bytes_written;
+#else
+			write_count = write(
+			               target_descriptor,
+			               (void *) &( buffer[ buffer_offset ] ),
+			               (size_t) read_count - buffer_offset );
+
+			if( write_count < 0 )
+			{
+				if( errno == EINTR )
+				{
+					continue;
+				}
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 (uint32_t) errno,
+				 "%s: unable to write to target descriptor.",
+				 function );
+
+				goto on_error;
+			}
+#endif
+			if( write_count == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write to target descriptor.",
+				 function );
+
+				goto on_error;
+			}
+			buffer_offset += (size_t) write_count;
+		}
+		total_transfer_count += read_count;
+	}
+	memory_free(
+	 buffer );
+
+	return( total_transfer_count );
+
+on_error:
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( -1 );
+}
+
+/* Transfers a range of the file to a file descriptor, such as a pipe or socket
+ * The transfer is done in the kernel where possible, by splice or sendfile,
+ * and otherwise by reading and writing the data
+ * If the file has a block size only the block aligned part of the range is
+ * transferred in the kernel
+ * This function does not change the current offset of the file
+ * Returns the number of bytes transferred, which is less than size if the end of the file was reached, or -1 on error
+ */
+ssize_t libcfile_file_splice_to_descriptor(
+         libcfile_file_t *file,
+         off64_t offset,
+         size_t size,
+         int target_descriptor,
+         libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_splice_to_descriptor";
+	size_t aligned_size                     = 0;
+	size_t unaligned_size                   = 0;
+	size64_t file_size                      = 0;
+	ssize_t total_transfer_count            = 0;
+	ssize_t transfer_count                  = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+#if defined( WINAPI )
+	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing handle.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( target_descriptor < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid target descriptor value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->write_buffer_data_size > 0 )
+	{
+		if( libcfile_internal_file_flush_write_buffer(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	file_size = libcfile_internal_file_load_size(
+	             internal_file );
+
+	/* Transfer up to the end of the file
+	 */
+	if( (size64_t) offset >= file_size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) size > ( file_size - offset ) )
+	{
+		size = (size_t) ( file_size - offset );
+	}
+	aligned_size = size;
+
+	/* Block-based files, such as devices or files opened for direct access,
+	 * can only be read in the kernel at block aligned offsets hence the
+	 * unaligned start and end of the range are transferred with a buffer
+	 */
+	if( internal_file->block_size != 0 )
+	{
+		unaligned_size = (size_t) ( offset % internal_file->block_size );
+
+		if( unaligned_size != 0 )
+		{
+			unaligned_size = internal_file->block_size - unaligned_size;
+
+			if( unaligned_size > size )
+			{
+				unaligned_size = size;
+			}
+			transfer_count = libcfile_internal_file_write_range_to_descriptor(
+			                  internal_file,
+			                  offset,
+			                  unaligned_size,
+			                  target_descriptor,
+			                  error );
+
+			if( transfer_count != (ssize_t) unaligned_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to transfer unaligned start of range.",
+				 function );
+
+				return( -1 );
+			}
+			total_transfer_count = transfer_count;
+		}
+		aligned_size  = size - (size_t) total_transfer_count;
+		aligned_size -= aligned_size % internal_file->block_size;
+	}
+#if ( defined( HAVE_SENDFILE ) && defined( HAVE_SYS_SENDFILE_H ) ) || defined( HAVE_SPLICE )
+#if !defined( WINAPI )
+	if( aligned_size > 0 )
+	{
+		transfer_count = libcfile_internal_file_splice_range_to_descriptor(
+		                  internal_file,
+		                  offset + total_transfer_count,
+		                  aligned_size,
+		                  target_descriptor,
+		                  error );
+
+		if( transfer_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to splice range.",
+			 function );
+
+			return( -1 );
+		}
+		total_transfer_count += transfer_count;
+	}
+#endif /* !defined( WINAPI ) */
+#endif /* ( defined( HAVE_SENDFILE ) && defined( HAVE_SYS_SENDFILE_H ) ) || defined( HAVE_SPLICE ) */
+
+	if( (size_t) total_transfer_count < size )
+	{
+		transfer_count = libcfile_internal_file_write_range_to_descriptor(
+		                  internal_file,
+		                  offset + total_transfer_count,
+		                  size - (size_t) total_transfer_count,
+		                  target_descriptor,
+		                  error );
+
+		if( transfer_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to transfer range with buffer.",
+			 function );
+
+			return( -1 );
+		}
+		total_transfer_count += transfer_count;
+	}
+	return( total_transfer_count );
+}
+
+/* Sets the maximum number of asynchronous requests that can be outstanding
+ * The queue depth can only be set before the first asynchronous request is submitted
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_file_set_queue_depth(
+     libcfile_file_t *file,
+     int queue_depth,
+     libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_set_queue_depth";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+	if( internal_file->io_ring != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - IO ring value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( queue_depth <= 0 )
+	 || ( queue_depth > LIBCFILE_MAXIMUM_QUEUE_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid queue depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->queue_depth = queue_depth;
+
+	return( 1 );
+}
+
+/* Creates the IO ring used for asynchronous requests if it does not exist
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_internal_file_initialize_io_ring(
+     libcfile_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_internal_file_initialize_io_ring";
+	int queue_depth       = LIBCFILE_DEFAULT_QUEUE_DEPTH;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_ring != NULL )
+	{
+		return( 1 );
+	}
+	if( internal_file->queue_depth != 0 )
+	{
+		queue_depth = internal_file->queue_depth;
+	}
+	internal_file->completions = (libcfile_io_ring_request_t *) memory_allocate(
+	                                                             sizeof( libcfile_io_ring_request_t ) * queue_depth );
+
+	if( internal_file->completions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create completions.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcfile_io_ring_initialize(
+	     &( internal_file->io_ring ),
+	     queue_depth,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO ring.",
+		 function );
+
+		memory_free(
+		 internal_file->completions );
+
+		internal_file->completions = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Registers buffers for asynchronous requests
+ * Requests that read into or write from a registered buffer avoid mapping the buffer
+ * for every request. The buffers must remain valid until the file is closed
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_file_register_buffers(
+     libcfile_file_t *file,
+     uint8_t **buffers,
+     const size_t *buffer_sizes,
+     int number_of_buffers,
+     libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_register_buffers";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+	if( libcfile_internal_file_initialize_io_ring(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO ring.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcfile_io_ring_register_buffers(
+	     internal_file->io_ring,
+	     buffers,
+	     buffer_sizes,
+	     number_of_buffers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to register buffers.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Submits an asynchronous read or write request
+ * If the request cannot be handled asynchronously it is handled synchronously
+ * and its completion is returned by the next poll
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_internal_file_submit_request(
+     libcfile_internal_file_t *internal_file,
+     uint8_t operation,
+     uint8_t *buffer,
+     size_t size,
+     off64_t offset,
+     uint64_t request_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_internal_file_submit_request";
+	ssize_t result        = 0;
+	uint32_t error_code   = 0;
+	int is_aligned        = 1;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing handle.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI ) && ( UINT32_MAX < SSIZE_MAX )
+	if( size > (size_t) UINT32_MAX )
+#else
+	if( size > (size_t) SSIZE_MAX )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->write_buffer_data_size > 0 )
+	{
+		if( libcfile_internal_file_flush_write_buffer(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcfile_internal_file_initialize_io_ring(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO ring.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcfile_io_ring_is_full(
+	     internal_file->io_ring,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid file - queue is full.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->block_size != 0 )
+	{
+		if( ( ( offset % internal_file->block_size ) != 0 )
+		 || ( ( size % internal_file->block_size ) != 0 )
+		 || ( libcfile_internal_file_buffer_is_block_aligned(
+		       internal_file,
+		       buffer ) == 0 ) )
+		{
+			is_aligned = 0;
+		}
+	}
+#if !defined( WINAPI )
+	if( ( operation == LIBCFILE_IO_RING_OPERATION_WRITE )
+	 || ( is_aligned != 0 ) )
+	{
+		result = libcfile_io_ring_submit(
+		          internal_file->io_ring,
+		          internal_file->descriptor,
+		          operation,
+		          buffer,
+		          size,
+		          offset,
+		          request_identifier,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to submit request.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 1 )
+		{
+			return( 1 );
+		}
+	}
+#endif /* !defined( WINAPI ) */
+
+	/* The request is handled synchronously and errors are returned as the result
+	 * of the request, hence no error is passed to the read and write functions
+	 */
+	if( operation == LIBCFILE_IO_RING_OPERATION_READ )
+	{
+		result = libcfile_file_read_buffer_at_offset_with_error_code(
+		          (libcfile_file_t *) internal_file,
+		          buffer,
+		          size,
+		          offset,
+		          &error_code,
+		          NULL );
+	}
+	else
+	{
+		result = libcfile_internal_file_write_buffer_at_offset_with_error_code(
+		          internal_file,
+		          offset,
+		          buffer,
+		          size,
+		          &error_code,
+		          NULL );
+	}
+	if( result < 0 )
+	{
+		result = -( (ssize_t) error_code );
+	}
+	if( libcfile_io_ring_append_completion(
+	     internal_file->io_ring,
+	     request_identifier,
+	     operation,
+	     offset,
+	     size,
+	     result,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append completion.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Submits an asynchronous read request
+ * The buffer must remain valid until the completion of the request is polled
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_file_submit_read(
+     libcfile_file_t *file,
+     uint8_t *buffer,
+     size_t size,
+     off64_t offset,
+     uint64_t request_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_file_submit_read";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcfile_internal_file_submit_request(
+	     (libcfile_internal_file_t *) file,
+	     LIBCFILE_IO_RING_OPERATION_READ,
+	     buffer,
+	     size,
+	     offset,
+	     request_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to submit read request at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Submits an asynchronous write request
+ * The buffer must remain valid until the completion of the request is polled
+ * The size of the file is extended when the successful completion of the request is polled
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_file_submit_write(
+     libcfile_file_t *file,
+     const uint8_t *buffer,
+     size_t size,
+     off64_t offset,
+     uint64_t request_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_file_submit_write";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcfile_internal_file_submit_request(
+	     (libcfile_internal_file_t *) file,
+	     LIBCFILE_IO_RING_OPERATION_WRITE,
+	     (uint8_t *) buffer,
+	     size,
+	     offset,
+	     request_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to submit write request at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the completions of submitted asynchronous requests
+ * Waits until at least minimum_number_of_completions requests have completed, where
+ * the minimum is limited to the number of outstanding requests
+ * The result of a request is the number of bytes read or written or the negated system error code
+ * Returns the number of completions if successful or -1 on error
+ */
+int libcfile_file_poll_completions(
+     libcfile_file_t *file,
+     uint64_t *request_identifiers,
+     ssize_t *results,
+     int maximum_number_of_completions,
+     int minimum_number_of_completions,
+     libcerror_error_t **error )
+{
+	libcfile_io_ring_request_t *completion  = NULL;
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_poll_completions";
+	int completion_index                    = 0;
+	int number_of_completions               = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+	if( request_identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid request identifiers.",
+		 function );
+
+		return( -1 );
+	}
+	if( results == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid results.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_completions <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of completions value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( minimum_number_of_completions < 0 )
+	 || ( minimum_number_of_completions > maximum_number_of_completions ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid minimum number of completions value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+
+	if( libcfile_internal_file_initialize_io_ring(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO ring.",
+		 function );
+
+		return( -1 );
+	}
+	/* There are no more outstanding requests than the queue depth
+	 */
+	if( maximum_number_of_completions > internal_file->io_ring->queue_depth )
+	{
+		maximum_number_of_completions = internal_file->io_ring->queue_depth;
+	}
+	if( minimum_number_of_completions > maximum_number_of_completions )
+	{
+		minimum_number_of_completions = maximum_number_of_completions;
+	}
+	number_of_completions = libcfile_io_ring_poll(
+	                         internal_file->io_ring,
+	                         internal_file->completions,
+	                         maximum_number_of_completions,
+	                         minimum_number_of_completions,
+	                         error );
+
+	if( number_of_completions == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to poll completions.",
+		 function );
+
+		return( -1 );
+	}
+	for( completion_index = 0;
+	     completion_index < number_of_completions;
+	     completion_index++ )
+	{
+		completion = &( internal_file->completions[ completion_index ] );
+
+		request_identifiers[ completion_index ] = completion->identifier;
+		results[ completion_index ]             = completion->result;
+
+		/* The cached blocks and the size are only updated for the data that was written
+		 */
+		if( ( completion->operation != LIBCFILE_IO_RING_OPERATION_WRITE )
+		 || ( completion->result <= 0 ) )
+		{
+			continue;
+		}
+		if( internal_file->block_cache != NULL )
+		{
+			if( libcfile_block_cache_invalidate_range(
+			     internal_file->block_cache,
+			     completion->offset,
+			     (size64_t) completion->result,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to invalidate cached blocks.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		libcfile_internal_file_extend_size(
+		 internal_file,
+		 (size64_t) completion->offset + (size64_t) completion->result );
+	}
+	return( number_of_completions );
+}
+
+#if defined( WINAPI )
+
+/* Seeks a certain offset within the file
+ * This function uses the WINAPI function for Windows XP (0x0501) or later
+ * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libcfile_file_seek_offset(
+         libcfile_file_t *file,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_seek_offset";
+	off64_t calculated_offset               = 0;
+	off64_t base_offset                     = 0;
+	LARGE_INTEGER large_integer_offset      = LIBCFILE_LARGE_INTEGER_ZERO;
+	DWORD error_code                        = 0;
+	DWORD move_method                       = 0;
+	BOOL result                             = 0;
+
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	uint64_t start_timestamp                = 0;
+#endif
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset > (off64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid offset value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->write_buffer_data_size > 0 )
+	{
+		if( libcfile_internal_file_flush_write_buffer(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( whence == SEEK_CUR )
+	{
+		base_offset = internal_file->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		base_offset = (off64_t) libcfile_internal_file_load_size(
+		                         internal_file );
+	}
+	else if( whence != SEEK_SET )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset > 0 )
+	 && ( offset > ( (off64_t) INT64_MAX - base_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	calculated_offset = offset + base_offset;
+
+	if( calculated_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->block_size != 0 )
+	{
+		whence = SEEK_SET;
+		offset = calculated_offset;
+	}
+	if( whence == SEEK_SET )
+	{
+		move_method = FILE_BEGIN;
+	}
+	else if( whence == SEEK_CUR )
+	{
+		move_method = FILE_CURRENT;
+	}
+	else if( whence == SEEK_END )
+	{
+		move_method = FILE_END;
+	}
+	/* SetFilePointerEx cannot be used in combination with FILE_FLAG_OVERLAPPED.
+	 */
+	if( internal_file->use_asynchronous_io == 0 )
+	{
+#if defined( __BORLANDC__ ) && __BORLANDC__ <= 0x0520
+		large_integer_offset.QuadPart = (LONGLONG) offset;
+#else
+		large_integer_offset.LowPart  = (DWORD) ( 0x0ffffffffUL & offset );
+		large_integer_offset.HighPart = (LONG) ( offset >> 32 );
+#endif
+
+#if defined( HAVE_LIBCFILE_STATISTICS )
+		start_timestamp = libcfile_statistics_get_timestamp();
+#endif
+#if ( WINVER <= 0x0500 )
+		result = libcfile_SetFilePointerEx(
+		          internal_file->handle,
+		          large_integer_offset,
+		          &large_integer_offset,
+		          move_method );
+#else
+		result = SetFilePointerEx(
+		          internal_file->handle,
+		          large_integer_offset,
+		          &large_integer_offset,
+		          move_method );
+#endif
+#if defined( HAVE_LIBCFILE_STATISTICS )
+		libcfile_statistics_add_operation(
+		 &( internal_file->statistics ),
+		 LIBCFILE_OPERATION_TYPE_SEEK,
+		 ( result == 0 ) ? -1 : 0,
+		 start_timestamp );
+#endif
+		if( result == 0 )
+		{
+			error_code = GetLastError();
+
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 error_code,
+			 "%s: unable to seek offset in file.",
+			 function );
+
+			return( -1 );
+		}
+#if defined( __BORLANDC__ ) && __BORLANDC__ <= 0x0520
+		offset = (off64_t) large_integer_offset.QuadPart;
+#else
+		offset = ( (off64_t) large_integer_offset.HighPart << 32 ) + large_integer_offset.LowPart;
+#endif
+		if( offset < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: invalid offset: %" PRIi64 " returned.",
+			 function,
+			 offset );
+
+			return( -1 );
+		}
+	}
+	internal_file->current_offset = offset;
+
+	return( internal_file->current_offset );
+}
+
+#elif defined( HAVE_LSEEK )
+
+/* Seeks the offset of the file descriptor to the current offset
+ * This function uses the POSIX lseek function or equivalent
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_internal_file_seek_descriptor_offset(
+     libcfile_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_internal_file_seek_descriptor_offset";
+	off_t offset          = 0;
+
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	uint64_t start_timestamp = 0;
+#endif
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->descriptor_offset == internal_file->current_offset )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	start_timestamp = libcfile_statistics_get_timestamp();
+#endif
+	offset = lseek(
+	          internal_file->descriptor,
+	          (off_t) internal_file->current_offset,
+	          SEEK_SET );
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	libcfile_statistics_add_operation(
+	 &( internal_file->statistics ),
+	 LIBCFILE_OPERATION_TYPE_SEEK,
+	 ( offset < 0 ) ? -1 : 0,
+	 start_timestamp );
+#endif
+
+	if( offset < 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 errno,
+		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ") in file.",
+		 function,
+		 internal_file->current_offset,
+		 internal_file->current_offset );
+
+		return( -1 );
+	}
+	internal_file->descriptor_offset = (off64_t) offset;
+
+	return( 1 );
+}
+
+/* Seeks a certain offset within the file
+ * The offset of the file descriptor is not changed until the next read or write
+ * that uses it, reads and writes at the current offset use positional I/O if supported
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libcfile_file_seek_offset(
+         libcfile_file_t *file,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_seek_offset";
+	off64_t calculated_offset               = 0;
+	off64_t base_offset                     = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+	if( internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset > (off64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid offset value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->write_buffer_data_size > 0 )
+	{
+		if( libcfile_internal_file_flush_write_buffer(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( whence == SEEK_CUR )
+	{
+		base_offset = internal_file->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		base_offset = (off64_t) libcfile_internal_file_load_size(
+		                         internal_file );
+	}
+	else if( whence != SEEK_SET )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset > 0 )
+	 && ( offset > ( (off64_t) INT64_MAX - base_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	calculated_offset = offset + base_offset;
+
+	if( calculated_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if SIZEOF_OFF_T < 8
+	if( calculated_offset > (off64_t) INT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_file->current_offset = calculated_offset;
+
+	return( internal_file->current_offset );
+}
+
+#else
+#error Missing file lseek function
+#endif
+
+#if defined( WINAPI )
+
+/* Resizes the file
+ * This function uses the WINAPI function for Windows XP (0x0501) or later
+ * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_file_resize(
+     libcfile_file_t *file,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_resize";
+	off64_t offset                          = 0;
+	LARGE_INTEGER large_integer_offset      = LIBCFILE_LARGE_INTEGER_ZERO;
+	DWORD error_code                        = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->write_buffer_data_size > 0 )
+	{
+		if( libcfile_internal_file_flush_write_buffer(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#if defined( __BORLANDC__ ) && __BORLANDC__ <= 0x0520
+	large_integer_offset.QuadPart = (LONGLONG) size;
+#else
+	large_integer_offset.LowPart  = (DWORD) ( 0x0ffffffffUL & size );
+	large_integer_offset.HighPart = (LONG) ( size >> 32 );
+#endif
+
+#if ( WINVER <= 0x0500 )
+	if( libcfile_SetFilePointerEx(
+	     internal_file->handle,
+	     large_integer_offset,
+	     &large_integer_offset,
+	     FILE_BEGIN ) == 0 )
+#else
+	if( SetFilePointerEx(
+	     internal_file->handle,
+	     large_integer_offset,
+	     &large_integer_offset,
+	     FILE_BEGIN ) == 0 )
+#endif
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 error_code,
+		 "%s: unable to seek offset in file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( __BORLANDC__ ) && __BORLANDC__ <= 0x0520
+	offset = (off64_t) large_integer_offset.QuadPart;
+#else
+	offset = ( (off64_t) large_integer_offset.HighPart << 32 ) + large_integer_offset.LowPart;
+#endif
+
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: invalid offset: %" PRIi64 " returned.",
+		 function,
+		 offset );
+
+		return( -1 );
+	}
+	internal_file->current_offset = offset;
+
+#if ( WINVER <= 0x0500 )
+	if( libcfile_SetEndOfFile(
+	     internal_file->handle ) == 0 )
+#else
+	if( SetEndOfFile(
+	     internal_file->handle ) == 0 )
+#endif
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 error_code,
+		 "%s: unable to resize file.",
+		 function );
+
+		return( -1 );
+	}
+	/* Shrinking the file also releases the storage preallocated beyond the end of file
+	 */
+	if( ( size < libcfile_internal_file_load_size(
+	              internal_file ) )
+	 || ( size >= internal_file->preallocated_offset ) )
+	{
+		internal_file->preallocated_offset = 0;
+	}
+	libcfile_internal_file_store_size(
+	 internal_file,
+	 size );
+
+	return( 1 );
+}
+
+#elif defined( HAVE_FTRUNCATE )
+
+/* Resizes the file
+ * This function uses the POSIX truncate function or equivalent
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_file_resize(
+     libcfile_file_t *file,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_resize";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+	if( internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#if SIZEOF_OFF_T >= 8
+	if( size > (size64_t) INT64_MAX )
+#else
+	if( size > (size64_t) INT32_MAX )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->write_buffer_data_size > 0 )
+	{
+		if( libcfile_internal_file_flush_write_buffer(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ftruncate(
+	     internal_file->descriptor,
+	     (off_t) size ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 errno,
+		 "%s: unable to resize file.",
+		 function );
+
+		return( -1 );
+	}
+	/* Shrinking the file also releases the storage preallocated beyond the end of file
+	 */
+	if( ( size < libcfile_internal_file_load_size(
+	              internal_file ) )
+	 || ( size >= internal_file->preallocated_offset ) )
+	{
+		internal_file->preallocated_offset = 0;
+	}
+	libcfile_internal_file_store_size(
+	 internal_file,
+	 size );
+
+	return( 1 );
+}
+
+#else
+#error Missing file truncate function
+#endif
+
+#if defined( WINAPI )
+
+/* Allocates storage for a range of the file
+ * This function uses the WINAPI function for Windows Vista (0x0600) or later
+ * The allocation size of a file cannot exceed its end of file once it is closed
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libcfile_internal_file_allocate(
+     libcfile_internal_file_t *internal_file,
+     off64_t offset,
+     size64_t size,
+     int allocate_flags,
+     libcerror_error_t **error )
+{
+#if ( WINVER >= 0x0600 )
+	FILE_ALLOCATION_INFO allocation_information;
+	FILE_END_OF_FILE_INFO end_of_file_information;
+
+	DWORD error_code      = 0;
+#endif
+	static char *function = "libcfile_internal_file_allocate";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+#if ( WINVER >= 0x0600 )
+	/* Setting an allocation size that is smaller than the end of file truncates the file
+	 */
+	if( ( (size64_t) offset + size ) <= libcfile_internal_file_load_size(
+	                                      internal_file ) )
+	{
+		return( 1 );
+	}
+	allocation_information.AllocationSize.QuadPart = (LONGLONG) ( offset + size );
+
+	if( SetFileInformationByHandle(
+	     internal_file->handle,
+	     FileAllocationInfo,
+	     (void *) &allocation_information,
+	     (DWORD) sizeof( FILE_ALLOCATION_INFO ) ) == 0 )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 error_code,
+		 "%s: unable to set allocation size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( allocate_flags & LIBCFILE_ALLOCATE_FLAG_KEEP_SIZE ) == 0 )
+	{
+		end_of_file_information.EndOfFile.QuadPart = (LONGLONG) ( offset + size );
+
+		if( SetFileInformationByHandle(
+		     internal_file->handle,
+		     FileEndOfFileInfo,
+		     (void *) &end_of_file_information,
+		     (DWORD) sizeof( FILE_END_OF_FILE_INFO ) ) == 0 )
+		{
+			error_code = GetLastError();
+
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 error_code,
+			 "%s: unable to set end of file.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+#else
+	return( 0 );
+#endif /* ( WINVER >= 0x0600 ) */
+}
+
+#else
+
+/* Allocates storage for a range of the file
+ * This function uses the POSIX fallocate or posix_fallocate function or equivalent
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libcfile_internal_file_allocate(
+     libcfile_internal_file_t *internal_file,
+     off64_t offset,
+     size64_t size,
+     int allocate_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_internal_file_allocate";
+	int result            = 0;
+
+#if defined( HAVE_FALLOCATE ) && defined( FALLOC_FL_KEEP_SIZE )
+	int mode              = 0;
+#endif
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_FALLOCATE ) && defined( FALLOC_FL_KEEP_SIZE )
+	if( ( allocate_flags & LIBCFILE_ALLOCATE_FLAG_KEEP_SIZE ) != 0 )
+	{
+		mode = FALLOC_FL_KEEP_SIZE;
+	}
+	if( fallocate(
+	     internal_file->descriptor,
+	     mode,
+	     (off_t) offset,
+	     (off_t) size ) == 0 )
+	{
+		return( 1 );
+	}
+	/* Fall back to posix_fallocate if the file system does not support fallocate
+	 */
+	if( ( errno != EOPNOTSUPP )
+	 && ( errno != ENOSYS ) )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 errno,
+		 "%s: unable to allocate range in file.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_FALLOCATE ) && defined( FALLOC_FL_KEEP_SIZE ) */
+
+#if defined( HAVE_POSIX_FALLOCATE )
+	/* posix_fallocate always extends the file and can emulate the allocation
+	 * by writing blocks, hence it is not used to allocate beyond the end of file
+	 */
+	if( ( allocate_flags & LIBCFILE_ALLOCATE_FLAG_KEEP_SIZE ) == 0 )
+	{
+		/* posix_fallocate returns the error number instead of setting errno
+		 */
+		result = posix_fallocate(
+		          internal_file->descriptor,
+		          (off_t) offset,
+		          (off_t) size );
+
+		if( result == 0 )
+		{
+			return( 1 );
+		}
+		if( ( result != EINVAL )
+		 && ( result != EOPNOTSUPP ) )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 result,
+			 "%s: unable to allocate range in file.",
+			 function );
+
+			return( -1 );
+		}
+		result = 0;
+	}
+#endif /* defined( HAVE_POSIX_FALLOCATE ) */
+
+	return( result );
+}
+
+#endif /* defined( WINAPI ) */
+
+/* Allocates storage for a range of the file
+ * Allocated storage guarantees that writes to the range do not fail for lack of space
+ * and lets the file system lay out the range contiguously
+ * The file is extended if the range exceeds its size unless LIBCFILE_ALLOCATE_FLAG_KEEP_SIZE is set
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libcfile_file_allocate(
+     libcfile_file_t *file,
+     off64_t offset,
+     size64_t size,
+     int allocate_flags,
+     libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_allocate";
+	int result                              = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+#if defined( WINAPI )
+	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing handle.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_file->access_flags & LIBCFILE_ACCESS_FLAG_WRITE ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: allocate not supported without write access.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size64_t) ( INT64_MAX - offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( allocate_flags & ~( LIBCFILE_ALLOCATE_FLAG_KEEP_SIZE ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported allocate flags: 0x%02x.",
+		 function,
+		 allocate_flags );
+
+		return( -1 );
+	}
+	/* The write buffer is flushed first so that buffered data
+	 * is not counted as part of the size of the file
+	 */
+	if( internal_file->write_buffer_data_size > 0 )
+	{
+		if( libcfile_internal_file_flush_write_buffer(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	result = libcfile_internal_file_allocate(
+	          internal_file,
+	          offset,
+	          size,
+	          allocate_flags,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to allocate range in file.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result != 0 )
+	      && ( ( allocate_flags & LIBCFILE_ALLOCATE_FLAG_KEEP_SIZE ) == 0 ) )
+	{
+		libcfile_internal_file_extend_size(
+		 internal_file,
+		 (size64_t) offset + size );
+	}
+	return( result );
+}
+
+/* Preallocates storage ahead of a write that extends the file
+ * The size of the preallocation doubles on every preallocation up to
+ * LIBCFILE_MAXIMUM_PREALLOCATION_SIZE. Preallocation is a hint hence
+ * it is disabled for the file if it is not supported or fails
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_internal_file_preallocate(
+     libcfile_internal_file_t *internal_file,
+     size64_t end_offset,
+     libcerror_error_t **error )
+{
+	static char *function    = "libcfile_internal_file_preallocate";
+	size64_t allocate_offset = 0;
+	size64_t allocate_size   = 0;
+	size64_t file_size       = 0;
+	int result               = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	file_size = libcfile_internal_file_load_size(
+	             internal_file );
+
+	if( ( internal_file->preallocation_step == 0 )
+	 || ( end_offset <= internal_file->preallocated_offset )
+	 || ( end_offset <= file_size ) )
+	{
+		return( 1 );
+	}
+	allocate_offset = internal_file->preallocated_offset;
+
+	if( allocate_offset < file_size )
+	{
+		allocate_offset = file_size;
+	}
+	allocate_size = internal_file->preallocation_step;
+
+	if( ( allocate_offset + allocate_size ) < end_offset )
+	{
+		allocate_size = end_offset - allocate_offset;
+	}
+	result = libcfile_internal_file_allocate(
+	          internal_file,
+	          (off64_t) allocate_offset,
+	          allocate_size,
+	          LIBCFILE_ALLOCATE_FLAG_KEEP_SIZE,
+	          NULL );
+
+	if( result != 1 )
+	{
+		internal_file->preallocation_step = 0;
+
+		return( 1 );
+	}
+	internal_file->preallocated_offset = allocate_offset + allocate_size;
+
+	if( internal_file->preallocation_step < ( LIBCFILE_MAXIMUM_PREALLOCATION_SIZE / 2 ) )
+	{
+		internal_file->preallocation_step *= 2;
+	}
+	else
+	{
+		internal_file->preallocation_step = LIBCFILE_MAXIMUM_PREALLOCATION_SIZE;
+	}
+	return( 1 );
+}
+
+/* Sets the initial size of the automatic preallocation
+ * Writes that extend the file preallocate storage beyond the end of file
+ * in steps that start at the preallocation size and double every time
+ * The preallocated storage beyond the end of file is released on close
+ * A size of 0 disables the automatic preallocation
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_file_set_preallocation_size(
+     libcfile_file_t *file,
+     size64_t preallocation_size,
+     libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_set_preallocation_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+	if( preallocation_size > (size64_t) LIBCFILE_MAXIMUM_PREALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid preallocation size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->preallocation_size = preallocation_size;
+	internal_file->preallocation_step = preallocation_size;
+
+	return( 1 );
+}
+
+#if defined( WINAPI )
+
+/* Retrieves the next data extent at or after a specific offset
+ * This function uses the WINAPI FSCTL_QUERY_ALLOCATED_RANGES control code
+ * If the file system does not support sparse files the remainder of the file is one data extent
+ * Returns 1 if successful, 0 if there is no data at or after the offset or -1 on error
+ */
+int libcfile_internal_file_get_next_data_extent(
+     libcfile_internal_file_t *internal_file,
+     off64_t offset,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     libcerror_error_t **error )
+{
+	FILE_ALLOCATED_RANGE_BUFFER allocated_range;
+	FILE_ALLOCATED_RANGE_BUFFER query_range;
+
+	static char *function = "libcfile_internal_file_get_next_data_extent";
+	DWORD error_code      = 0;
+	DWORD response_count  = 0;
+	off64_t end_offset    = 0;
+	size64_t file_size    = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent size.",
+		 function );
+
+		return( -1 );
+	}
+	file_size = libcfile_internal_file_load_size(
+	             internal_file );
+
+	if( (size64_t) offset >= file_size )
+	{
+		return( 0 );
+	}
+	query_range.FileOffset.QuadPart = (LONGLONG) offset;
+	query_range.Length.QuadPart     = (LONGLONG) ( file_size - offset );
+
+	/* Only the first allocated range is retrieved hence ERROR_MORE_DATA is expected
+	 */
+	if( DeviceIoControl(
+	     internal_file->handle,
+	     FSCTL_QUERY_ALLOCATED_RANGES,
+	     (void *) &query_range,
+	     (DWORD) sizeof( FILE_ALLOCATED_RANGE_BUFFER ),
+	     (void *) &allocated_range,
+	     (DWORD) sizeof( FILE_ALLOCATED_RANGE_BUFFER ),
+	     &response_count,
+	     NULL ) == 0 )
+	{
+		error_code = GetLastError();
+
+		if( error_code == ERROR_INVALID_FUNCTION )
+		{
+			*extent_offset = offset;
+			*extent_size   = file_size - offset;
+
+			return( 1 );
+		}
+		else if( error_code != ERROR_MORE_DATA )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+			 error_code,
+			 "%s: unable to query allocated ranges.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( response_count < (DWORD) sizeof( FILE_ALLOCATED_RANGE_BUFFER ) )
+	{
+		return( 0 );
+	}
+	*extent_offset = (off64_t) allocated_range.FileOffset.QuadPart;
+	end_offset     = *extent_offset + (off64_t) allocated_range.Length.QuadPart;
+
+	if( *extent_offset < offset )
+	{
+		*extent_offset = offset;
+	}
+	if( (size64_t) end_offset > file_size )
+	{
+		end_offset = (off64_t) file_size;
+	}
+	*extent_size = (size64_t) ( end_offset - *extent_offset );
+
+	return( 1 );
+}
+
+#else
+
+/* Retrieves the next data extent at or after a specific offset
+ * This function uses the POSIX lseek function with SEEK_DATA and SEEK_HOLE
+ * If the file system does not support sparse files the remainder of the file is one data extent
+ * Returns 1 if successful, 0 if there is no data at or after the offset or -1 on error
+ */
+int libcfile_internal_file_get_next_data_extent(
+     libcfile_internal_file_t *internal_file,
+     off64_t offset,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_internal_file_get_next_data_extent";
+	size64_t file_size    = 0;
+
+#if defined( SEEK_DATA ) && defined( SEEK_HOLE )
+	off_t data_offset     = 0;
+	off_t hole_offset     = 0;
+	int data_error        = 0;
+#endif
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent size.",
+		 function );
+
+		return( -1 );
+	}
+	file_size = libcfile_internal_file_load_size(
+	             internal_file );
+
+	if( (size64_t) offset >= file_size )
+	{
+		return( 0 );
+	}
+#if defined( SEEK_DATA ) && defined( SEEK_HOLE )
+	data_offset = lseek(
+	               internal_file->descriptor,
+	               (off_t) offset,
+	               SEEK_DATA );
+
+	if( data_offset == -1 )
+	{
+		data_error = errno;
+	}
+	else
+	{
+		hole_offset = lseek(
+		               internal_file->descriptor,
+		               data_offset,
+		               SEEK_HOLE );
+
+		if( hole_offset == -1 )
+		{
+			data_error = errno;
+		}
+	}
+	/* SEEK_DATA and SEEK_HOLE move the offset of the file descriptor
+	 * which is seeked to the current offset when it is used next
+	 */
+	internal_file->descriptor_offset = -1;
+
+	/* ENXIO indicates there is no data at or after the offset
+	 * and EINVAL that the file system does not support SEEK_DATA
+	 */
+	if( data_error == ENXIO )
+	{
+		return( 0 );
+	}
+	else if( data_error == 0 )
+	{
+		if( (size64_t) data_offset >= file_size )
+		{
+			return( 0 );
+		}
+		if( (size64_t) hole_offset > file_size )
+		{
+			hole_offset = (off_t) file_size;
+		}
+		*extent_offset = (off64_t) data_offset;
+		*extent_size   = (size64_t) ( hole_offset - data_offset );
+
+		return( 1 );
+	}
+	else if( data_error != EINVAL )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 data_error,
+		 "%s: unable to seek data in file.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( SEEK_DATA ) && defined( SEEK_HOLE ) */
+
+	*extent_offset = offset;
+	*extent_size   = file_size - offset;
+
+	return( 1 );
+}
+
+#endif /* defined( WINAPI ) */
+
+/* Retrieves the next data extent at or after a specific offset
+ * The data extents of a sparse file can be iterated by calling this function
+ * with the end of the previous data extent
+ * Returns 1 if successful, 0 if there is no data at or after the offset or -1 on error
+ */
+int libcfile_file_get_next_data_extent(
+     libcfile_file_t *file,
+     off64_t offset,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_get_next_data_extent";
+	int result                              = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+#if defined( WINAPI )
+	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing handle.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->write_buffer_data_size > 0 )
+	{
+		if( libcfile_internal_file_flush_write_buffer(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	result = libcfile_internal_file_get_next_data_extent(
+	          internal_file,
+	          offset,
+	          extent_offset,
+	          extent_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next data extent at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Reads a buffer from the file at a specific offset
+ * Holes are filled with zero bytes without reading them
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libcfile_internal_file_read_buffer_at_offset_skipping_holes(
+         libcfile_internal_file_t *internal_file,
+         off64_t offset,
+         uint8_t *buffer,
+         size_t size,
+         uint32_t *error_code,
+         libcerror_error_t **error )
+{
+	static char *function      = "libcfile_internal_file_read_buffer_at_offset_skipping_holes";
+	size64_t data_extent_size  = 0;
+	size64_t file_size         = 0;
+	size_t buffer_offset       = 0;
+	size_t read_size           = 0;
+	ssize_t read_count         = 0;
+	off64_t data_extent_offset = 0;
+	int result                 = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	file_size = libcfile_internal_file_load_size(
+	             internal_file );
+
+	if( (size64_t) offset >= file_size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) size > ( file_size - offset ) )
+	{
+		size = (size_t) ( file_size - offset );
+	}
+	while( buffer_offset < size )
+	{
+		/* The last data extent is cached since consecutive reads
+		 * are likely to fall into the same hole or data extent
+		 */
+		if( ( offset < internal_file->data_extent_query_offset )
+		 || ( (size64_t) offset >= ( (size64_t) internal_file->data_extent_offset + internal_file->data_extent_size ) ) )
+		{
+			result = libcfile_internal_file_get_next_data_extent(
+			          internal_file,
+			          offset,
+			          &data_extent_offset,
+			          &data_extent_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next data extent at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 offset,
+				 offset );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				data_extent_offset = (off64_t) file_size;
+				data_extent_size   = 0;
+			}
+			internal_file->data_extent_query_offset = offset;
+			internal_file->data_extent_offset       = data_extent_offset;
+			internal_file->data_extent_size         = data_extent_size;
+		}
+		read_size = size - buffer_offset;
+
+		if( offset < internal_file->data_extent_offset )
+		{
+			if( (size64_t) read_size > (size64_t) ( internal_file->data_extent_offset - offset ) )
+			{
+				read_size = (size_t) ( internal_file->data_extent_offset - offset );
+			}
+			if( memory_set(
+			     &( buffer[ buffer_offset ] ),
+			     0,
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			if( (size64_t) read_size > ( ( (size64_t) internal_file->data_extent_offset + internal_file->data_extent_size ) - offset ) )
+			{
+				read_size = (size_t) ( ( (size64_t) internal_file->data_extent_offset + internal_file->data_extent_size ) - offset );
+			}
+			read_count = libcfile_internal_file_read_buffer_at_offset_with_error_code(
+			              internal_file,
+			              offset,
+			              &( buffer[ buffer_offset ] ),
+			              read_size,
+			              error_code,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read from file at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 offset,
+				 offset );
+
+				return( -1 );
+			}
+			else if( read_count == 0 )
+			{
+				break;
+			}
+			read_size = (size_t) read_count;
+		}
+		offset        += (off64_t) read_size;
+		buffer_offset += read_size;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Sets whether holes should be filled with zero bytes without reading them
+ * This applies to reads at the current offset of files without a block size
+ * that are not memory mapped
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_file_set_skip_holes(
+     libcfile_file_t *file,
+     uint8_t skip_holes,
+     libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_set_skip_holes";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+#if defined( WINAPI )
+	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing handle.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The data extents are cached which requires that the file is not written
+	 */
+	if( ( internal_file->access_flags & LIBCFILE_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: skipping holes not supported with write access.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->skip_holes               = ( skip_holes != 0 ) ? 1 : 0;
+	internal_file->data_extent_query_offset = 0;
+	internal_file->data_extent_offset       = 0;
+	internal_file->data_extent_size         = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the physical extents of the file
+ * The extents are retrieved in logical order starting with the extent that contains the offset
+ * If the last retrieved extent does not have the LIBCFILE_EXTENT_FLAG_LAST flag set, the next
+ * extents can be retrieved by calling this function with the end of the last retrieved extent
+ * The extents are retrieved with FIEMAP, on systems without FIEMAP, such as Windows,
+ * 0 is returned since the function is not supported
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libcfile_file_get_extents(
+     libcfile_file_t *file,
+     off64_t offset,
+     off64_t *logical_offsets,
+     off64_t *physical_offsets,
+     size64_t *extent_sizes,
+     uint32_t *extent_flags,
+     int maximum_number_of_extents,
+     int *number_of_extents,
+     libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_get_extents";
+
+#if defined( LIBCFILE_HAVE_FIEMAP )
+	struct fiemap *fiemap                   = NULL;
+	struct fiemap_extent *fiemap_extent     = NULL;
+	size_t fiemap_size                      = 0;
+	ssize_t read_count                      = 0;
+	uint32_t error_code                     = 0;
+	uint32_t extent_index                   = 0;
+	int result                              = 1;
+#endif
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+#if defined( WINAPI )
+	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing handle.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( logical_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( physical_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid physical offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_extents <= 0 )
+	 || ( maximum_number_of_extents > LIBCFILE_MAXIMUM_NUMBER_OF_EXTENTS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of extents value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of extents.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_extents = 0;
+
+#if defined( LIBCFILE_HAVE_FIEMAP )
+	if( internal_file->write_buffer_data_size > 0 )
+	{
+		if( libcfile_internal_file_flush_write_buffer(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	fiemap_size = sizeof( struct fiemap )
+	            + ( sizeof( struct fiemap_extent ) * (size_t) maximum_number_of_extents );
+
+	fiemap = (struct fiemap *) memory_allocate(
+	                            fiemap_size );
+
+	if( fiemap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create extent map.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     fiemap,
+	     0,
+	     fiemap_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear extent map.",
+		 function );
+
+		goto on_error;
+	}
+	/* FIEMAP_FLAG_SYNC makes sure delayed allocations have a physical location
+	 */
+	fiemap->fm_start        = (uint64_t) offset;
+	fiemap->fm_length       = FIEMAP_MAX_OFFSET - (uint64_t) offset;
+	fiemap->fm_flags        = FIEMAP_FLAG_SYNC;
+	fiemap->fm_extent_count = (uint32_t) maximum_number_of_extents;
+
+	read_count = libcfile_internal_file_io_control_read_with_error_code(
+	              internal_file,
+	              (uint32_t) FS_IOC_FIEMAP,
+	              NULL,
+	              0,
+	              (uint8_t *) fiemap,
+	              fiemap_size,
+	              &error_code,
+	              error );
+
+	if( read_count == -1 )
+	{
+		/* File systems that do not support FIEMAP return EOPNOTSUPP
+		 * and files that are not on a file system, such as devices, return ENOTTY
+		 */
+		if( ( error_code != (uint32_t) EOPNOTSUPP )
+		 && ( error_code != (uint32_t) ENOTTY ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+			 "%s: unable to query file for: FS_IOC_FIEMAP.",
+			 function );
+
+			goto on_error;
+		}
+		libcerror_error_free(
+		 error );
+
+		result = 0;
+	}
+	else if( fiemap->fm_mapped_extents > (uint32_t) maximum_number_of_extents )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of mapped extents value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	else
+	{
+		for( extent_index = 0;
+		     extent_index < fiemap->fm_mapped_extents;
+		     extent_index++ )
+		{
+			fiemap_extent = &( fiemap->fm_extents[ extent_index ] );
+
+			logical_offsets[ extent_index ]  = (off64_t) fiemap_extent->fe_logical;
+			physical_offsets[ extent_index ] = (off64_t) fiemap_extent->fe_physical;
+			extent_sizes[ extent_index ]     = (size64_t) fiemap_extent->fe_length;
+			extent_flags[ extent_index ]     = 0;
+
+			if( ( fiemap_extent->fe_flags & FIEMAP_EXTENT_LAST ) != 0 )
+			{
+				extent_flags[ extent_index ] |= LIBCFILE_EXTENT_FLAG_LAST;
+			}
+			if( ( fiemap_extent->fe_flags & ( FIEMAP_EXTENT_UNKNOWN | FIEMAP_EXTENT_DELALLOC ) ) != 0 )
+			{
+				extent_flags[ extent_index ] |= LIBCFILE_EXTENT_FLAG_UNKNOWN_LOCATION;
+			}
+			if( ( fiemap_extent->fe_flags & FIEMAP_EXTENT_SHARED ) != 0 )
+			{
+				extent_flags[ extent_index ] |= LIBCFILE_EXTENT_FLAG_SHARED;
+			}
+			if( ( fiemap_extent->fe_flags & FIEMAP_EXTENT_UNWRITTEN ) != 0 )
+			{
+				extent_flags[ extent_index ] |= LIBCFILE_EXTENT_FLAG_UNWRITTEN;
+			}
+			if( ( fiemap_extent->fe_flags & ( FIEMAP_EXTENT_ENCODED | FIEMAP_EXTENT_DATA_ENCRYPTED ) ) != 0 )
+			{
+				extent_flags[ extent_index ] |= LIBCFILE_EXTENT_FLAG_ENCODED;
+			}
+			if( ( fiemap_extent->fe_flags & ( FIEMAP_EXTENT_NOT_ALIGNED | FIEMAP_EXTENT_DATA_INLINE | FIEMAP_EXTENT_DATA_TAIL ) ) != 0 )
+			{
+				extent_flags[ extent_index ] |= LIBCFILE_EXTENT_FLAG_NOT_ALIGNED;
+			}
+		}
+		*number_of_extents = (int) fiemap->fm_mapped_extents;
+	}
+	memory_free(
+	 fiemap );
+
+	return( result );
+
+on_error:
+	if( fiemap != NULL )
+	{
+		memory_free(
+		 fiemap );
+	}
+	return( -1 );
+#else
+	/* The physical extents are only retrieved with FIEMAP, on other systems,
+	 * such as Windows, the function is not supported
+	 */
+	return( 0 );
+
+#endif /* defined( LIBCFILE_HAVE_FIEMAP ) */
+}
+
+/* Checks if the file is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int libcfile_file_is_open(
+     libcfile_file_t *file,
+     libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_is_open";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+#if defined( WINAPI )
+	if( internal_file->handle == INVALID_HANDLE_VALUE )
+#else
+	if( internal_file->descriptor == -1 )
+#endif
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the current offset in the file
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_file_get_offset(
+     libcfile_file_t *file,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_get_offset";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+#if defined( WINAPI )
+	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing handle.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	*offset = internal_file->current_offset;
+
+	return( 1 );
+}
+
+#if defined( WINAPI )
+
+#if !defined( IOCTL_DISK_GET_LENGTH_INFO )
+#define IOCTL_DISK_GET_LENGTH_INFO \
+	CTL_CODE( IOCTL_DISK_BASE, 0x0017, METHOD_BUFFERED, FILE_READ_ACCESS )
+
+typedef struct
+{
+	LARGE_INTEGER Length;
+}
+GET_LENGTH_INFORMATION;
+
+#endif /* !defined( IOCTL_DISK_GET_LENGTH_INFO ) */
+
+/* Retrieves the size of the file
+ * This function uses the WINAPI function for Windows XP (0x0501) or later
+ * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_internal_file_get_size(
+     libcfile_internal_file_t *internal_file,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	DISK_GEOMETRY disk_geometry;
+	GET_LENGTH_INFORMATION length_information;
+
+	static char *function            = "libcfile_internal_file_get_size";
+	LARGE_INTEGER large_integer_size = LIBCFILE_LARGE_INTEGER_ZERO;
+	size_t read_count                = 0;
+	uint32_t error_code              = 0;
+	int result                       = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	result = libcfile_file_is_device(
+	          (libcfile_file_t *) internal_file,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if file is a device.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+#if defined( LIBCFILE_HAVE_IO_CONTROL )
+		read_count = libcfile_internal_file_io_control_read_with_error_code(
+		              internal_file,
+		              IOCTL_DISK_GET_LENGTH_INFO,
+		              NULL,
+		              0,
+		              (uint8_t *) &length_information,
+		              sizeof( GET_LENGTH_INFORMATION ),
+		              &error_code,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+			 "%s: unable to query device for: IOCTL_DISK_GET_LENGTH_INFO.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+
+			if( error_code == ERROR_NOT_SUPPORTED )
+			{
+				/* A floppy device does not support IOCTL_DISK_GET_LENGTH_INFO
+				 */
+				read_count = libcfile_internal_file_io_control_read_with_error_code(
+				              internal_file,
+				              IOCTL_DISK_GET_DRIVE_GEOMETRY,
+				              NULL,
+				              0,
+				              (uint8_t *) &disk_geometry,
+				              sizeof( DISK_GEOMETRY ),
+				              &error_code,
+				              error );
+
+				if( read_count == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+					 "%s: unable to query device for: IOCTL_DISK_GET_DRIVE_GEOMETRY.",
+					 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+					if( libcnotify_verbose != 0 )
+					{
+						if( ( error != NULL )
+						 && ( *error != NULL ) )
+						{
+							libcnotify_print_error_backtrace(
+							 *error );
+						}
+					}
+#endif
+					libcerror_error_free(
+					 error );
+				}
+				else
+				{
+					*size  = disk_geometry.Cylinders.QuadPart;
+					*size *= disk_geometry.TracksPerCylinder;
+					*size *= disk_geometry.SectorsPerTrack;
+					*size *= disk_geometry.BytesPerSector;
+				}
+			}
+		}
+		else
+		{
+			*size  = (size64_t) length_information.Length.HighPart << 32;
+			*size += (uint32_t) length_information.Length.LowPart;
+		}
+#else
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of device.",
+		 function );
+
+		return( -1 );
+
+#endif /* defined( LIBCFILE_HAVE_IO_CONTROL ) */
+	}
+	else
+	{
+#if ( WINVER <= 0x0500 )
+		if( libcfile_GetFileSizeEx(
+		     internal_file->handle,
+		     &large_integer_size ) == 0 )
+#else
+		if( GetFileSizeEx(
+		     internal_file->handle,
+		     &large_integer_size ) == 0 )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file size.",
+			 function );
+
+			return( -1 );
+		}
+#if defined( __BORLANDC__ ) && __BORLANDC__ <= 0x520
+		*size = (size64_t) large_integer_size.QuadPart;
+#else
+		*size  = (size64_t) large_integer_size.HighPart << 32;
+		*size += (uint32_t) large_integer_size.LowPart;
+#endif
+	}
+	return( 1 );
+}
+
+#elif defined( HAVE_FSTAT )
+
+/* Retrieves the size of the file
+ * This function uses the POSIX fstat function or equivalent
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_internal_file_get_size(
+     libcfile_internal_file_t *internal_file,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	struct stat file_statistics;
+
+	static char *function     = "libcfile_internal_file_get_size";
+	size64_t safe_size        = 0;
+	ssize_t read_count        = 0;
+	off64_t current_offset    = 0;
+	off64_t offset            = 0;
+
+#if defined( BLKGETSIZE64 ) || defined( DIOCGMEDIASIZE ) || defined( DIOCGDINFO ) || ( defined( DKIOCGETBLOCKCOUNT ) && defined( DKIOCGETBLOCKSIZE ) )
+	uint32_t error_code       = 0;
+#endif
+
+#if !defined( DIOCGMEDIASIZE ) && defined( DIOCGDINFO )
+	struct disklabel disk_label;
+#endif
+#if defined( DKIOCGETBLOCKCOUNT ) && defined( DKIOCGETBLOCKSIZE )
+	uint64_t block_count      = 0;
+	uint32_t bytes_per_sector = 0;
+#endif
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &file_statistics,
+	     0,
+	     sizeof( struct stat ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( fstat(
+	     internal_file->descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( S_ISBLK( file_statistics.st_mode )
+	 || S_ISCHR( file_statistics.st_mode ) )
+	{
+#if defined( LIBCFILE_HAVE_IO_CONTROL )
+#if defined( BLKGETSIZE64 )
+		read_count = libcfile_internal_file_io_control_read_with_error_code(
+		              internal_file,
+		              (uint32_t) BLKGETSIZE64,
+		              NULL,
+		              0,
+		              (uint8_t *) &safe_size,
+		              8,
+		              &error_code,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+			 "%s: unable to query device for: BLKGETSIZE64.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+#elif defined( DIOCGMEDIASIZE )
+		read_count = libcfile_internal_file_io_control_read_with_error_code(
+		              internal_file,
+		              (uint32_t) DIOCGMEDIASIZE,
+		              NULL,
+		              0,
+		              (uint8_t *) &safe_size,
+		              8,
+		              &error_code,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+			 "%s: unable to query device for: DIOCGMEDIASIZE.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+#elif defined( DIOCGDINFO )
+		read_count = libcfile_internal_file_io_control_read_with_error_code(
+		              internal_file,
+		              (uint32_t) DIOCGDINFO,
+		              NULL,
+		              0,
+		              (uint8_t *) &disk_label,
+		              sizeof( struct disklabel ),
+		              &error_code,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+			 "%s: unable to query device for: DIOCGDINFO.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+		else
+		{
+			safe_size = disk_label.d_secperunit * disk_label.d_secsize;
+		}
+#elif defined( DKIOCGETBLOCKCOUNT ) && defined( DKIOCGETBLOCKSIZE )
+		read_count = libcfile_internal_file_io_control_read_with_error_code(
+		              internal_file,
+		              (uint32_t) DKIOCGETBLOCKSIZE,
+		              NULL,
+		              0,
+		              (uint8_t *) &bytes_per_sector,
+		              4,
+		              &error_code,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+			 "%s: unable to query device for: DKIOCGETBLOCKSIZE.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+		else
+		{
+			read_count = libcfile_internal_file_io_control_read_with_error_code(
+			              internal_file,
+			              (uint32_t) DKIOCGETBLOCKCOUNT,
+			              NULL,
+			              0,
+			              (uint8_t *) &block_count,
+			              4,
+			              &error_code,
+			              error );
+
+			if( read_count == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+				 "%s: unable to query device for: DKIOCGETBLOCKCOUNT.",
+				 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					if( ( error != NULL )
+					 && ( *error != NULL ) )
+					{
+						libcnotify_print_error_backtrace(
+						 *error );
+					}
+				}
+#endif
+				libcerror_error_free(
+				 error );
+			}
+			else
+			{
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: block size: %" PRIu32 " block count: %" PRIu64 " ",
+					 function,
+					 bytes_per_sector,
+					 block_count );
+				}
+#endif
+				safe_size = (size64_t) ( block_count * bytes_per_sector );
+			}
+		}
+#endif
+#endif /* defined( LIBCFILE_HAVE_IO_CONTROL ) */
+
+		if( read_count <= 0 )
+		{
+			/* Try to seek the end of the file and determine the size based on the offset
+			 */
+			if( libcfile_file_get_offset(
+			     (libcfile_file_t *) internal_file,
+			     &current_offset,
+			     error ) != 1  )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve current offset.",
+				 function );
+
+				return( -1 );
+			}
+			offset = libcfile_file_seek_offset(
+			          (libcfile_file_t *) internal_file,
+				  0,
+				  SEEK_END,
+				  error );
+
+			if( offset == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_SEEK_FAILED,
+				 "%s: unable to seek end of file.",
+				 function );
+
+				return( -1 );
+			}
+			safe_size = (size64_t) offset;
+
+			offset = libcfile_file_seek_offset(
+			          (libcfile_file_t *) internal_file,
+				  current_offset,
+				  SEEK_SET,
+				  error );
+
+			if( offset == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_SEEK_FAILED,
+				 "%s: unable to seek offset: %" PRIi64 ".",
+				 function,
+				 current_offset );
+
+				return( -1 );
+			}
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: device media size: %" PRIu64 "\n",
+			 function,
+			 safe_size );
+		}
+#endif
+	}
+	else
+	{
+		safe_size = (size64_t) file_statistics.st_size;
+	}
+	*size = safe_size;
+
+	return( 1 );
+}
+
+#else
+#error Missing file get size function
+#endif
+
+/* Retrieves the size of the file
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_file_get_size(
+     libcfile_file_t *file,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_get_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	*size = libcfile_internal_file_load_size(
+	         internal_file );
+
+	return( 1 );
+}
+
+#if defined( WINAPI )
+
+/* Determines if a file is a device
+ * This function uses the WINAPI function for Windows XP (0x0501) or later
+ * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
+ * Returns 1 if true, 0 if not or -1 on error
+ */
+int libcfile_file_is_device(
+     libcfile_file_t *file,
+     libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_is_device";
+	DWORD file_type                         = 0;
+	int result                              = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing handle.",
+		 function );
+
+		return( -1 );
+	}
+/* TODO what about FILE_ATTRIBUTE_DEVICE using GetFileAttributes() */
+
+	/* Use the GetFileType function to rule out certain file types
+	 * like pipes, sockets, etc.
+	 */
+#if ( WINVER <= 0x0500 )
+	file_type = libcfile_GetFileType(
+	             internal_file->handle );
+#else
+	file_type = GetFileType(
+	             internal_file->handle );
+#endif
+
+	if( file_type == FILE_TYPE_UNKNOWN )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine file type.",
+		 function );
+
+		return( -1 );
+	}
+	else if( file_type == FILE_TYPE_DISK )
+	{
+		if( internal_file->is_device_filename )
+		{
+			result = 1;
+		}
+	}
+	return( result );
+}
+
+#elif defined( HAVE_FSTAT )
+
+/* Determines if a file is a device
+ * This function uses the POSIX fstat function or equivalent
+ * Returns 1 if true, 0 if not or -1 on error
+ */
+int libcfile_file_is_device(
+     libcfile_file_t *file,
+     libcerror_error_t **error )
+{
+	struct stat file_statistics;
+
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_is_device";
+	int result                              = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+	if( internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &file_statistics,
+	     0,
+	     sizeof( struct stat ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( fstat(
+	     internal_file->descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( S_ISBLK( file_statistics.st_mode )
+	 || S_ISCHR( file_statistics.st_mode ) )
+	{
+		result = 1;
+	}
+	return( result );
+}
+
+#else
+#error Missing file is device function
+#endif
+
+/* Read data from a device file using IO control
+ * This function uses the POSIX ioctl function or WINAPI DeviceIoControl
+ * Returns the number of bytes read if successful or -1 on error
+ */
+ssize_t libcfile_internal_file_io_control_read_with_error_code(
+         libcfile_internal_file_t *internal_file,
+         uint32_t control_code,
+         uint8_t *control_data,
+         size_t control_data_size,
+         uint8_t *data,
+         size_t data_size,
+         uint32_t *error_code,
+         libcerror_error_t **error )
+{
+	static char *function = "libcfile_internal_file_io_control_read_with_error_code";
+
+#if defined( WINAPI )
+	BOOL result           = 0;
+	DWORD response_count  = 0;
+#elif defined( HAVE_IOCTL )
+	int result            = 0;
+#endif
+
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	uint64_t start_timestamp = 0;
+#endif
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing handle.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( control_data == NULL )
+	{
+		if( control_data_size != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid control data size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+#if ( UINT32_MAX < SSIZE_MAX )
+		if( control_data_size > (size_t) UINT32_MAX )
+#else
+		if( control_data_size > (size_t) SSIZE_MAX )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid control data size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( data == NULL )
+	{
+		if( data_size != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid data size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+#if ( UINT32_MAX < SSIZE_MAX )
+		if( data_size > (size_t) UINT32_MAX )
+#else
+		if( data_size > (size_t) SSIZE_MAX )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid data size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( error_code == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	start_timestamp = libcfile_statistics_get_timestamp();
+#endif
+	result = DeviceIoControl(
+	          internal_file->handle,
+	          (DWORD) control_code,
+	          control_data,
+	          (DWORD) control_data_size,
+	          data,
+	          (DWORD) data_size,
+	          &response_count,
+	          NULL );
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	libcfile_statistics_add_operation(
+	 &( internal_file->statistics ),
+	 LIBCFILE_OPERATION_TYPE_IO_CONTROL,
+	 ( result != FALSE ) ? (ssize_t) response_count : -1,
+	 start_timestamp );
+#endif
+
+	if( result == FALSE )
+	{
+		*error_code = (uint32_t) GetLastError();
+
+		/* TODO: handle if( *error_code == ERROR_MORE_DATA ) */
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+		 *error_code,
+		 "%s: unable to IO control device.",
+		 function );
+
+		return( -1 );
+	}
+#if ( SSIZE_MAX < UINT32_MAX )
+	if( response_count > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid response count value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( (ssize_t) response_count );
+
+#elif defined( HAVE_IOCTL )
+	if( control_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported control data.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	start_timestamp = libcfile_statistics_get_timestamp();
+#endif
+	result = ioctl(
+	          internal_file->descriptor,
+	          (int) control_code,
+	          data );
+
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	libcfile_statistics_add_operation(
+	 &( internal_file->statistics ),
+	 LIBCFILE_OPERATION_TYPE_IO_CONTROL,
+	 ( result == -1 ) ? -1 : (ssize_t) data_size,
+	 start_timestamp );
+#endif
+	if( result == -1 )
+	{
+		*error_code = (uint32_t) errno;
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+		 *error_code,
+		 "%s: unable to IO control device.",
+		 function );
+
+		return( -1 );
+	}
+	return( (size_t) data_size );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+	 "%s: missing IO control support.",
+	 function );
+
+	return( -1 );
+
+#endif /* defined( HAVE_IOCTL ) || defined( WINAPI ) */
+}
+
+/* Read data from a device file using IO control
+ * Returns the number of bytes read if successful or -1 on error
+ */
+ssize_t libcfile_file_io_control_read(
+         libcfile_file_t *file,
+         uint32_t control_code,
+         uint8_t *control_data,
+         size_t control_data_size,
+         uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_io_control_read";
+	ssize_t read_count                      = 0;
+	uint32_t error_code                     = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+	read_count = libcfile_internal_file_io_control_read_with_error_code(
+	              internal_file,
+	              control_code,
+	              control_data,
+	              control_data_size,
+	              data,
+	              data_size,
+	              &error_code,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+		 "%s: unable to to IO control device.",
+		 function );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Read data from a device file using IO control
+ * Returns the number of bytes read if successful or -1 on error
+ */
+ssize_t libcfile_file_io_control_read_with_error_code(
+         libcfile_file_t *file,
+         uint32_t control_code,
+         uint8_t *control_data,
+         size_t control_data_size,
+         uint8_t *data,
+         size_t data_size,
+         uint32_t *error_code,
+         libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_io_control_read_with_error_code";
+	ssize_t read_count                      = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+	read_count = libcfile_internal_file_io_control_read_with_error_code(
+	              internal_file,
+	              control_code,
+	              control_data,
+	              control_data_size,
+	              data,
+	              data_size,
+	              error_code,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+		 "%s: unable to to IO control device.",
+		 function );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* On some versions of Linux the FADVISE definions seem to be missing from fcntl.h
+ */
+#if defined( HAVE_POSIX_FADVISE ) && !defined( WINAPI )
+
+#if !defined( POSIX_FADV_NORMAL )
+#define POSIX_FADV_NORMAL		0
+#endif
+
+#if !defined( POSIX_FADV_RANDOM )
+#define POSIX_FADV_RANDOM		1
+#endif
+
+#if !defined( POSIX_FADV_SEQUENTIAL )
+#define POSIX_FADV_SEQUENTIAL		2
+#endif
+
+#if !defined( POSIX_FADV_WILLNEED )
+#define POSIX_FADV_WILLNEED		3
+#endif
+
+#endif /* #if defined( HAVE_POSIX_FADVISE ) && !defined( WINAPI ) */
+
+/* Sets the expected access behavior so the system can optimize the access
+ * In streaming access behavior data read with the current offset is removed
+ * from the page cache once the current offset has passed it
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_file_set_access_behavior(
+     libcfile_file_t *file,
+     int access_behavior,
+     libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_set_access_behavior";
+
+#if defined( HAVE_POSIX_FADVISE ) && !defined( WINAPI )
+	off64_t advice_offset                   = 0;
+	int advice                              = POSIX_FADV_NORMAL;
+	int result                              = 0;
+#endif
+
+#if defined( LIBCFILE_HAVE_MEMORY_MAP ) && defined( HAVE_MADVISE )
+	int memory_advice                       = MADV_NORMAL;
+#endif
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+#if defined( WINAPI )
+	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing handle.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( access_behavior != LIBCFILE_ACCESS_BEHAVIOR_NORMAL )
+	 && ( access_behavior != LIBCFILE_ACCESS_BEHAVIOR_RANDOM )
+	 && ( access_behavior != LIBCFILE_ACCESS_BEHAVIOR_SEQUENTIAL )
+	 && ( access_behavior != LIBCFILE_ACCESS_BEHAVIOR_STREAMING ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access behavior: %d.",
+		 function,
+		 access_behavior );
+
+		return( -1 );
+	}
+#if defined( HAVE_POSIX_FADVISE ) && !defined( WINAPI )
+	if( access_behavior == LIBCFILE_ACCESS_BEHAVIOR_NORMAL )
+	{
+		advice = POSIX_FADV_NORMAL;
+	}
+	else if( access_behavior == LIBCFILE_ACCESS_BEHAVIOR_RANDOM )
+	{
+		advice = POSIX_FADV_RANDOM;
+	}
+	else if( ( access_behavior == LIBCFILE_ACCESS_BEHAVIOR_SEQUENTIAL )
+	      || ( access_behavior == LIBCFILE_ACCESS_BEHAVIOR_STREAMING ) )
+	{
+		advice = POSIX_FADV_SEQUENTIAL;
+	}
+	/* Remove the data that was read in streaming access behavior
+	 * and not yet removed from the page cache
+	 */
+	if( ( internal_file->access_behavior == LIBCFILE_ACCESS_BEHAVIOR_STREAMING )
+	 && ( internal_file->streaming_end_offset > internal_file->streaming_offset ) )
+	{
+		posix_fadvise(
+		 internal_file->descriptor,
+		 (off_t) internal_file->streaming_offset,
+		 (off_t) ( internal_file->streaming_end_offset - internal_file->streaming_offset ),
+		 POSIX_FADV_DONTNEED );
+	}
+	/* In streaming access behavior the advice only applies to the data
+	 * from the current offset onwards
+	 */
+	if( access_behavior == LIBCFILE_ACCESS_BEHAVIOR_STREAMING )
+	{
+		advice_offset = internal_file->current_offset;
+	}
+	result = posix_fadvise(
+	          internal_file->descriptor,
+	          (off_t) advice_offset,
+	          0,
+	          advice );
+
+	/* Safely ignore if the device does not support fadvise.
+	 * Note that FreeBSD 10.0 had a bug and was returning -1
+	 * and setting errno.
+	 */
+	if( ( result != 0 )
+	 && ( result != ENODEV ) )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 errno,
+		 "%s: unable to advice file descriptor on access behavior.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_POSIX_FADVISE ) && !defined( WINAPI ) */
+
+#if defined( LIBCFILE_HAVE_MEMORY_MAP ) && defined( HAVE_MADVISE )
+	if( internal_file->mapped_data != NULL )
+	{
+		if( access_behavior == LIBCFILE_ACCESS_BEHAVIOR_NORMAL )
+		{
+			memory_advice = MADV_NORMAL;
+		}
+		else if( access_behavior == LIBCFILE_ACCESS_BEHAVIOR_RANDOM )
+		{
+			memory_advice = MADV_RANDOM;
+		}
+		else if( ( access_behavior == LIBCFILE_ACCESS_BEHAVIOR_SEQUENTIAL )
+		      || ( access_behavior == LIBCFILE_ACCESS_BEHAVIOR_STREAMING ) )
+		{
+			memory_advice = MADV_SEQUENTIAL;
+		}
+		if( madvise(
+		     (void *) internal_file->mapped_data,
+		     internal_file->mapped_data_size,
+		     memory_advice ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 errno,
+			 "%s: unable to advice mapped data on access behavior.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif /* defined( LIBCFILE_HAVE_MEMORY_MAP ) && defined( HAVE_MADVISE ) */
+
+	internal_file->access_behavior      = access_behavior;
+	internal_file->streaming_offset     = internal_file->current_offset;
+	internal_file->streaming_end_offset = internal_file->current_offset;
+
+	return( 1 );
+}
+
+#if defined( HAVE_POSIX_FADVISE ) && !defined( WINAPI )
+
+/* Prefetches the data ahead of a read if the read follows a sequential or strided stream
+ * The prefetch is asynchronous, the system reads the data in the background
+ * Returns 1 if data was prefetched, 0 if not or -1 on error
+ */
+int libcfile_internal_file_readahead(
+     libcfile_internal_file_t *internal_file,
+     off64_t offset,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_internal_file_readahead";
+	size64_t range_size   = 0;
+	size64_t file_size    = 0;
+	off64_t range_offset  = 0;
+	int result            = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	/* Direct access bypasses the page cache the data would be prefetched into
+	 */
+	if( ( internal_file->access_flags & LIBCFILE_ACCESS_FLAG_DIRECT ) != 0 )
+	{
+		return( 0 );
+	}
+	result = libcfile_readahead_update(
+	          internal_file->readahead,
+	          offset,
+	          size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update readahead.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	while( result == 1 )
+	{
+		result = libcfile_readahead_get_range(
+		          internal_file->readahead,
+		          &range_offset,
+		          &range_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve readahead range.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 1 );
+		}
+		file_size = libcfile_internal_file_load_size(
+		             internal_file );
+
+		if( (size64_t) range_offset >= file_size )
+		{
+			break;
+		}
+		if( range_size > ( file_size - (size64_t) range_offset ) )
+		{
+			range_size = file_size - (size64_t) range_offset;
+		}
+		/* The advice is only a hint, a failure does not affect the read
+		 */
+		posix_fadvise(
+		 internal_file->descriptor,
+		 range_offset,
+		 (off64_t) range_size,
+		 POSIX_FADV_WILLNEED );
+	}
+	return( 1 );
+}
+
+/* Removes the data that was read in streaming access behavior from the page cache
+ * The data read before a read at offset is removed once at least the streaming drop size
+ * of data was read or when the read does not continue the previous read
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_internal_file_drop_read_data(
+     libcfile_internal_file_t *internal_file,
+     off64_t offset,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_internal_file_drop_read_data";
+	size64_t read_size    = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->streaming_end_offset > internal_file->streaming_offset )
+	{
+		read_size = (size64_t) ( internal_file->streaming_end_offset - internal_file->streaming_offset );
+	}
+	/* Only the data that was read is removed, data skipped by a seek
+	 * could be cached on behalf of another reader
+	 */
+	if( ( read_size > 0 )
+	 && ( ( offset != internal_file->streaming_end_offset )
+	  || ( read_size >= (size64_t) LIBCFILE_STREAMING_DROP_SIZE ) ) )
+	{
+		/* The advice is only a hint, a failure does not affect the read
+		 */
+		posix_fadvise(
+		 internal_file->descriptor,
+		 (off_t) internal_file->streaming_offset,
+		 (off_t) read_size,
+		 POSIX_FADV_DONTNEED );
+
+		internal_file->streaming_offset = offset;
+	}
+	else if( read_size == 0 )
+	{
+		internal_file->streaming_offset = offset;
+	}
+	internal_file->streaming_end_offset = offset + (off64_t) size;
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_POSIX_FADVISE ) && !defined( WINAPI ) */
+
+/* Sets the maximum size of the data that is prefetched ahead of sequential or strided reads
+ * A maximum size of 0 disables the readahead
+ * The readahead has no effect on systems that do not support prefetch advice
+ * or with direct access
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_file_set_readahead_size(
+     libcfile_file_t *file,
+     size_t maximum_size,
+     libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_set_readahead_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+	if( maximum_size > (size_t) LIBCFILE_MAXIMUM_READAHEAD_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->readahead != NULL )
+	{
+		if( libcfile_readahead_free(
+		     &( internal_file->readahead ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free readahead.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( maximum_size != 0 )
+	{
+		if( libcfile_readahead_initialize(
+		     &( internal_file->readahead ),
+		     maximum_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create readahead.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Prefetches ranges of data the caller expects to read
+ * The prefetch is asynchronous, the system reads the data in the background
+ * so that the reads of multiple ranges can be pipelined
+ * Consecutive ranges that overlap or are adjacent are prefetched as one range
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libcfile_file_prefetch(
+     libcfile_file_t *file,
+     const off64_t *range_offsets,
+     const size64_t *range_sizes,
+     int number_of_ranges,
+     libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_prefetch";
+	int range_index                         = 0;
+
+#if defined( HAVE_POSIX_FADVISE ) && !defined( WINAPI )
+	size64_t file_size                      = 0;
+	size64_t prefetch_size                  = 0;
+	size64_t range_size                     = 0;
+	off64_t prefetch_offset                 = 0;
+	off64_t range_offset                    = 0;
+	int result                              = 0;
+#endif
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+#if defined( WINAPI )
+	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing handle.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( number_of_ranges < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of ranges value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_ranges == 0 )
+	{
+		return( 1 );
+	}
+	if( range_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range sizes.",
+		 function );
+
+		return( -1 );
+	}
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		if( range_offsets[ range_index ] < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid range: %d offset value out of bounds.",
+			 function,
+			 range_index );
+
+			return( -1 );
+		}
+		if( range_sizes[ range_index ] > (size64_t) INT64_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid range: %d size value exceeds maximum.",
+			 function,
+			 range_index );
+
+			return( -1 );
+		}
+	}
+#if defined( HAVE_POSIX_FADVISE ) && !defined( WINAPI )
+	/* Direct access bypasses the page cache the data would be prefetched into
+	 */
+	if( ( internal_file->access_flags & LIBCFILE_ACCESS_FLAG_DIRECT ) != 0 )
+	{
+		return( 0 );
+	}
+	file_size = libcfile_internal_file_load_size(
+	             internal_file );
+
+	for( range_index = 0;
+	     range_index <= number_of_ranges;
+	     range_index++ )
+	{
+		if( range_index < number_of_ranges )
+		{
+			range_offset = range_offsets[ range_index ];
+			range_size   = range_sizes[ range_index ];
+
+			if( (size64_t) range_offset >= file_size )
+			{
+				continue;
+			}
+			if( range_size > ( file_size - (size64_t) range_offset ) )
+			{
+				range_size = file_size - (size64_t) range_offset;
+			}
+			if( range_size == 0 )
+			{
+				continue;
+			}
+			/* Merge a range that overlaps or is adjacent to the pending prefetch
+			 */
+			if( ( prefetch_size > 0 )
+			 && ( range_offset >= prefetch_offset )
+			 && ( (size64_t) ( range_offset - prefetch_offset ) <= prefetch_size ) )
+			{
+				if( ( (size64_t) ( range_offset - prefetch_offset ) + range_size ) > prefetch_size )
+				{
+					prefetch_size = (size64_t) ( range_offset - prefetch_offset ) + range_size;
+				}
+				continue;
+			}
+		}
+		if( prefetch_size > 0 )
+		{
+			result = posix_fadvise(
+			          internal_file->descriptor,
+			          (off_t) prefetch_offset,
+			          (off_t) prefetch_size,
+			          POSIX_FADV_WILLNEED );
+
+			/* Safely ignore if the device or a pipe does not support fadvise
+			 */
+			if( ( result == ENODEV )
+			 || ( result == ESPIPE ) )
+			{
+				return( 0 );
+			}
+			else if( result != 0 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_GENERIC,
+				 result,
+				 "%s: unable to prefetch range at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 prefetch_offset,
+				 prefetch_offset );
+
+				return( -1 );
+			}
+		}
+		if( range_index < number_of_ranges )
+		{
+			prefetch_offset = range_offset;
+			prefetch_size   = range_size;
+		}
+	}
+	return( 1 );
+#else
+	return( 0 );
+#endif /* defined( HAVE_POSIX_FADVISE ) && !defined( WINAPI ) */
+}
+
+/* Retrieves the page cache residency of a range of the file
+ * The bitmap contains a bit per page, starting with the page that contains the offset,
+ * where the least significant bit of the first byte represents the first page
+ * A bit is set if the page is in the page cache, pages beyond the end of the file are not
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libcfile_file_get_cache_residency(
+     libcfile_file_t *file,
+     off64_t offset,
+     size64_t size,
+     uint8_t *bitmap,
+     size_t bitmap_size,
+     size_t *page_size,
+     libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_get_cache_residency";
+	size64_t number_of_pages                = 0;
+	size_t system_page_size                 = 4096;
+	off64_t range_offset                    = 0;
+
+#if defined( LIBCFILE_HAVE_MINCORE )
+	uint8_t residency_vector[ LIBCFILE_CACHE_RESIDENCY_VECTOR_SIZE ];
+
+	uint8_t *mapped_data                    = NULL;
+	size64_t file_size                      = 0;
+	size64_t page_index                     = 0;
+	size64_t range_size                     = 0;
+	size_t mapped_size                      = 0;
+	size_t vector_index                     = 0;
+	off64_t mapped_offset                   = 0;
+	long sysconf_result                     = 0;
+
+#if defined( LIBCFILE_SYSCALL_CACHESTAT )
+	libcfile_cachestat_range_t cachestat_range;
+	libcfile_cachestat_t cachestat;
+#endif
+#endif /* defined( LIBCFILE_HAVE_MINCORE ) */
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+#if defined( WINAPI )
+	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing handle.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) ( INT64_MAX - offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCFILE_HAVE_MINCORE ) && defined( _SC_PAGESIZE )
+	sysconf_result = sysconf(
+	                  _SC_PAGESIZE );
+
+	if( sysconf_result > 0 )
+	{
+		system_page_size = (size_t) sysconf_result;
+	}
+#endif
+	range_offset    = offset - ( offset % system_page_size );
+	number_of_pages = ( (size64_t) ( offset - range_offset ) + size + system_page_size - 1 ) / system_page_size;
+
+	if( ( ( number_of_pages + 7 ) / 8 ) > (size64_t) bitmap_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid bitmap size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	*page_size = system_page_size;
+
+#if !defined( LIBCFILE_HAVE_MINCORE )
+	return( 0 );
+#else
+	if( memory_set(
+	     bitmap,
+	     0,
+	     (size_t) ( ( number_of_pages + 7 ) / 8 ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	file_size = libcfile_internal_file_load_size(
+	             internal_file );
+
+	if( (size64_t) range_offset >= file_size )
+	{
+		return( 1 );
+	}
+	/* Only the pages up to the end of the file can be in the page cache
+	 */
+	range_size = number_of_pages * system_page_size;
+
+	if( range_size > ( file_size - (size64_t) range_offset ) )
+	{
+		range_size      = file_size - (size64_t) range_offset;
+		number_of_pages = ( range_size + system_page_size - 1 ) / system_page_size;
+	}
+#if defined( LIBCFILE_SYSCALL_CACHESTAT )
+	/* The cachestat system call only provides the number of cached pages, which
+	 * suffices if either all or none of the pages of the range are cached
+	 */
+	cachestat_range.offset = (uint64_t) range_offset;
+	cachestat_range.size   = (uint64_t) range_size;
+
+	if( syscall(
+	     LIBCFILE_SYSCALL_CACHESTAT,
+	     internal_file->descriptor,
+	     &cachestat_range,
+	     &cachestat,
+	     0 ) == 0 )
+	{
+		if( cachestat.number_of_cached_pages == 0 )
+		{
+			return( 1 );
+		}
+		if( cachestat.number_of_cached_pages >= number_of_pages )
+		{
+			for( page_index = 0;
+			     page_index < number_of_pages;
+			     page_index++ )
+			{
+				bitmap[ page_index / 8 ] |= (uint8_t) ( 1 << ( page_index % 8 ) );
+			}
+			return( 1 );
+		}
+	}
+#endif /* defined( LIBCFILE_SYSCALL_CACHESTAT ) */
+
+	page_index = 0;
+
+	while( page_index < number_of_pages )
+	{
+		mapped_offset = range_offset + (off64_t) ( page_index * system_page_size );
+		mapped_size   = LIBCFILE_CACHE_RESIDENCY_VECTOR_SIZE * system_page_size;
+
+		if( (size64_t) mapped_size > ( (size64_t) range_size - ( page_index * system_page_size ) ) )
+		{
+			mapped_size = (size_t) ( (size64_t) range_size - ( page_index * system_page_size ) );
+		}
+		/* The memory mapped data is aligned to the page size
+		 */
+		if( internal_file->mapped_data != NULL )
+		{
+			mapped_data = &( internal_file->mapped_data[ mapped_offset ] );
+		}
+		else
+		{
+			mapped_data = (uint8_t *) mmap(
+			                           NULL,
+			                           mapped_size,
+			                           PROT_READ,
+			                           MAP_SHARED,
+			                           internal_file->descriptor,
+			                           (off_t) mapped_offset );
+
+			if( mapped_data == (uint8_t *) MAP_FAILED )
+			{
+				/* Files opened without read access and devices cannot be mapped
+				 */
+				if( ( errno == EACCES )
+				 || ( errno == ENODEV )
+				 || ( errno == EINVAL ) )
+				{
+					return( 0 );
+				}
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_GENERIC,
+				 errno,
+				 "%s: unable to map range at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 mapped_offset,
+				 mapped_offset );
+
+				return( -1 );
+			}
+		}
+		if( mincore(
+		     (void *) mapped_data,
+		     mapped_size,
+		     (void *) residency_vector ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 errno,
+			 "%s: unable to determine page cache residency at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 mapped_offset,
+			 mapped_offset );
+
+			if( internal_file->mapped_data == NULL )
+			{
+				munmap(
+				 (void *) mapped_data,
+				 mapped_size );
+			}
+			return( -1 );
+		}
+		if( internal_file->mapped_data == NULL )
+		{
+			if( munmap(
+			     (void *) mapped_data,
+			     mapped_size ) != 0 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_GENERIC,
+				 errno,
+				 "%s: unable to unmap range at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 mapped_offset,
+				 mapped_offset );
+
+				return( -1 );
+			}
+		}
+		for( vector_index = 0;
+		     vector_index < ( ( mapped_size + system_page_size - 1 ) / system_page_size );
+		     vector_index++ )
+		{
+			if( ( residency_vector[ vector_index ] & 0x01 ) != 0 )
+			{
+				bitmap[ page_index / 8 ] |= (uint8_t) ( 1 << ( page_index % 8 ) );
+			}
+			page_index++;
+		}
+	}
+	return( 1 );
+
+#endif /* !defined( LIBCFILE_HAVE_MINCORE ) */
+}
+
+/* Reads a buffer from the file at a specific offset without waiting for storage
+ * Only data that is in the page cache is read, which can result in a read count
+ * smaller than the size or 0 if the data at the offset is not cached
+ * 0 is also returned if the page cache residency cannot be determined
+ * This function does not change the current offset of the file
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libcfile_file_read_cached_buffer_at_offset(
+         libcfile_file_t *file,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	uint8_t bitmap[ LIBCFILE_CACHE_RESIDENCY_BITMAP_SIZE ];
+
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_read_cached_buffer_at_offset";
+	size_t cached_size                      = 0;
+	size_t page_index                       = 0;
+	size_t page_size                        = 0;
+	size_t read_size                        = 0;
+	size64_t file_size                      = 0;
+	ssize_t read_count                      = 0;
+	uint32_t error_code                     = 0;
+	int result                              = 0;
+
+#if defined( LIBCFILE_HAVE_READ_NOWAIT )
+	struct iovec io_vector;
+
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	uint64_t start_timestamp                = 0;
+#endif
+#endif
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+#if defined( WINAPI )
+	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing handle.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Direct access bypasses the page cache
+	 */
+	if( ( internal_file->access_flags & LIBCFILE_ACCESS_FLAG_DIRECT ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid file - cached reads not supported with direct access.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->write_buffer_data_size > 0 )
+	{
+		if( libcfile_internal_file_flush_write_buffer(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	file_size = libcfile_internal_file_load_size(
+	             internal_file );
+
+	if( ( size == 0 )
+	 || ( (size64_t) offset >= file_size ) )
+	{
+		return( 0 );
+	}
+	if( ( (size64_t) offset + size ) > file_size )
+	{
+		size = (size_t) ( file_size - offset );
+	}
+#if defined( LIBCFILE_HAVE_READ_NOWAIT )
+	if( internal_file->mapped_data == NULL )
+	{
+		io_vector.iov_base = (void *) buffer;
+		io_vector.iov_len  = size;
+
+#if defined( HAVE_LIBCFILE_STATISTICS )
+		start_timestamp = libcfile_statistics_get_timestamp();
+#endif
+		read_count = preadv2(
+		              internal_file->descriptor,
+		              &io_vector,
+		              1,
+		              (off_t) offset,
+		              RWF_NOWAIT );
+
+#if defined( HAVE_LIBCFILE_STATISTICS )
+		libcfile_statistics_add_operation(
+		 &( internal_file->statistics ),
+		 LIBCFILE_OPERATION_TYPE_READ,
+		 read_count,
+		 start_timestamp );
+#endif
+		if( read_count >= 0 )
+		{
+			return( read_count );
+		}
+		if( errno == EAGAIN )
+		{
+			return( 0 );
+		}
+		/* Fall back to the page cache residency if the kernel or file system
+		 * does not support non-blocking reads
+		 */
+		if( ( errno != EOPNOTSUPP )
+		 && ( errno != ENOSYS )
+		 && ( errno != EINVAL ) )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 errno,
+			 "%s: unable to read from file.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif /* defined( LIBCFILE_HAVE_READ_NOWAIT ) */
+
+	/* Read the leading pages that are in the page cache, which is limited
+	 * to the number of pages that fit in the residency bitmap, where an
+	 * unaligned offset requires an additional page
+	 */
+	read_size = size;
+
+	if( read_size > LIBCFILE_MAXIMUM_CACHED_READ_SIZE )
+	{
+		read_size = LIBCFILE_MAXIMUM_CACHED_READ_SIZE;
+	}
+	if( memory_set(
+	     bitmap,
+	     0,
+	     LIBCFILE_CACHE_RESIDENCY_BITMAP_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	result = libcfile_file_get_cache_residency(
+	          file,
+	          offset,
+	          (size64_t) read_size,
+	          bitmap,
+	          LIBCFILE_CACHE_RESIDENCY_BITMAP_SIZE,
+	          &page_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page cache residency.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	while( ( page_index * page_size ) < ( (size_t) ( offset % page_size ) + read_size ) )
+	{
+		if( ( bitmap[ page_index / 8 ] & ( 1 << ( page_index % 8 ) ) ) == 0 )
+		{
+			break;
+		}
+		page_index++;
+	}
+	cached_size = page_index * page_size;
+
+	if( cached_size <= (size_t) ( offset % page_size ) )
+	{
+		return( 0 );
+	}
+	cached_size -= (size_t) ( offset % page_size );
+
+	if( cached_size > read_size )
+	{
+		cached_size = read_size;
+	}
+	read_count = libcfile_internal_file_read_buffer_at_offset_with_error_code(
+	              internal_file,
+	              offset,
+	              buffer,
+	              cached_size,
+	              &error_code,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 error_code,
+		 "%s: unable to read from file.",
+		 function );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Determines the block size
+ * Returns the 1 if successful, 0 if not or -1 on error
+ */
+int libcfile_internal_file_determine_block_size(
+     libcfile_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+#if ( WINVER >= 0x0600 )
+	FILE_ALIGNMENT_INFO file_alignment_information;
+#else
+	DISK_GEOMETRY disk_geometry;
+	DISK_GEOMETRY_EX disk_geometry_extended;
+#endif
+#endif /* defined( WINAPI ) */
+
+	static char *function     = "libcfile_internal_file_get_bytes_per_sector";
+	uint32_t error_code       = 0;
+
+#if defined( WINAPI )
+	uint32_t bytes_per_sector = 0;
+	BOOL result               = 0;
+#else
+	ssize_t read_count        = 0;
+
+#if !defined( BLKSSZGET ) && defined( DIOCGSECTORSIZE )
+	u_int bytes_per_sector    = 0;
+#else
+	uint32_t bytes_per_sector = 0;
+#endif
+#endif /* defined( WINAPI ) */
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+#if ( WINVER >= 0x0600 )
+	result = GetFileInformationByHandleEx(
+		  internal_file->handle,
+		  FileAlignmentInfo,
+		  (void *) &file_alignment_information,
+		  (DWORD) sizeof( FILE_ALIGNMENT_INFO ) );
+
+	if( result == FALSE )
+	{
+		error_code = (uint32_t) GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+		 error_code,
+		 "%s: unable to retrieve file alignment information.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+		}
+#endif
+		libcerror_error_free(
+		 error );
+	}
+	else
+	{
+		if( (size64_t) file_alignment_information.AlignmentRequirement >= (size64_t) UINT32_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid file alignment requirement value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		bytes_per_sector = (size_t) file_alignment_information.AlignmentRequirement;
+	}
+#else
+	result = DeviceIoControl(
+		  internal_file->handle,
+		  IOCTL_DISK_GET_DRIVE_GEOMETRY_EX,
+		  NULL,
+		  0,
+		  &disk_geometry_extended,
+		  (DWORD) sizeof( DISK_GEOMETRY_EX ),
+		  &response_count,
+		  NULL );
+
+	if( result == FALSE )
+	{
+		error_code = (uint32_t) GetLastError();
+
+		if( error_code == ERROR_NOT_SUPPORTED )
+		{
+		}
+		else if( error_code != ERROR_MORE_DATA )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+			 error_code,
+			 "%s: unable to query device for: IOCTL_DISK_GET_DRIVE_GEOMETRY_EX.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+		else if( response_count < sizeof( DISK_GEOMETRY_EX ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid response count to query: IOCTL_DISK_GET_DRIVE_GEOMETRY_EX value out of bounds.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+		else
+		{
+			result = TRUE;
+		}
+	}
+	if( result == TRUE )
+	{
+		bytes_per_sector = (uint32_t) disk_geometry_extended.Geometry.BytesPerSector;
+	}
+	else if( error_code == ERROR_NOT_SUPPORTED )
+	{
+		/* A floppy device does not support IOCTL_DISK_GET_DRIVE_GEOMETRY_EX
+		 */
+		result = DeviceIoControl(
+			  internal_file->handle,
+			  IOCTL_DISK_GET_DRIVE_GEOMETRY,
+			  NULL,
+			  0,
+			  &disk_geometry,
+			  sizeof( DISK_GEOMETRY ),
+			  &response_count,
+			  error );
+
+		if( result == FALSE )
+		{
+			error_code = (uint32_t) GetLastError();
+
+			if( error_code != ERROR_MORE_DATA )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+				 error_code,
+				 "%s: unable to query device for: IOCTL_DISK_GET_DRIVE_GEOMETRY_EX.",
+				 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					if( ( error != NULL )
+					 && ( *error != NULL ) )
+					{
+						libcnotify_print_error_backtrace(
+						 *error );
+					}
+				}
+#endif
+				libcerror_error_free(
+				 error );
+			}
+			else if( response_count < sizeof( DISK_GEOMETRY ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid response count to query: IOCTL_DISK_GET_DRIVE_GEOMETRY value out of bounds.",
+				 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					if( ( error != NULL )
+					 && ( *error != NULL ) )
+					{
+						libcnotify_print_error_backtrace(
+						 *error );
+					}
+				}
+#endif
+				libcerror_error_free(
+				 error );
+			}
+			else
+			{
+				result = TRUE;
+			}
+		}
+		if( result == TRUE )
+		{
+			bytes_per_sector = (uint32_t) disk_geometry.BytesPerSector;
+		}
+	}
+#endif /* ( WINVER >= 0x0600 ) */
+#elif defined( BLKSSZGET )
+	read_count = libcfile_internal_file_io_control_read_with_error_code(
+		      internal_file,
+		      BLKSSZGET,
+		      NULL,
+		      0,
+		      (uint8_t *) &bytes_per_sector,
+		      4,
+		      &error_code,
+		      error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+		 "%s: unable to query device for: BLKSSZGET.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+		}
+#endif
+		libcerror_error_free(
+		 error );
+	}
+#elif defined( DIOCGSECTORSIZE )
+	read_count = libcfile_internal_file_io_control_read_with_error_code(
+		      internal_file,
+		      DIOCGSECTORSIZE,
+		      NULL,
+		      0,
+		      (uint8_t *) &bytes_per_sector,
+		      sizeof( u_int ),
+		      &error_code,
+		      error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+		 "%s: unable to query device for: DIOCGSECTORSIZE.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+		}
+#endif
+		libcerror_error_free(
+		 error );
+	}
+	else if( bytes_per_sector > (u_int) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid bytes per sector value out of bounds.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+		}
+#endif
+		libcerror_error_free(
+		 error );
+	}
+#elif defined( DKIOCGETBLOCKSIZE )
+	read_count = libcfile_internal_file_io_control_read_with_error_code(
+		      internal_file,
+		      DKIOCGETBLOCKSIZE,
+		      NULL,
+		      0,
+		      (uint8_t *) &bytes_per_sector,
+		      4,
+		      &error_code,
+		      error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+		 "%s: unable to query device for: DKIOCGETBLOCKSIZE.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+		}
+#endif
+		libcerror_error_free(
+		 error );
+	}
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: bytes per sector: %" PRIu32 "\n",
+		 function,
+		 bytes_per_sector );
+	}
+#endif
+	if( bytes_per_sector != 0 )
+	{
+		if( libcfile_internal_file_set_block_size(
+		     internal_file,
+		     (size_t) bytes_per_sector,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set block size.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Initializes the file for direct access
+ * Direct access requires block aligned reads, if the block size cannot be
+ * determined from the device LIBCFILE_DEFAULT_DIRECT_ACCESS_BLOCK_SIZE is used
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_internal_file_initialize_direct_access(
+     libcfile_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_internal_file_initialize_direct_access";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->block_size == 0 )
+	{
+		if( libcfile_internal_file_determine_block_size(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine block size.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_file->block_size == 0 )
+	{
+		if( libcfile_internal_file_set_block_size(
+		     internal_file,
+		     LIBCFILE_DEFAULT_DIRECT_ACCESS_BLOCK_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set block size.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The block size can have been set before direct access was enabled
+	 */
+	if( internal_file->bounce_data == NULL )
+	{
+		if( libcfile_internal_file_allocate_bounce_data(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create bounce data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the block size for the read and seek operations
+ * A block size of 0 represents no block-based operations
+ * The total size must be a multitude of block size
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_internal_file_set_block_size(
+     libcfile_internal_file_t *internal_file,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_internal_file_set_block_size";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI ) && ( UINT32_MAX < SSIZE_MAX )
+	if( block_size > (size_t) UINT32_MAX )
+#else
+	if( block_size > (size_t) SSIZE_MAX )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid block size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->block_cache != NULL )
+	{
+		if( libcfile_block_cache_free(
+		     &( internal_file->block_cache ),
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid response count to query: IOCTL_DISK_GET_DRIVE_GEOMETRY_EX value out of bounds.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free block cache.",
 			 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				if( ( error != NULL )
-				 && ( *error != NULL ) )
-				{
-					libcnotify_print_error_backtrace(
-					 *error );
-				}
-			}
-#endif
-			libcerror_error_free(
-			 error );
-		}
-		else
-		{
-			result = TRUE;
+			return( -1 );
 		}
 	}
-	if( result == TRUE )
+	if( internal_file->bounce_data != NULL )
 	{
-		bytes_per_sector = (uint32_t) disk_geometry_extended.Geometry.BytesPerSector;
+		memory_free(
+		 internal_file->bounce_data );
+
+		internal_file->bounce_data      = NULL;
+		internal_file->bounce_data_size = 0;
 	}
-	else if( error_code == ERROR_NOT_SUPPORTED )
+	if( internal_file->read_block_data != NULL )
 	{
-		/* A floppy device does not support IOCTL_DISK_GET_DRIVE_GEOMETRY_EX
-		 */
-		result = DeviceIoControl(
-			  internal_file->handle,
-			  IOCTL_DISK_GET_DRIVE_GEOMETRY,
-			  NULL,
-			  0,
-			  &disk_geometry,
-			  sizeof( DISK_GEOMETRY ),
-			  &response_count,
-			  error );
+		memory_free(
+		 internal_file->read_block_data );
 
-		if( result == FALSE )
+		internal_file->read_block_data = NULL;
+	}
+	if( block_size > 0 )
+	{
+		if( libcfile_block_cache_initialize(
+		     &( internal_file->block_cache ),
+		     block_size,
+		     internal_file->number_of_cache_blocks,
+		     error ) != 1 )
 		{
-			error_code = (uint32_t) GetLastError();
-
-			if( error_code != ERROR_MORE_DATA )
-			{
-				libcerror_system_set_error(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-				 error_code,
-				 "%s: unable to query device for: IOCTL_DISK_GET_DRIVE_GEOMETRY_EX.",
-				 function );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					if( ( error != NULL )
-					 && ( *error != NULL ) )
-					{
-						libcnotify_print_error_backtrace(
-						 *error );
-					}
-				}
-#endif
-				libcerror_error_free(
-				 error );
-			}
-			else if( response_count < sizeof( DISK_GEOMETRY ) )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid response count to query: IOCTL_DISK_GET_DRIVE_GEOMETRY value out of bounds.",
-				 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create block cache.",
+			 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					if( ( error != NULL )
-					 && ( *error != NULL ) )
-					{
-						libcnotify_print_error_backtrace(
-						 *error );
-					}
-				}
-#endif
-				libcerror_error_free(
-				 error );
-			}
-			else
-			{
-				result = TRUE;
-			}
+			return( -1 );
 		}
-		if( result == TRUE )
+	}
+	internal_file->block_size = block_size;
+
+	if( ( block_size > 0 )
+	 && ( ( internal_file->access_flags & LIBCFILE_ACCESS_FLAG_DIRECT ) != 0 ) )
+	{
+		if( libcfile_internal_file_allocate_bounce_data(
+		     internal_file,
+		     error ) != 1 )
 		{
-			bytes_per_sector = (uint32_t) disk_geometry.BytesPerSector;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create bounce data.",
+			 function );
+
+			return( -1 );
 		}
 	}
-#endif /* ( WINVER >= 0x0600 ) */
-#elif defined( BLKSSZGET )
-	read_count = libcfile_internal_file_io_control_read_with_error_code(
-		      internal_file,
-		      BLKSSZGET,
-		      NULL,
-		      0,
-		      (uint8_t *) &bytes_per_sector,
-		      4,
-		      &error_code,
-		      error );
+	return( 1 );
+}
 
-	if( read_count == -1 )
+/* Sets the block size for the read and seek operations
+ * A block size of 0 represents no block-based operations
+ * The total size must be a multitude of block size, except for direct access
+ * where a block size of 0 is not supported
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_file_set_block_size(
+     libcfile_file_t *file,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_set_block_size";
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-		 "%s: unable to query device for: BLKSSZGET.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			if( ( error != NULL )
-			 && ( *error != NULL ) )
-			{
-				libcnotify_print_error_backtrace(
-				 *error );
-			}
-		}
-#endif
-		libcerror_error_free(
-		 error );
+		return( -1 );
 	}
-#elif defined( DIOCGSECTORSIZE )
-	read_count = libcfile_internal_file_io_control_read_with_error_code(
-		      internal_file,
-		      DIOCGSECTORSIZE,
-		      NULL,
-		      0,
-		      (uint8_t *) &bytes_per_sector,
-		      sizeof( u_int ),
-		      &error_code,
-		      error );
+	internal_file = (libcfile_internal_file_t *) file;
 
-	if( read_count == -1 )
+	if( ( internal_file->access_flags & LIBCFILE_ACCESS_FLAG_WRITE ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-		 "%s: unable to query device for: DIOCGSECTORSIZE.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: setting block size not supported with write access.",
 		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			if( ( error != NULL )
-			 && ( *error != NULL ) )
-			{
-				libcnotify_print_error_backtrace(
-				 *error );
-			}
-		}
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing handle.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
 #endif
-		libcerror_error_free(
-		 error );
+#if defined( WINAPI ) && ( UINT32_MAX < SSIZE_MAX )
+	if( block_size > (size_t) UINT32_MAX )
+#else
+	if( block_size > (size_t) SSIZE_MAX )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid block size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 && ( ( internal_file->access_flags & LIBCFILE_ACCESS_FLAG_DIRECT ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: block size of 0 not supported with direct access.",
+		 function );
+
+		return( -1 );
+	}
+	/* With direct access the last block of the file can be smaller than the block size
+	 */
+	if( ( block_size != 0 )
+	 && ( ( internal_file->access_flags & LIBCFILE_ACCESS_FLAG_DIRECT ) == 0 )
+	 && ( ( libcfile_internal_file_load_size(
+	         internal_file ) % block_size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcfile_internal_file_set_block_size(
+	     internal_file,
+	     block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set block size.",
+		 function );
+
+		return( -1 );
 	}
-	else if( bytes_per_sector > (u_int) UINT32_MAX )
+	return( 1 );
+}
+
+/* Sets the number of blocks in the block cache
+ * The block cache is used by the block-based read operations
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_file_set_cache_size(
+     libcfile_file_t *file,
+     int number_of_blocks,
+     libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_set_cache_size";
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid bytes per sector value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			if( ( error != NULL )
-			 && ( *error != NULL ) )
-			{
-				libcnotify_print_error_backtrace(
-				 *error );
-			}
-		}
-#endif
-		libcerror_error_free(
-		 error );
+		return( -1 );
 	}
-#elif defined( DKIOCGETBLOCKSIZE )
-	read_count = libcfile_internal_file_io_control_read_with_error_code(
-		      internal_file,
-		      DKIOCGETBLOCKSIZE,
-		      NULL,
-		      0,
-		      (uint8_t *) &bytes_per_sector,
-		      4,
-		      &error_code,
-		      error );
+	internal_file = (libcfile_internal_file_t *) file;
 
-	if( read_count == -1 )
+	if( ( number_of_blocks <= 0 )
+	 || ( number_of_blocks > LIBCFILE_MAXIMUM_NUMBER_OF_CACHE_BLOCKS ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-		 "%s: unable to query device for: DKIOCGETBLOCKSIZE.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of blocks value out of bounds.",
 		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			if( ( error != NULL )
-			 && ( *error != NULL ) )
-			{
-				libcnotify_print_error_backtrace(
-				 *error );
-			}
-		}
-#endif
-		libcerror_error_free(
-		 error );
+		return( -1 );
 	}
-#endif
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( number_of_blocks == internal_file->number_of_cache_blocks )
 	{
-		libcnotify_printf(
-		 "%s: bytes per sector: %" PRIu32 "\n",
-		 function,
-		 bytes_per_sector );
+		return( 1 );
 	}
-#endif
-	if( bytes_per_sector != 0 )
+	internal_file->number_of_cache_blocks = number_of_blocks;
+
+	/* Recreate the block cache if block-based operations are in use
+	 */
+	if( internal_file->block_size != 0 )
 	{
 		if( libcfile_internal_file_set_block_size(
 		     internal_file,
-		     (size_t) bytes_per_sector,
+		     internal_file->block_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -4812,19 +15682,19 @@ int libcfile_internal_file_determine_block_size(
 	return( 1 );
 }
 
-/* Sets the block size for the read and seek operations
- * A block size of 0 represents no block-based operations
- * The total size must be a multitude of block size
+/* Retrieves the number of block cache hits and misses
  * Returns 1 if successful or -1 on error
  */
-int libcfile_internal_file_set_block_size(
-     libcfile_internal_file_t *internal_file,
-     size_t block_size,
+int libcfile_file_get_cache_statistics(
+     libcfile_file_t *file,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
      libcerror_error_t **error )
 {
-	static char *function = "libcfile_internal_file_set_block_size";
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_get_cache_statistics";
 
-	if( internal_file == NULL )
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -4835,89 +15705,76 @@ int libcfile_internal_file_set_block_size(
 
 		return( -1 );
 	}
-#if defined( WINAPI ) && ( UINT32_MAX < SSIZE_MAX )
-	if( block_size > (size_t) UINT32_MAX )
-#else
-	if( block_size > (size_t) SSIZE_MAX )
-#endif
+	internal_file = (libcfile_internal_file_t *) file;
+
+	if( number_of_hits == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid block size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->block_data != NULL )
+	if( number_of_misses == NULL )
 	{
-		if( block_size != internal_file->block_size )
-		{
-			memory_free(
-			 internal_file->block_data );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
+		 function );
 
-			internal_file->block_data      = NULL;
-			internal_file->block_data_size = 0;
-		}
+		return( -1 );
 	}
-	if( internal_file->block_data == NULL )
+	if( internal_file->block_cache == NULL )
 	{
-		if( block_size > 0 )
-		{
-#if defined( __FreeBSD__ ) || defined( __NetBSD__ ) || defined( __OpenBSD__ )
-			if( posix_memalign(
-			     (void **) &( internal_file->block_data ),
-			     block_size,
-			     block_size ) != 0 )
-#else
-			internal_file->block_data = (uint8_t *) memory_allocate(
-			                                         block_size );
-
-			if( internal_file->block_data == NULL )
-#endif
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create block data.",
-				 function );
+		*number_of_hits   = 0;
+		*number_of_misses = 0;
 
-				return( -1 );
-			}
-			if( memory_set(
-			     internal_file->block_data,
-			     0,
-			     block_size ) == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-				 "%s: unable to clear block data.",
-				 function );
+		return( 1 );
+	}
+	if( libcfile_block_cache_get_statistics(
+	     internal_file->block_cache,
+	     number_of_hits,
+	     number_of_misses,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve block cache statistics.",
+		 function );
 
-				return( -1 );
-			}
-		}
-		internal_file->block_size = block_size;
+		return( -1 );
 	}
 	return( 1 );
 }
 
-/* Sets the block size for the read and seek operations
- * A block size of 0 represents no block-based operations
- * The total size must be a multitude of block size
- * Returns 1 if successful or -1 on error
+/* Retrieves the number of operations and bytes of a specific operation type
+ * The operations are counted per system call
+ * Returns 1 if successful, 0 if statistics are not available or -1 on error
  */
-int libcfile_file_set_block_size(
+int libcfile_file_get_statistics(
      libcfile_file_t *file,
-     size_t block_size,
+     int operation_type LIBCFILE_ATTRIBUTE_UNUSED,
+     uint64_t *number_of_operations LIBCFILE_ATTRIBUTE_UNUSED,
+     uint64_t *number_of_bytes LIBCFILE_ATTRIBUTE_UNUSED,
      libcerror_error_t **error )
 {
+#if defined( HAVE_LIBCFILE_STATISTICS )
 	libcfile_internal_file_t *internal_file = NULL;
-	static char *function                   = "libcfile_file_set_block_size";
+#endif
+	static char *function                   = "libcfile_file_get_statistics";
+
+#if !defined( HAVE_LIBCFILE_STATISTICS )
+	LIBCFILE_UNREFERENCED_PARAMETER( operation_type )
+	LIBCFILE_UNREFERENCED_PARAMETER( number_of_operations )
+	LIBCFILE_UNREFERENCED_PARAMETER( number_of_bytes )
+#endif
 
 	if( file == NULL )
 	{
@@ -4930,85 +15787,184 @@ int libcfile_file_set_block_size(
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBCFILE_STATISTICS )
 	internal_file = (libcfile_internal_file_t *) file;
 
-	if( ( internal_file->access_flags & LIBCFILE_ACCESS_FLAG_WRITE ) != 0 )
+	if( libcfile_statistics_get_operation(
+	     &( internal_file->statistics ),
+	     operation_type,
+	     number_of_operations,
+	     number_of_bytes,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: setting block size not supported with write access.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( WINAPI )
-	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	return( 1 );
+#else
+	return( 0 );
+#endif
+}
+
+/* Retrieves the number of bytes read that were not requested
+ * These are the bytes before and after the requested data of blocks that are not aligned
+ * Returns 1 if successful, 0 if statistics are not available or -1 on error
+ */
+int libcfile_file_get_read_amplification(
+     libcfile_file_t *file,
+     uint64_t *number_of_bytes LIBCFILE_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	libcfile_internal_file_t *internal_file = NULL;
+#endif
+	static char *function                   = "libcfile_file_get_read_amplification";
+
+#if !defined( HAVE_LIBCFILE_STATISTICS )
+	LIBCFILE_UNREFERENCED_PARAMETER( number_of_bytes )
+#endif
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-#else
-	if( internal_file->descriptor == -1 )
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	internal_file = (libcfile_internal_file_t *) file;
+
+	if( libcfile_statistics_get_read_amplification(
+	     &( internal_file->statistics ),
+	     number_of_bytes,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing descriptor.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve read amplification.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-#if defined( WINAPI ) && ( UINT32_MAX < SSIZE_MAX )
-	if( block_size > (size_t) UINT32_MAX )
+	return( 1 );
 #else
-	if( block_size > (size_t) SSIZE_MAX )
+	return( 0 );
+#endif
+}
+
+/* Retrieves the latency histogram of a specific operation type
+ * Bucket N contains the number of operations that took 2^N up to 2^(N+1) nanoseconds
+ * At most LIBCFILE_NUMBER_OF_LATENCY_BUCKETS buckets are retrieved
+ * Returns 1 if successful, 0 if statistics are not available or -1 on error
+ */
+int libcfile_file_get_latency_histogram(
+     libcfile_file_t *file,
+     int operation_type LIBCFILE_ATTRIBUTE_UNUSED,
+     uint64_t *histogram LIBCFILE_ATTRIBUTE_UNUSED,
+     int number_of_buckets LIBCFILE_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	libcfile_internal_file_t *internal_file = NULL;
 #endif
+	static char *function                   = "libcfile_file_get_latency_histogram";
+
+#if !defined( HAVE_LIBCFILE_STATISTICS )
+	LIBCFILE_UNREFERENCED_PARAMETER( operation_type )
+	LIBCFILE_UNREFERENCED_PARAMETER( histogram )
+	LIBCFILE_UNREFERENCED_PARAMETER( number_of_buckets )
+#endif
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid block size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( block_size != 0 )
-	 && ( ( internal_file->size % block_size ) != 0 ) )
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	internal_file = (libcfile_internal_file_t *) file;
+
+	if( libcfile_statistics_get_latency_histogram(
+	     &( internal_file->statistics ),
+	     operation_type,
+	     histogram,
+	     number_of_buckets,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid block size value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve latency histogram.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcfile_internal_file_set_block_size(
-	     internal_file,
-	     block_size,
+	return( 1 );
+#else
+	return( 0 );
+#endif
+}
+
+/* Resets the statistics
+ * Returns 1 if successful, 0 if statistics are not available or -1 on error
+ */
+int libcfile_file_reset_statistics(
+     libcfile_file_t *file,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	libcfile_internal_file_t *internal_file = NULL;
+#endif
+	static char *function                   = "libcfile_file_reset_statistics";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	internal_file = (libcfile_internal_file_t *) file;
+
+	if( libcfile_statistics_reset(
+	     &( internal_file->statistics ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set block size.",
+		 "%s: unable to reset statistics.",
 		 function );
 
 		return( -1 );
 	}
 	return( 1 );
+#else
+	return( 0 );
+#endif
 }
 
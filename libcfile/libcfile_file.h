@@ -25,8 +25,13 @@
 #include <common.h>
 #include <types.h>
 
+#include "libcfile_block_cache.h"
 #include "libcfile_extern.h"
+#include "libcfile_group_commit.h"
+#include "libcfile_io_ring.h"
 #include "libcfile_libcerror.h"
+#include "libcfile_readahead.h"
+#include "libcfile_statistics.h"
 #include "libcfile_types.h"
 
 #if defined( __cplusplus )
@@ -34,6 +39,7 @@ extern "C" {
 #endif
 
 typedef struct libcfile_internal_file libcfile_internal_file_t;
+typedef struct libcfile_internal_read_range libcfile_internal_read_range_t;
 
 struct libcfile_internal_file
 {
@@ -69,21 +75,156 @@ struct libcfile_internal_file
 	 */
 	off64_t current_offset;
 
+	/* The offset of the file descriptor, which differs from the current offset
+	 * after a seek until the next read or write that uses the file descriptor offset
+	 */
+	off64_t descriptor_offset;
+
 	/* The block size
 	 */
 	size_t block_size;
 
-	/* The block data
+	/* The number of blocks in the block cache
+	 */
+	int number_of_cache_blocks;
+
+	/* The block cache
+	 */
+	libcfile_block_cache_t *block_cache;
+
+	/* The block aligned data used to read into buffers that are not
+	 * block aligned with direct access
+	 */
+	uint8_t *bounce_data;
+
+	/* The bounce data size
+	 */
+	size_t bounce_data_size;
+
+	/* The block data that is reused by reads at a specific offset
+	 */
+	uint8_t *read_block_data;
+
+	/* The queue depth of asynchronous requests
+	 */
+	int queue_depth;
+
+	/* The IO ring used for asynchronous requests
+	 */
+	libcfile_io_ring_t *io_ring;
+
+	/* The completions retrieved from the IO ring
+	 */
+	libcfile_io_ring_request_t *completions;
+
+	/* The memory mapped data
+	 */
+	uint8_t *mapped_data;
+
+	/* The memory mapped data size
+	 */
+	size_t mapped_data_size;
+
+	/* The access behavior
+	 */
+	int access_behavior;
+
+	/* The offset of the data read in streaming access behavior that was not yet removed from the page cache
+	 */
+	off64_t streaming_offset;
+
+	/* The end offset of the data read in streaming access behavior
+	 */
+	off64_t streaming_end_offset;
+
+	/* The readahead
+	 */
+	libcfile_readahead_t *readahead;
+
+	/* The write buffer
+	 */
+	uint8_t *write_buffer;
+
+	/* The write buffer size
+	 */
+	size_t write_buffer_size;
+
+	/* The size of the data in the write buffer
+	 */
+	size_t write_buffer_data_size;
+
+	/* The offset of the data in the write buffer
+	 */
+	off64_t write_buffer_offset;
+
+	/* The initial size of the automatic preallocation
+	 */
+	size64_t preallocation_size;
+
+	/* The size of the next automatic preallocation
+	 */
+	size64_t preallocation_step;
+
+	/* The end offset of the automatically preallocated storage
+	 */
+	size64_t preallocated_offset;
+
+	/* The size of the window in which written data is written back
+	 */
+	size_t writeback_size;
+
+	/* The offset of the data of which the write back was not yet started
+	 */
+	off64_t writeback_offset;
+
+	/* The offset of the data of which the write back was started but not yet waited for
+	 */
+	off64_t writeback_wait_offset;
+
+	/* The error code of a failed write back that was not yet reported
 	 */
-	uint8_t *block_data;
+	uint32_t writeback_error_code;
 
-	/* The block data offset
+	/* Value to indicate holes should be read as zero bytes without reading them
 	 */
-	size_t block_data_offset;
+	uint8_t skip_holes;
 
-	/* The block data size
+	/* The offset the cached data extent was retrieved for
 	 */
-	size_t block_data_size;
+	off64_t data_extent_query_offset;
+
+	/* The offset of the cached data extent
+	 */
+	off64_t data_extent_offset;
+
+	/* The size of the cached data extent
+	 */
+	size64_t data_extent_size;
+
+	/* The group commit
+	 */
+	libcfile_group_commit_t group_commit;
+
+#if defined( HAVE_LIBCFILE_STATISTICS )
+	/* The input/output statistics
+	 */
+	libcfile_statistics_t statistics;
+#endif
+};
+
+struct libcfile_internal_read_range
+{
+	/* The offset
+	 */
+	off64_t offset;
+
+	/* The size
+	 */
+	size_t size;
+
+	/* The buffer
+	 */
+	uint8_t *buffer;
 };
 
 LIBCFILE_EXTERN \
@@ -130,6 +271,14 @@ int libcfile_file_open_wide_with_error_code(
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+int libcfile_internal_file_map(
+     libcfile_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+int libcfile_internal_file_unmap(
+     libcfile_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
 LIBCFILE_EXTERN \
 int libcfile_file_close(
      libcfile_file_t *file,
@@ -142,8 +291,6 @@ ssize_t libcfile_file_read_buffer(
          size_t size,
          libcerror_error_t **error );
 
-#if defined( WINAPI )
-
 ssize_t libcfile_internal_file_read_buffer_at_offset_with_error_code(
          libcfile_internal_file_t *internal_file,
          off64_t current_offset,
@@ -152,7 +299,45 @@ ssize_t libcfile_internal_file_read_buffer_at_offset_with_error_code(
          uint32_t *error_code,
          libcerror_error_t **error );
 
-#endif /* defined( WINAPI ) */
+int libcfile_internal_file_allocate_block_data(
+     libcfile_internal_file_t *internal_file,
+     size_t size,
+     uint8_t **block_data,
+     libcerror_error_t **error );
+
+int libcfile_internal_file_allocate_bounce_data(
+     libcfile_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+int libcfile_internal_file_acquire_read_block_data(
+     libcfile_internal_file_t *internal_file,
+     uint8_t **block_data,
+     libcerror_error_t **error );
+
+void libcfile_internal_file_release_read_block_data(
+      libcfile_internal_file_t *internal_file,
+      uint8_t *block_data );
+
+int libcfile_internal_file_buffer_is_block_aligned(
+     libcfile_internal_file_t *internal_file,
+     const uint8_t *buffer );
+
+ssize_t libcfile_internal_file_read_aligned_buffer_at_offset_with_error_code(
+         libcfile_internal_file_t *internal_file,
+         off64_t offset,
+         uint8_t *buffer,
+         size_t size,
+         uint8_t *bounce_data,
+         uint32_t *error_code,
+         libcerror_error_t **error );
+
+ssize_t libcfile_internal_file_read_blocks_with_error_code(
+         libcfile_internal_file_t *internal_file,
+         off64_t offset,
+         uint8_t *buffer,
+         size_t size,
+         uint32_t *error_code,
+         libcerror_error_t **error );
 
 LIBCFILE_EXTERN \
 ssize_t libcfile_file_read_buffer_with_error_code(
@@ -162,6 +347,51 @@ ssize_t libcfile_file_read_buffer_with_error_code(
          uint32_t *error_code,
          libcerror_error_t **error );
 
+LIBCFILE_EXTERN \
+ssize_t libcfile_file_read_buffer_at_offset(
+         libcfile_file_t *file,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+ssize_t libcfile_file_read_buffer_at_offset_with_error_code(
+         libcfile_file_t *file,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         uint32_t *error_code,
+         libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+int libcfile_file_get_data_at_offset(
+     libcfile_file_t *file,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+ssize_t libcfile_internal_file_write_buffer_at_offset_with_error_code(
+         libcfile_internal_file_t *internal_file,
+         off64_t current_offset,
+         const uint8_t *buffer,
+         size_t size,
+         uint32_t *error_code,
+         libcerror_error_t **error );
+
+void libcfile_internal_file_extend_size(
+      libcfile_internal_file_t *internal_file,
+      size64_t end_offset );
+
+size64_t libcfile_internal_file_load_size(
+          libcfile_internal_file_t *internal_file );
+
+void libcfile_internal_file_store_size(
+      libcfile_internal_file_t *internal_file,
+      size64_t size );
+
 LIBCFILE_EXTERN \
 ssize_t libcfile_file_write_buffer(
          libcfile_file_t *file,
@@ -169,6 +399,13 @@ ssize_t libcfile_file_write_buffer(
          size_t size,
          libcerror_error_t **error );
 
+ssize_t libcfile_internal_file_write_buffer_with_error_code(
+         libcfile_internal_file_t *internal_file,
+         const uint8_t *buffer,
+         size_t size,
+         uint32_t *error_code,
+         libcerror_error_t **error );
+
 LIBCFILE_EXTERN \
 ssize_t libcfile_file_write_buffer_with_error_code(
          libcfile_file_t *file,
@@ -177,6 +414,311 @@ ssize_t libcfile_file_write_buffer_with_error_code(
          uint32_t *error_code,
          libcerror_error_t **error );
 
+int libcfile_internal_file_flush_write_buffer(
+     libcfile_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+int libcfile_file_flush(
+     libcfile_file_t *file,
+     libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+int libcfile_file_set_write_buffer_size(
+     libcfile_file_t *file,
+     size_t write_buffer_size,
+     libcerror_error_t **error );
+
+int libcfile_internal_file_sync_with_error_code(
+     libcfile_internal_file_t *internal_file,
+     int sync_flags,
+     uint32_t *error_code,
+     libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+int libcfile_file_sync(
+     libcfile_file_t *file,
+     int sync_flags,
+     libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+int libcfile_file_sync_range(
+     libcfile_file_t *file,
+     off64_t offset,
+     size64_t size,
+     int sync_range_flags,
+     libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+int libcfile_file_commit(
+     libcfile_file_t *file,
+     libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+int libcfile_file_set_commit_interval(
+     libcfile_file_t *file,
+     uint32_t commit_interval,
+     libcerror_error_t **error );
+
+#if defined( HAVE_SYNC_FILE_RANGE ) && !defined( WINAPI )
+
+int libcfile_internal_file_writeback(
+     libcfile_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_SYNC_FILE_RANGE ) && !defined( WINAPI ) */
+
+int libcfile_internal_file_get_writeback_error(
+     libcfile_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+int libcfile_file_set_writeback_size(
+     libcfile_file_t *file,
+     size_t writeback_size,
+     libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+ssize_t libcfile_file_write_buffer_at_offset(
+         libcfile_file_t *file,
+         const uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+ssize_t libcfile_file_write_buffer_at_offset_with_error_code(
+         libcfile_file_t *file,
+         const uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         uint32_t *error_code,
+         libcerror_error_t **error );
+
+int libcfile_internal_file_get_vector_size(
+     libcfile_internal_file_t *internal_file,
+     const uint8_t **buffers,
+     const size_t *buffer_sizes,
+     int number_of_buffers,
+     size_t *vector_size,
+     libcerror_error_t **error );
+
+int libcfile_internal_file_vector_is_block_aligned(
+     libcfile_internal_file_t *internal_file,
+     off64_t offset,
+     uint8_t **buffers,
+     const size_t *buffer_sizes,
+     int number_of_buffers );
+
+ssize_t libcfile_internal_file_read_vector_at_offset_with_error_code(
+         libcfile_internal_file_t *internal_file,
+         off64_t current_offset,
+         uint8_t **buffers,
+         const size_t *buffer_sizes,
+         int number_of_buffers,
+         uint32_t *error_code,
+         libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+ssize_t libcfile_file_read_vector(
+         libcfile_file_t *file,
+         uint8_t **buffers,
+         const size_t *buffer_sizes,
+         int number_of_buffers,
+         libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+ssize_t libcfile_file_read_vector_at_offset(
+         libcfile_file_t *file,
+         uint8_t **buffers,
+         const size_t *buffer_sizes,
+         int number_of_buffers,
+         off64_t offset,
+         libcerror_error_t **error );
+
+int libcfile_internal_read_range_compare(
+     const void *first_range,
+     const void *second_range );
+
+LIBCFILE_EXTERN \
+int libcfile_file_read_ranges(
+     libcfile_file_t *file,
+     uint8_t **buffers,
+     const off64_t *offsets,
+     const size_t *sizes,
+     int number_of_ranges,
+     size_t maximum_gap_size,
+     libcerror_error_t **error );
+
+ssize_t libcfile_internal_file_write_vector_at_offset_with_error_code(
+         libcfile_internal_file_t *internal_file,
+         off64_t current_offset,
+         const uint8_t **buffers,
+         const size_t *buffer_sizes,
+         int number_of_buffers,
+         uint32_t *error_code,
+         libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+ssize_t libcfile_file_write_vector(
+         libcfile_file_t *file,
+         const uint8_t **buffers,
+         const size_t *buffer_sizes,
+         int number_of_buffers,
+         libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+ssize_t libcfile_file_write_vector_at_offset(
+         libcfile_file_t *file,
+         const uint8_t **buffers,
+         const size_t *buffer_sizes,
+         int number_of_buffers,
+         off64_t offset,
+         libcerror_error_t **error );
+
+#if defined( HAVE_IOCTL ) && defined( FICLONERANGE ) && !defined( WINAPI )
+
+ssize_t libcfile_internal_file_clone_range(
+         libcfile_internal_file_t *source_internal_file,
+         off64_t source_offset,
+         libcfile_internal_file_t *destination_internal_file,
+         off64_t destination_offset,
+         size_t size,
+         libcerror_error_t **error );
+
+#endif /* defined( HAVE_IOCTL ) && defined( FICLONERANGE ) && !defined( WINAPI ) */
+
+#if defined( HAVE_COPY_FILE_RANGE ) && !defined( WINAPI )
+
+ssize_t libcfile_internal_file_copy_file_range(
+         libcfile_internal_file_t *source_internal_file,
+         off64_t source_offset,
+         libcfile_internal_file_t *destination_internal_file,
+         off64_t destination_offset,
+         size_t size,
+         libcerror_error_t **error );
+
+#endif /* defined( HAVE_COPY_FILE_RANGE ) && !defined( WINAPI ) */
+
+#if defined( HAVE_SENDFILE ) && defined( HAVE_SYS_SENDFILE_H ) && !defined( WINAPI )
+
+ssize_t libcfile_internal_file_sendfile_range(
+         libcfile_internal_file_t *source_internal_file,
+         off64_t source_offset,
+         libcfile_internal_file_t *destination_internal_file,
+         off64_t destination_offset,
+         size_t size,
+         libcerror_error_t **error );
+
+#endif /* defined( HAVE_SENDFILE ) && defined( HAVE_SYS_SENDFILE_H ) && !defined( WINAPI ) */
+
+ssize_t libcfile_internal_file_copy_range_with_buffer(
+         libcfile_internal_file_t *source_internal_file,
+         off64_t source_offset,
+         libcfile_internal_file_t *destination_internal_file,
+         off64_t destination_offset,
+         size_t size,
+         libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+ssize_t libcfile_file_copy_range(
+         libcfile_file_t *source_file,
+         off64_t source_offset,
+         libcfile_file_t *destination_file,
+         off64_t destination_offset,
+         size_t size,
+         libcerror_error_t **error );
+
+#if ( defined( HAVE_SENDFILE ) && defined( HAVE_SYS_SENDFILE_H ) ) || defined( HAVE_SPLICE )
+#if !defined( WINAPI )
+
+ssize_t libcfile_internal_file_splice_range_to_descriptor(
+         libcfile_internal_file_t *internal_file,
+         off64_t offset,
+         size_t size,
+         int target_descriptor,
+         libcerror_error_t **error );
+
+#endif /* !defined( WINAPI ) */
+#endif /* ( defined( HAVE_SENDFILE ) && defined( HAVE_SYS_SENDFILE_H ) ) || defined( HAVE_SPLICE ) */
+
+ssize_t libcfile_internal_file_write_range_to_descriptor(
+         libcfile_internal_file_t *internal_file,
+         off64_t offset,
+         size_t size,
+         int target_descriptor,
+         libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+ssize_t libcfile_file_splice_to_descriptor(
+         libcfile_file_t *file,
+         off64_t offset,
+         size_t size,
+         int target_descriptor,
+         libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+int libcfile_file_set_queue_depth(
+     libcfile_file_t *file,
+     int queue_depth,
+     libcerror_error_t **error );
+
+int libcfile_internal_file_initialize_io_ring(
+     libcfile_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+int libcfile_file_register_buffers(
+     libcfile_file_t *file,
+     uint8_t **buffers,
+     const size_t *buffer_sizes,
+     int number_of_buffers,
+     libcerror_error_t **error );
+
+int libcfile_internal_file_submit_request(
+     libcfile_internal_file_t *internal_file,
+     uint8_t operation,
+     uint8_t *buffer,
+     size_t size,
+     off64_t offset,
+     uint64_t request_identifier,
+     libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+int libcfile_file_submit_read(
+     libcfile_file_t *file,
+     uint8_t *buffer,
+     size_t size,
+     off64_t offset,
+     uint64_t request_identifier,
+     libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+int libcfile_file_submit_write(
+     libcfile_file_t *file,
+     const uint8_t *buffer,
+     size_t size,
+     off64_t offset,
+     uint64_t request_identifier,
+     libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+int libcfile_file_poll_completions(
+     libcfile_file_t *file,
+     uint64_t *request_identifiers,
+     ssize_t *results,
+     int maximum_number_of_completions,
+     int minimum_number_of_completions,
+     libcerror_error_t **error );
+
+#if !defined( WINAPI )
+
+int libcfile_internal_file_seek_descriptor_offset(
+     libcfile_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+#endif /* !defined( WINAPI ) */
+
 LIBCFILE_EXTERN \
 off64_t libcfile_file_seek_offset(
          libcfile_file_t *file,
@@ -190,6 +732,73 @@ int libcfile_file_resize(
      size64_t size,
      libcerror_error_t **error );
 
+int libcfile_internal_file_allocate(
+     libcfile_internal_file_t *internal_file,
+     off64_t offset,
+     size64_t size,
+     int allocate_flags,
+     libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+int libcfile_file_allocate(
+     libcfile_file_t *file,
+     off64_t offset,
+     size64_t size,
+     int allocate_flags,
+     libcerror_error_t **error );
+
+int libcfile_internal_file_preallocate(
+     libcfile_internal_file_t *internal_file,
+     size64_t end_offset,
+     libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+int libcfile_file_set_preallocation_size(
+     libcfile_file_t *file,
+     size64_t preallocation_size,
+     libcerror_error_t **error );
+
+int libcfile_internal_file_get_next_data_extent(
+     libcfile_internal_file_t *internal_file,
+     off64_t offset,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+int libcfile_file_get_next_data_extent(
+     libcfile_file_t *file,
+     off64_t offset,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     libcerror_error_t **error );
+
+ssize_t libcfile_internal_file_read_buffer_at_offset_skipping_holes(
+         libcfile_internal_file_t *internal_file,
+         off64_t offset,
+         uint8_t *buffer,
+         size_t size,
+         uint32_t *error_code,
+         libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+int libcfile_file_set_skip_holes(
+     libcfile_file_t *file,
+     uint8_t skip_holes,
+     libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+int libcfile_file_get_extents(
+     libcfile_file_t *file,
+     off64_t offset,
+     off64_t *logical_offsets,
+     off64_t *physical_offsets,
+     size64_t *extent_sizes,
+     uint32_t *extent_flags,
+     int maximum_number_of_extents,
+     int *number_of_extents,
+     libcerror_error_t **error );
+
 LIBCFILE_EXTERN \
 int libcfile_file_is_open(
      libcfile_file_t *file,
@@ -254,10 +863,62 @@ int libcfile_file_set_access_behavior(
      int access_behavior,
      libcerror_error_t **error );
 
+#if defined( HAVE_POSIX_FADVISE ) && !defined( WINAPI )
+
+int libcfile_internal_file_readahead(
+     libcfile_internal_file_t *internal_file,
+     off64_t offset,
+     size_t size,
+     libcerror_error_t **error );
+
+int libcfile_internal_file_drop_read_data(
+     libcfile_internal_file_t *internal_file,
+     off64_t offset,
+     size_t size,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_POSIX_FADVISE ) && !defined( WINAPI ) */
+
+LIBCFILE_EXTERN \
+int libcfile_file_set_readahead_size(
+     libcfile_file_t *file,
+     size_t maximum_size,
+     libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+int libcfile_file_prefetch(
+     libcfile_file_t *file,
+     const off64_t *range_offsets,
+     const size64_t *range_sizes,
+     int number_of_ranges,
+     libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+int libcfile_file_get_cache_residency(
+     libcfile_file_t *file,
+     off64_t offset,
+     size64_t size,
+     uint8_t *bitmap,
+     size_t bitmap_size,
+     size_t *page_size,
+     libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+ssize_t libcfile_file_read_cached_buffer_at_offset(
+         libcfile_file_t *file,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
 int libcfile_internal_file_determine_block_size(
      libcfile_internal_file_t *internal_file,
      libcerror_error_t **error );
 
+int libcfile_internal_file_initialize_direct_access(
+     libcfile_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
 int libcfile_internal_file_set_block_size(
      libcfile_internal_file_t *internal_file,
      size_t block_size,
@@ -269,6 +930,46 @@ int libcfile_file_set_block_size(
      size_t block_size,
      libcerror_error_t **error );
 
+LIBCFILE_EXTERN \
+int libcfile_file_set_cache_size(
+     libcfile_file_t *file,
+     int number_of_blocks,
+     libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+int libcfile_file_get_cache_statistics(
+     libcfile_file_t *file,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+int libcfile_file_get_statistics(
+     libcfile_file_t *file,
+     int operation_type,
+     uint64_t *number_of_operations,
+     uint64_t *number_of_bytes,
+     libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+int libcfile_file_get_read_amplification(
+     libcfile_file_t *file,
+     uint64_t *number_of_bytes,
+     libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+int libcfile_file_get_latency_histogram(
+     libcfile_file_t *file,
+     int operation_type,
+     uint64_t *histogram,
+     int number_of_buckets,
+     libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+int libcfile_file_reset_statistics(
+     libcfile_file_t *file,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,438 @@
+/*
+ * Group commit functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_NANOSLEEP ) && !defined( WINAPI )
+#include <time.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libcfile_definitions.h"
+#include "libcfile_group_commit.h"
+#include "libcfile_libcerror.h"
+#include "libcfile_statistics.h"
+#include "libcfile_unused.h"
+
+/* The group commit is shared by the threads that commit the same file
+ * and is therefore maintained with atomic operations
+ */
+#if defined( WINAPI )
+#define libcfile_group_commit_atomic_increment( value ) \
+	(uint64_t) InterlockedIncrement64( (LONGLONG volatile *) value )
+
+#define libcfile_group_commit_atomic_load( value ) \
+	(uint64_t) InterlockedCompareExchange64( (LONGLONG volatile *) value, 0, 0 )
+
+#define libcfile_group_commit_atomic_store( value, new_value ) \
+	InterlockedExchange64( (LONGLONG volatile *) value, (LONGLONG) new_value )
+
+#define libcfile_group_commit_atomic_try_lock( value ) \
+	( InterlockedCompareExchange( (LONG volatile *) value, 1, 0 ) == 0 )
+
+#define libcfile_group_commit_atomic_unlock( value ) \
+	InterlockedExchange( (LONG volatile *) value, 0 )
+
+#elif defined( __GNUC__ )
+#define libcfile_group_commit_atomic_increment( value ) \
+	__atomic_add_fetch( value, 1, __ATOMIC_SEQ_CST )
+
+#define libcfile_group_commit_atomic_load( value ) \
+	__atomic_load_n( value, __ATOMIC_ACQUIRE )
+
+#define libcfile_group_commit_atomic_store( value, new_value ) \
+	__atomic_store_n( value, new_value, __ATOMIC_RELEASE )
+
+#define libcfile_group_commit_atomic_try_lock( value ) \
+	( __atomic_exchange_n( value, 1, __ATOMIC_ACQUIRE ) == 0 )
+
+#define libcfile_group_commit_atomic_unlock( value ) \
+	__atomic_store_n( value, 0, __ATOMIC_RELEASE )
+
+#else
+/* Without atomic operations a group commit can only be used by a single thread
+ */
+#define libcfile_group_commit_atomic_increment( value ) \
+	++( *( value ) )
+
+#define libcfile_group_commit_atomic_load( value ) \
+	*( value )
+
+#define libcfile_group_commit_atomic_store( value, new_value ) \
+	*( value ) = new_value
+
+#define libcfile_group_commit_atomic_try_lock( value ) \
+	( ( *( value ) == 0 ) ? ( *( value ) = 1 ) : 0 )
+
+#define libcfile_group_commit_atomic_unlock( value ) \
+	*( value ) = 0
+
+#endif
+
+/* Suspends the calling thread for a number of nanoseconds
+ */
+void libcfile_group_commit_sleep(
+      uint64_t nanoseconds )
+{
+#if defined( WINAPI )
+	DWORD milliseconds = (DWORD) ( ( nanoseconds + 999999 ) / 1000000 );
+
+	Sleep(
+	 milliseconds );
+
+#elif defined( HAVE_NANOSLEEP )
+	struct timespec duration;
+
+	duration.tv_sec  = (time_t) ( nanoseconds / 1000000000UL );
+	duration.tv_nsec = (long) ( nanoseconds % 1000000000UL );
+
+	nanosleep(
+	 &duration,
+	 NULL );
+#endif
+}
+
+#if defined( LIBCFILE_HAVE_GROUP_COMMIT_WAIT )
+
+/* Releases the sync in progress and wakes the callers that wait for it
+ */
+void libcfile_group_commit_release(
+      libcfile_group_commit_t *group_commit )
+{
+	if( group_commit == NULL )
+	{
+		return;
+	}
+	libcfile_group_commit_atomic_unlock(
+	 &( group_commit->sync_in_progress ) );
+
+	/* The count is changed before waking the callers so that a caller that
+	 * has not started waiting yet does not wait for a sync that already ended
+	 */
+	__atomic_add_fetch(
+	 &( group_commit->sync_end_count ),
+	 1,
+	 __ATOMIC_SEQ_CST );
+
+	syscall(
+	 __NR_futex,
+	 &( group_commit->sync_end_count ),
+	 FUTEX_WAKE_PRIVATE,
+	 INT32_MAX,
+	 NULL,
+	 NULL,
+	 0 );
+}
+
+#endif /* defined( LIBCFILE_HAVE_GROUP_COMMIT_WAIT ) */
+
+/* Sets the minimum interval between the start of consecutive syncs
+ * The interval is in nanoseconds, where 0 represents that syncs are only combined
+ * with the commit requests that arrive while another sync is in progress
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_group_commit_set_interval(
+     libcfile_group_commit_t *group_commit,
+     uint64_t interval,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_group_commit_set_interval";
+
+	if( group_commit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid group commit.",
+		 function );
+
+		return( -1 );
+	}
+	if( interval > (uint64_t) LIBCFILE_MAXIMUM_GROUP_COMMIT_INTERVAL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid interval value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	libcfile_group_commit_atomic_store(
+	 &( group_commit->interval ),
+	 interval );
+
+	return( 1 );
+}
+
+/* Requests a commit
+ * The data that was written before the request is covered by the commit
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_group_commit_request(
+     libcfile_group_commit_t *group_commit,
+     uint64_t *sequence,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_group_commit_request";
+
+	if( group_commit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid group commit.",
+		 function );
+
+		return( -1 );
+	}
+	if( sequence == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sequence.",
+		 function );
+
+		return( -1 );
+	}
+	*sequence = libcfile_group_commit_atomic_increment(
+	             &( group_commit->request_sequence ) );
+
+	return( 1 );
+}
+
+/* Waits until a commit request is covered by a completed sync or the caller has to sync
+ * A caller that has to sync, syncs on behalf of all the commit requests up to the sync sequence
+ * and must call libcfile_group_commit_end afterwards
+ * The callers wait for the sync in progress on a futex, without it commit requests
+ * are not combined and every caller has to sync
+ * A request that is covered by a sync of another caller that failed, returns an error
+ * Returns 1 if the caller has to sync, 0 if the request was committed by another caller or -1 on error
+ */
+int libcfile_group_commit_begin(
+     libcfile_group_commit_t *group_commit,
+     uint64_t sequence,
+     uint64_t *sync_sequence,
+     libcerror_error_t **error )
+{
+	static char *function   = "libcfile_group_commit_begin";
+
+#if defined( LIBCFILE_HAVE_GROUP_COMMIT_WAIT )
+	uint64_t interval       = 0;
+	uint64_t timestamp      = 0;
+	uint64_t wait_time      = 0;
+	uint32_t sync_end_count = 0;
+#endif
+
+	if( group_commit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid group commit.",
+		 function );
+
+		return( -1 );
+	}
+	if( sync_sequence == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sync sequence.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCFILE_HAVE_GROUP_COMMIT_WAIT )
+	for( ;; )
+	{
+		/* The count is read before the checks so that a sync that ends
+		 * after the checks makes the wait return immediately
+		 */
+		sync_end_count = __atomic_load_n(
+		                  &( group_commit->sync_end_count ),
+		                  __ATOMIC_SEQ_CST );
+
+		if( libcfile_group_commit_atomic_load(
+		     &( group_commit->completed_sequence ) ) >= sequence )
+		{
+			/* Data of which the sync failed is not synced again since the system
+			 * can report the failure of writing the data only once
+			 */
+			if( ( sequence >= libcfile_group_commit_atomic_load(
+			                   &( group_commit->failed_first_sequence ) ) )
+			 && ( sequence <= libcfile_group_commit_atomic_load(
+			                   &( group_commit->failed_last_sequence ) ) ) )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 __atomic_load_n(
+				  &( group_commit->failed_error_code ),
+				  __ATOMIC_RELAXED ),
+				 "%s: commit request: %" PRIu64 " is covered by a failed sync.",
+				 function,
+				 sequence );
+
+				return( -1 );
+			}
+			break;
+		}
+		if( libcfile_group_commit_atomic_try_lock(
+		     &( group_commit->sync_in_progress ) ) )
+		{
+			/* Another caller could have completed a sync that covers the request
+			 * after the previous check
+			 */
+			if( libcfile_group_commit_atomic_load(
+			     &( group_commit->completed_sequence ) ) >= sequence )
+			{
+				libcfile_group_commit_release(
+				 group_commit );
+
+				break;
+			}
+			/* Delay the sync until the interval has passed so that it covers
+			 * the commit requests that arrive in the meantime
+			 */
+			interval = libcfile_group_commit_atomic_load(
+			            &( group_commit->interval ) );
+
+			timestamp = libcfile_statistics_get_timestamp();
+
+			if( ( interval > 0 )
+			 && ( timestamp != 0 )
+			 && ( timestamp < ( group_commit->sync_timestamp + interval ) ) )
+			{
+				wait_time = group_commit->sync_timestamp + interval - timestamp;
+
+				libcfile_group_commit_sleep(
+				 wait_time );
+
+				timestamp += wait_time;
+			}
+			group_commit->sync_timestamp = timestamp;
+
+			*sync_sequence = libcfile_group_commit_atomic_load(
+			                  &( group_commit->request_sequence ) );
+
+			return( 1 );
+		}
+		/* The wait returns immediately if the sync in progress ended in the meantime
+		 */
+		syscall(
+		 __NR_futex,
+		 &( group_commit->sync_end_count ),
+		 FUTEX_WAIT_PRIVATE,
+		 sync_end_count,
+		 NULL,
+		 NULL,
+		 0 );
+	}
+	return( 0 );
+#else
+	*sync_sequence = sequence;
+
+	return( 1 );
+
+#endif /* defined( LIBCFILE_HAVE_GROUP_COMMIT_WAIT ) */
+}
+
+/* Ends a sync that was started by libcfile_group_commit_begin
+ * If the sync failed the commit requests up to the sync sequence are recorded as failed,
+ * so that the callers that wait for these requests return the error instead of syncing again
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_group_commit_end(
+     libcfile_group_commit_t *group_commit,
+     uint64_t sync_sequence LIBCFILE_ATTRIBUTE_UNUSED,
+     uint8_t is_synced LIBCFILE_ATTRIBUTE_UNUSED,
+     uint32_t error_code LIBCFILE_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_group_commit_end";
+
+	if( group_commit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid group commit.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCFILE_HAVE_GROUP_COMMIT_WAIT )
+	/* Only the caller that holds the sync in progress updates the completed and failed sequences
+	 */
+	if( sync_sequence > group_commit->completed_sequence )
+	{
+		if( is_synced == 0 )
+		{
+			/* The failed range spans all failed syncs so that a caller that checks
+			 * its request after a later sync failed, still finds it as failed
+			 */
+			if( group_commit->failed_first_sequence == 0 )
+			{
+				libcfile_group_commit_atomic_store(
+				 &( group_commit->failed_first_sequence ),
+				 group_commit->completed_sequence + 1 );
+			}
+			libcfile_group_commit_atomic_store(
+			 &( group_commit->failed_last_sequence ),
+			 sync_sequence );
+
+			__atomic_store_n(
+			 &( group_commit->failed_error_code ),
+			 error_code,
+			 __ATOMIC_RELAXED );
+		}
+		libcfile_group_commit_atomic_store(
+		 &( group_commit->completed_sequence ),
+		 sync_sequence );
+	}
+	libcfile_group_commit_release(
+	 group_commit );
+#else
+	LIBCFILE_UNREFERENCED_PARAMETER( sync_sequence )
+	LIBCFILE_UNREFERENCED_PARAMETER( is_synced )
+	LIBCFILE_UNREFERENCED_PARAMETER( error_code )
+
+#endif /* defined( LIBCFILE_HAVE_GROUP_COMMIT_WAIT ) */
+
+	return( 1 );
+}
+
@@ -0,0 +1,128 @@
+/*
+ * Group commit functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCFILE_GROUP_COMMIT_H )
+#define _LIBCFILE_GROUP_COMMIT_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_LINUX_FUTEX_H ) && defined( HAVE_SYS_SYSCALL_H ) && defined( HAVE_SYSCALL ) && !defined( WINAPI )
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+/* Waiting for the sync in progress requires a futex, without it
+ * every commit request is synced by the caller that requested it
+ */
+#if defined( __NR_futex ) && defined( FUTEX_WAIT_PRIVATE ) && defined( FUTEX_WAKE_PRIVATE )
+#define LIBCFILE_HAVE_GROUP_COMMIT_WAIT	1
+#endif
+
+#endif
+
+#include "libcfile_definitions.h"
+#include "libcfile_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libcfile_group_commit libcfile_group_commit_t;
+
+struct libcfile_group_commit
+{
+	/* The minimum interval between the start of consecutive syncs in nanoseconds
+	 */
+	uint64_t interval;
+
+	/* The sequence number of the last commit request
+	 */
+	uint64_t request_sequence;
+
+	/* The sequence number of the last commit request that is covered by a completed sync
+	 */
+	uint64_t completed_sequence;
+
+	/* The timestamp of the start of the last sync
+	 */
+	uint64_t sync_timestamp;
+
+	/* Value to indicate a sync is in progress
+	 */
+	uint32_t sync_in_progress;
+
+	/* The sequence number of the first commit request that is covered by a failed sync
+	 */
+	uint64_t failed_first_sequence;
+
+	/* The sequence number of the last commit request that is covered by a failed sync
+	 */
+	uint64_t failed_last_sequence;
+
+	/* The error code of the last failed sync
+	 */
+	uint32_t failed_error_code;
+
+	/* The number of times a sync in progress ended, which callers that
+	 * wait for the sync in progress to end use as futex
+	 */
+	uint32_t sync_end_count;
+};
+
+void libcfile_group_commit_sleep(
+      uint64_t nanoseconds );
+
+#if defined( LIBCFILE_HAVE_GROUP_COMMIT_WAIT )
+
+void libcfile_group_commit_release(
+      libcfile_group_commit_t *group_commit );
+
+#endif /* defined( LIBCFILE_HAVE_GROUP_COMMIT_WAIT ) */
+
+int libcfile_group_commit_set_interval(
+     libcfile_group_commit_t *group_commit,
+     uint64_t interval,
+     libcerror_error_t **error );
+
+int libcfile_group_commit_request(
+     libcfile_group_commit_t *group_commit,
+     uint64_t *sequence,
+     libcerror_error_t **error );
+
+int libcfile_group_commit_begin(
+     libcfile_group_commit_t *group_commit,
+     uint64_t sequence,
+     uint64_t *sync_sequence,
+     libcerror_error_t **error );
+
+int libcfile_group_commit_end(
+     libcfile_group_commit_t *group_commit,
+     uint64_t sync_sequence,
+     uint8_t is_synced,
+     uint32_t error_code,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCFILE_GROUP_COMMIT_H ) */
+
@@ -0,0 +1,1240 @@
+/*
+ * Asynchronous IO ring functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_SYS_UIO_H )
+#include <sys/uio.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libcfile_definitions.h"
+#include "libcfile_io_ring.h"
+#include "libcfile_libcerror.h"
+#include "libcfile_libcnotify.h"
+#include "libcfile_unused.h"
+
+#if defined( LIBCFILE_HAVE_IO_URING )
+
+/* Sets up the kernel IO ring
+ * Returns 1 if successful, 0 if not supported by the kernel or -1 on error
+ */
+int libcfile_io_ring_setup(
+     libcfile_io_ring_t *io_ring,
+     libcerror_error_t **error )
+{
+	struct io_uring_params parameters;
+
+	static char *function = "libcfile_io_ring_setup";
+	int descriptor        = -1;
+
+	if( io_ring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO ring.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &parameters,
+	     0,
+	     sizeof( struct io_uring_params ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear parameters.",
+		 function );
+
+		return( -1 );
+	}
+	descriptor = (int) syscall(
+	                    __NR_io_uring_setup,
+	                    (unsigned int) io_ring->queue_depth,
+	                    &parameters );
+
+	if( descriptor == -1 )
+	{
+		/* The kernel does not support io_uring or its use is not permitted
+		 */
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: io_uring not available (error: %d).\n",
+			 function,
+			 errno );
+		}
+#endif
+		return( 0 );
+	}
+	if( ( parameters.features & IORING_FEAT_FAST_POLL ) == 0 )
+	{
+		/* The kernel does not support the IORING_OP_READ and IORING_OP_WRITE operations
+		 */
+		close(
+		 descriptor );
+
+		return( 0 );
+	}
+	io_ring->descriptor = descriptor;
+
+	io_ring->submission_ring_size = parameters.sq_off.array + ( parameters.sq_entries * sizeof( uint32_t ) );
+	io_ring->completion_ring_size = parameters.cq_off.cqes + ( parameters.cq_entries * sizeof( struct io_uring_cqe ) );
+
+	if( ( parameters.features & IORING_FEAT_SINGLE_MMAP ) != 0 )
+	{
+		if( io_ring->completion_ring_size > io_ring->submission_ring_size )
+		{
+			io_ring->submission_ring_size = io_ring->completion_ring_size;
+		}
+	}
+	io_ring->submission_ring = (uint8_t *) mmap(
+	                                        NULL,
+	                                        io_ring->submission_ring_size,
+	                                        PROT_READ | PROT_WRITE,
+	                                        MAP_SHARED | MAP_POPULATE,
+	                                        descriptor,
+	                                        IORING_OFF_SQ_RING );
+
+	if( io_ring->submission_ring == MAP_FAILED )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 errno,
+		 "%s: unable to map submission queue ring.",
+		 function );
+
+		io_ring->submission_ring = NULL;
+
+		goto on_error;
+	}
+	if( ( parameters.features & IORING_FEAT_SINGLE_MMAP ) != 0 )
+	{
+		io_ring->completion_ring      = io_ring->submission_ring;
+		io_ring->completion_ring_size = 0;
+	}
+	else
+	{
+		io_ring->completion_ring = (uint8_t *) mmap(
+		                                        NULL,
+		                                        io_ring->completion_ring_size,
+		                                        PROT_READ | PROT_WRITE,
+		                                        MAP_SHARED | MAP_POPULATE,
+		                                        descriptor,
+		                                        IORING_OFF_CQ_RING );
+
+		if( io_ring->completion_ring == MAP_FAILED )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 errno,
+			 "%s: unable to map completion queue ring.",
+			 function );
+
+			io_ring->completion_ring = NULL;
+
+			goto on_error;
+		}
+	}
+	io_ring->submission_entries_size = parameters.sq_entries * sizeof( struct io_uring_sqe );
+
+	io_ring->submission_entries = (struct io_uring_sqe *) mmap(
+	                                                       NULL,
+	                                                       io_ring->submission_entries_size,
+	                                                       PROT_READ | PROT_WRITE,
+	                                                       MAP_SHARED | MAP_POPULATE,
+	                                                       descriptor,
+	                                                       IORING_OFF_SQES );
+
+	if( io_ring->submission_entries == MAP_FAILED )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 errno,
+		 "%s: unable to map submission queue entries.",
+		 function );
+
+		io_ring->submission_entries = NULL;
+
+		goto on_error;
+	}
+	io_ring->submission_tail    = (uint32_t *) &( io_ring->submission_ring[ parameters.sq_off.tail ] );
+	io_ring->submission_mask    = *( (uint32_t *) &( io_ring->submission_ring[ parameters.sq_off.ring_mask ] ) );
+	io_ring->submission_array   = (uint32_t *) &( io_ring->submission_ring[ parameters.sq_off.array ] );
+	io_ring->completion_head    = (uint32_t *) &( io_ring->completion_ring[ parameters.cq_off.head ] );
+	io_ring->completion_tail    = (uint32_t *) &( io_ring->completion_ring[ parameters.cq_off.tail ] );
+	io_ring->completion_mask    = *( (uint32_t *) &( io_ring->completion_ring[ parameters.cq_off.ring_mask ] ) );
+	io_ring->completion_entries = (struct io_uring_cqe *) &( io_ring->completion_ring[ parameters.cq_off.cqes ] );
+
+	return( 1 );
+
+on_error:
+	if( io_ring->submission_entries != NULL )
+	{
+		munmap(
+		 io_ring->submission_entries,
+		 io_ring->submission_entries_size );
+
+		io_ring->submission_entries = NULL;
+	}
+	if( ( io_ring->completion_ring != NULL )
+	 && ( io_ring->completion_ring != io_ring->submission_ring ) )
+	{
+		munmap(
+		 io_ring->completion_ring,
+		 io_ring->completion_ring_size );
+	}
+	io_ring->completion_ring = NULL;
+
+	if( io_ring->submission_ring != NULL )
+	{
+		munmap(
+		 io_ring->submission_ring,
+		 io_ring->submission_ring_size );
+
+		io_ring->submission_ring = NULL;
+	}
+	close(
+	 io_ring->descriptor );
+
+	io_ring->descriptor = -1;
+
+	return( -1 );
+}
+
+/* Passes submitted requests to the kernel and optionally waits for completions
+ * Returns the number of submitted requests consumed by the kernel if successful or -1 on error
+ */
+int libcfile_io_ring_enter(
+     libcfile_io_ring_t *io_ring,
+     int number_of_submissions,
+     int minimum_number_of_completions,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_io_ring_enter";
+	unsigned int flags    = 0;
+	int result            = 0;
+
+	if( io_ring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO ring.",
+		 function );
+
+		return( -1 );
+	}
+	if( minimum_number_of_completions > 0 )
+	{
+		flags = IORING_ENTER_GETEVENTS;
+	}
+	do
+	{
+		result = (int) syscall(
+		                __NR_io_uring_enter,
+		                io_ring->descriptor,
+		                (unsigned int) number_of_submissions,
+		                (unsigned int) minimum_number_of_completions,
+		                flags,
+		                NULL,
+		                0 );
+	}
+	while( ( result == -1 )
+	    && ( errno == EINTR ) );
+
+	if( result == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 errno,
+		 "%s: unable to enter IO ring.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+#endif /* defined( LIBCFILE_HAVE_IO_URING ) */
+
+/* Creates an IO ring
+ * Make sure the value io_ring is referencing, is set to NULL
+ * If the kernel does not support asynchronous IO the IO ring only tracks
+ * the completions of requests that were handled synchronously
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_io_ring_initialize(
+     libcfile_io_ring_t **io_ring,
+     int queue_depth,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_io_ring_initialize";
+
+	if( io_ring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO ring.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_ring != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO ring value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( queue_depth <= 0 )
+	 || ( queue_depth > LIBCFILE_MAXIMUM_QUEUE_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid queue depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*io_ring = memory_allocate_structure(
+	            libcfile_io_ring_t );
+
+	if( *io_ring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create IO ring.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *io_ring,
+	     0,
+	     sizeof( libcfile_io_ring_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear IO ring.",
+		 function );
+
+		memory_free(
+		 *io_ring );
+
+		*io_ring = NULL;
+
+		return( -1 );
+	}
+	( *io_ring )->queue_depth = queue_depth;
+
+#if defined( LIBCFILE_HAVE_IO_URING )
+	( *io_ring )->descriptor = -1;
+#endif
+	( *io_ring )->completions = (libcfile_io_ring_request_t *) memory_allocate(
+	                                                            sizeof( libcfile_io_ring_request_t ) * queue_depth );
+
+	if( ( *io_ring )->completions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create completions.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( LIBCFILE_HAVE_IO_URING )
+	( *io_ring )->requests = (libcfile_io_ring_request_t *) memory_allocate(
+	                                                         sizeof( libcfile_io_ring_request_t ) * queue_depth );
+
+	if( ( *io_ring )->requests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create requests.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *io_ring )->requests,
+	     0,
+	     sizeof( libcfile_io_ring_request_t ) * queue_depth ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear requests.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_io_ring_setup(
+	     *io_ring,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to set up kernel IO ring.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *io_ring != NULL )
+	{
+#if defined( LIBCFILE_HAVE_IO_URING )
+		if( ( *io_ring )->requests != NULL )
+		{
+			memory_free(
+			 ( *io_ring )->requests );
+		}
+#endif
+		if( ( *io_ring )->completions != NULL )
+		{
+			memory_free(
+			 ( *io_ring )->completions );
+		}
+		memory_free(
+		 *io_ring );
+
+		*io_ring = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an IO ring
+ * Waits for requests that were passed to the kernel to complete, since the kernel
+ * can still access their buffers, their results are discarded
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_io_ring_free(
+     libcfile_io_ring_t **io_ring,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_io_ring_free";
+	int result            = 1;
+
+#if defined( LIBCFILE_HAVE_IO_URING )
+	uint32_t head         = 0;
+	uint32_t tail         = 0;
+#endif
+
+	if( io_ring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO ring.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_ring != NULL )
+	{
+#if defined( LIBCFILE_HAVE_IO_URING )
+		if( ( *io_ring )->descriptor != -1 )
+		{
+			while( ( *io_ring )->number_of_requests > 0 )
+			{
+				if( libcfile_io_ring_enter(
+				     *io_ring,
+				     0,
+				     ( *io_ring )->number_of_requests,
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_GENERIC,
+					 "%s: unable to wait for outstanding requests.",
+					 function );
+
+					result = -1;
+
+					break;
+				}
+				head = *( ( *io_ring )->completion_head );
+				tail = __atomic_load_n(
+				        ( *io_ring )->completion_tail,
+				        __ATOMIC_ACQUIRE );
+
+				( *io_ring )->number_of_requests -= (int) ( tail - head );
+
+				__atomic_store_n(
+				 ( *io_ring )->completion_head,
+				 tail,
+				 __ATOMIC_RELEASE );
+			}
+			munmap(
+			 ( *io_ring )->submission_entries,
+			 ( *io_ring )->submission_entries_size );
+
+			if( ( *io_ring )->completion_ring != ( *io_ring )->submission_ring )
+			{
+				munmap(
+				 ( *io_ring )->completion_ring,
+				 ( *io_ring )->completion_ring_size );
+			}
+			munmap(
+			 ( *io_ring )->submission_ring,
+			 ( *io_ring )->submission_ring_size );
+
+			if( close(
+			     ( *io_ring )->descriptor ) != 0 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 errno,
+				 "%s: unable to close kernel IO ring.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif /* defined( LIBCFILE_HAVE_IO_URING ) */
+
+		if( ( *io_ring )->registered_buffer_sizes != NULL )
+		{
+			memory_free(
+			 ( *io_ring )->registered_buffer_sizes );
+		}
+		if( ( *io_ring )->registered_buffers != NULL )
+		{
+			memory_free(
+			 ( *io_ring )->registered_buffers );
+		}
+#if defined( LIBCFILE_HAVE_IO_URING )
+		memory_free(
+		 ( *io_ring )->requests );
+#endif
+		memory_free(
+		 ( *io_ring )->completions );
+
+		memory_free(
+		 *io_ring );
+
+		*io_ring = NULL;
+	}
+	return( result );
+}
+
+/* Determines if the IO ring cannot accept more requests until completions are polled
+ * Returns 1 if full, 0 if not or -1 on error
+ */
+int libcfile_io_ring_is_full(
+     libcfile_io_ring_t *io_ring,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_io_ring_is_full";
+
+	if( io_ring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO ring.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_ring->number_of_requests + io_ring->number_of_completions ) >= io_ring->queue_depth )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Registers buffers with the IO ring
+ * Requests that use a registered buffer do not require the kernel to map the buffer for every request
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_io_ring_register_buffers(
+     libcfile_io_ring_t *io_ring,
+     uint8_t **buffers,
+     const size_t *buffer_sizes,
+     int number_of_buffers,
+     libcerror_error_t **error )
+{
+	static char *function      = "libcfile_io_ring_register_buffers";
+	int buffer_index           = 0;
+
+#if defined( LIBCFILE_HAVE_IO_URING )
+	struct iovec *io_vectors   = NULL;
+	int result                 = 0;
+#endif
+
+	if( io_ring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO ring.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_ring->registered_buffers != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO ring - registered buffers value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_buffers <= 0 )
+	 || ( number_of_buffers > LIBCFILE_MAXIMUM_NUMBER_OF_REGISTERED_BUFFERS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buffers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		if( buffers[ buffer_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid buffer: %d.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+		if( ( buffer_sizes[ buffer_index ] == 0 )
+		 || ( buffer_sizes[ buffer_index ] > (size_t) SSIZE_MAX ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid buffer size: %d value out of bounds.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+	}
+	io_ring->registered_buffers = (uint8_t **) memory_allocate(
+	                                            sizeof( uint8_t * ) * number_of_buffers );
+
+	if( io_ring->registered_buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create registered buffers.",
+		 function );
+
+		goto on_error;
+	}
+	io_ring->registered_buffer_sizes = (size_t *) memory_allocate(
+	                                               sizeof( size_t ) * number_of_buffers );
+
+	if( io_ring->registered_buffer_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create registered buffer sizes.",
+		 function );
+
+		goto on_error;
+	}
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		io_ring->registered_buffers[ buffer_index ]      = buffers[ buffer_index ];
+		io_ring->registered_buffer_sizes[ buffer_index ] = buffer_sizes[ buffer_index ];
+	}
+#if defined( LIBCFILE_HAVE_IO_URING )
+	if( io_ring->descriptor != -1 )
+	{
+		io_vectors = (struct iovec *) memory_allocate(
+		                               sizeof( struct iovec ) * number_of_buffers );
+
+		if( io_vectors == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create IO vectors.",
+			 function );
+
+			goto on_error;
+		}
+		for( buffer_index = 0;
+		     buffer_index < number_of_buffers;
+		     buffer_index++ )
+		{
+			io_vectors[ buffer_index ].iov_base = (void *) buffers[ buffer_index ];
+			io_vectors[ buffer_index ].iov_len  = buffer_sizes[ buffer_index ];
+		}
+		result = (int) syscall(
+		                __NR_io_uring_register,
+		                io_ring->descriptor,
+		                IORING_REGISTER_BUFFERS,
+		                io_vectors,
+		                (unsigned int) number_of_buffers );
+
+		memory_free(
+		 io_vectors );
+
+		if( result == -1 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 errno,
+			 "%s: unable to register buffers with kernel IO ring.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( LIBCFILE_HAVE_IO_URING ) */
+
+	io_ring->number_of_registered_buffers = number_of_buffers;
+
+	return( 1 );
+
+on_error:
+	if( io_ring->registered_buffer_sizes != NULL )
+	{
+		memory_free(
+		 io_ring->registered_buffer_sizes );
+
+		io_ring->registered_buffer_sizes = NULL;
+	}
+	if( io_ring->registered_buffers != NULL )
+	{
+		memory_free(
+		 io_ring->registered_buffers );
+
+		io_ring->registered_buffers = NULL;
+	}
+	return( -1 );
+}
+
+/* Submits a read or write request to the IO ring
+ * Requests that lie within a registered buffer use the fixed buffer variant of the operation
+ * Returns 1 if successful, 0 if the kernel IO ring is not available or -1 on error
+ */
+int libcfile_io_ring_submit(
+     libcfile_io_ring_t *io_ring,
+     int descriptor LIBCFILE_ATTRIBUTE_UNUSED,
+     uint8_t operation,
+     uint8_t *buffer,
+     size_t size,
+     off64_t offset LIBCFILE_ATTRIBUTE_UNUSED,
+     uint64_t request_identifier LIBCFILE_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	static char *function                  = "libcfile_io_ring_submit";
+
+#if defined( LIBCFILE_HAVE_IO_URING )
+	struct io_uring_sqe *submission_entry  = NULL;
+	uint32_t submission_index              = 0;
+	uint32_t tail                          = 0;
+	int buffer_index                       = 0;
+	int request_index                      = 0;
+	int result                             = 0;
+#endif
+
+	if( io_ring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO ring.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( operation != LIBCFILE_IO_RING_OPERATION_READ )
+	 && ( operation != LIBCFILE_IO_RING_OPERATION_WRITE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported operation.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_ring->number_of_requests + io_ring->number_of_completions ) >= io_ring->queue_depth )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid IO ring - queue is full.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCFILE_HAVE_IO_URING )
+	if( io_ring->descriptor == -1 )
+	{
+		return( 0 );
+	}
+	/* The queue is not full hence there is a request that is not in use
+	 */
+	request_index = io_ring->request_index;
+
+	while( io_ring->requests[ request_index ].operation != 0 )
+	{
+		request_index = ( request_index + 1 ) % io_ring->queue_depth;
+	}
+	tail             = *( io_ring->submission_tail );
+	submission_index = tail & io_ring->submission_mask;
+	submission_entry = &( io_ring->submission_entries[ submission_index ] );
+
+	if( memory_set(
+	     submission_entry,
+	     0,
+	     sizeof( struct io_uring_sqe ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear submission entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( operation == LIBCFILE_IO_RING_OPERATION_READ )
+	{
+		submission_entry->opcode = IORING_OP_READ;
+	}
+	else
+	{
+		submission_entry->opcode = IORING_OP_WRITE;
+	}
+	for( buffer_index = 0;
+	     buffer_index < io_ring->number_of_registered_buffers;
+	     buffer_index++ )
+	{
+		if( ( buffer >= io_ring->registered_buffers[ buffer_index ] )
+		 && ( size <= io_ring->registered_buffer_sizes[ buffer_index ] )
+		 && ( (size_t) ( buffer - io_ring->registered_buffers[ buffer_index ] ) <= ( io_ring->registered_buffer_sizes[ buffer_index ] - size ) ) )
+		{
+			if( operation == LIBCFILE_IO_RING_OPERATION_READ )
+			{
+				submission_entry->opcode = IORING_OP_READ_FIXED;
+			}
+			else
+			{
+				submission_entry->opcode = IORING_OP_WRITE_FIXED;
+			}
+			submission_entry->buf_index = (uint16_t) buffer_index;
+
+			break;
+		}
+	}
+	submission_entry->fd        = descriptor;
+	submission_entry->off       = (uint64_t) offset;
+	submission_entry->addr      = (uint64_t) (uintptr_t) buffer;
+	submission_entry->len       = (uint32_t) size;
+	submission_entry->user_data = (uint64_t) request_index;
+
+	io_ring->submission_array[ submission_index ] = submission_index;
+
+	__atomic_store_n(
+	 io_ring->submission_tail,
+	 tail + 1,
+	 __ATOMIC_RELEASE );
+
+	result = libcfile_io_ring_enter(
+	          io_ring,
+	          1,
+	          0,
+	          error );
+
+	if( result != 1 )
+	{
+		/* The kernel did not consume the submission entry hence it is removed
+		 * from the submission queue so that it is not submitted with a next request
+		 */
+		__atomic_store_n(
+		 io_ring->submission_tail,
+		 tail,
+		 __ATOMIC_RELEASE );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to submit request.",
+			 function );
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to submit request - request was not consumed.",
+			 function );
+		}
+		return( -1 );
+	}
+	io_ring->requests[ request_index ].identifier = request_identifier;
+	io_ring->requests[ request_index ].offset     = offset;
+	io_ring->requests[ request_index ].size       = size;
+	io_ring->requests[ request_index ].result     = 0;
+	io_ring->requests[ request_index ].operation  = operation;
+
+	io_ring->request_index       = ( request_index + 1 ) % io_ring->queue_depth;
+	io_ring->number_of_requests += 1;
+
+	return( 1 );
+#else
+	LIBCFILE_UNREFERENCED_PARAMETER( descriptor )
+	LIBCFILE_UNREFERENCED_PARAMETER( offset )
+	LIBCFILE_UNREFERENCED_PARAMETER( request_identifier )
+
+	return( 0 );
+
+#endif /* defined( LIBCFILE_HAVE_IO_URING ) */
+}
+
+/* Appends the completion of a request that was handled synchronously
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_io_ring_append_completion(
+     libcfile_io_ring_t *io_ring,
+     uint64_t request_identifier,
+     uint8_t operation,
+     off64_t offset,
+     size_t size,
+     ssize_t result,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_io_ring_append_completion";
+
+	if( io_ring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO ring.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_ring->number_of_requests + io_ring->number_of_completions ) >= io_ring->queue_depth )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid IO ring - queue is full.",
+		 function );
+
+		return( -1 );
+	}
+	io_ring->completions[ io_ring->number_of_completions ].identifier = request_identifier;
+	io_ring->completions[ io_ring->number_of_completions ].offset     = offset;
+	io_ring->completions[ io_ring->number_of_completions ].size       = size;
+	io_ring->completions[ io_ring->number_of_completions ].result     = result;
+	io_ring->completions[ io_ring->number_of_completions ].operation  = operation;
+
+	io_ring->number_of_completions += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the completions of submitted requests
+ * Waits until at least minimum_number_of_completions requests have completed,
+ * where the minimum is limited to the number of outstanding requests
+ * The result of a request is the number of bytes read or written or the negated system error code
+ * Returns the number of completions if successful or -1 on error
+ */
+int libcfile_io_ring_poll(
+     libcfile_io_ring_t *io_ring,
+     libcfile_io_ring_request_t *completions,
+     int maximum_number_of_completions,
+     int minimum_number_of_completions,
+     libcerror_error_t **error )
+{
+	static char *function                    = "libcfile_io_ring_poll";
+	int completion_index                     = 0;
+	int number_of_completions                = 0;
+
+#if defined( LIBCFILE_HAVE_IO_URING )
+	struct io_uring_cqe *completion_entry    = NULL;
+	uint32_t head                            = 0;
+	uint32_t tail                            = 0;
+	int request_index                        = 0;
+#endif
+
+	if( io_ring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO ring.",
+		 function );
+
+		return( -1 );
+	}
+	if( completions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid completions.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_completions <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of completions value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( minimum_number_of_completions < 0 )
+	 || ( minimum_number_of_completions > maximum_number_of_completions ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid minimum number of completions value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Completions of requests that were handled synchronously are returned first
+	 */
+	while( ( io_ring->number_of_completions > 0 )
+	    && ( number_of_completions < maximum_number_of_completions ) )
+	{
+		completions[ number_of_completions ] = io_ring->completions[ completion_index ];
+
+		completion_index++;
+		number_of_completions++;
+
+		io_ring->number_of_completions -= 1;
+	}
+	if( completion_index > 0 )
+	{
+		for( completion_index = 0;
+		     completion_index < io_ring->number_of_completions;
+		     completion_index++ )
+		{
+			io_ring->completions[ completion_index ] = io_ring->completions[ number_of_completions + completion_index ];
+		}
+	}
+#if defined( LIBCFILE_HAVE_IO_URING )
+	if( io_ring->descriptor == -1 )
+	{
+		return( number_of_completions );
+	}
+	if( ( minimum_number_of_completions - number_of_completions ) > io_ring->number_of_requests )
+	{
+		minimum_number_of_completions = number_of_completions + io_ring->number_of_requests;
+	}
+	while( ( io_ring->number_of_requests > 0 )
+	    && ( number_of_completions < maximum_number_of_completions ) )
+	{
+		head = *( io_ring->completion_head );
+		tail = __atomic_load_n(
+		        io_ring->completion_tail,
+		        __ATOMIC_ACQUIRE );
+
+		while( ( head != tail )
+		    && ( number_of_completions < maximum_number_of_completions ) )
+		{
+			completion_entry = &( io_ring->completion_entries[ head & io_ring->completion_mask ] );
+			request_index    = (int) completion_entry->user_data;
+
+			completions[ number_of_completions ]        = io_ring->requests[ request_index ];
+			completions[ number_of_completions ].result = (ssize_t) completion_entry->res;
+
+			io_ring->requests[ request_index ].operation = 0;
+
+			head++;
+			number_of_completions++;
+
+			io_ring->number_of_requests -= 1;
+		}
+		__atomic_store_n(
+		 io_ring->completion_head,
+		 head,
+		 __ATOMIC_RELEASE );
+
+		if( number_of_completions >= minimum_number_of_completions )
+		{
+			break;
+		}
+		if( libcfile_io_ring_enter(
+		     io_ring,
+		     0,
+		     minimum_number_of_completions - number_of_completions,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to wait for completions.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif /* defined( LIBCFILE_HAVE_IO_URING ) */
+
+	return( number_of_completions );
+}
+
@@ -0,0 +1,238 @@
+/*
+ * Asynchronous IO ring functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCFILE_IO_RING_H )
+#define _LIBCFILE_IO_RING_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_LINUX_IO_URING_H ) && defined( HAVE_SYS_SYSCALL_H ) && defined( HAVE_SYSCALL ) && defined( HAVE_MMAP ) && !defined( WINAPI )
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+
+/* IORING_FEAT_FAST_POLL was introduced in the same kernel version
+ * as the IORING_OP_READ and IORING_OP_WRITE operations
+ */
+#if defined( __NR_io_uring_setup ) && defined( __NR_io_uring_enter ) && defined( __NR_io_uring_register ) && defined( IORING_FEAT_FAST_POLL )
+#define LIBCFILE_HAVE_IO_URING	1
+#endif
+
+#endif
+
+#include "libcfile_definitions.h"
+#include "libcfile_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libcfile_io_ring_request libcfile_io_ring_request_t;
+
+struct libcfile_io_ring_request
+{
+	/* The request identifier
+	 */
+	uint64_t identifier;
+
+	/* The offset
+	 */
+	off64_t offset;
+
+	/* The size
+	 */
+	size_t size;
+
+	/* The result, the number of bytes read or written or the negated system error code
+	 */
+	ssize_t result;
+
+	/* The operation, 0 if the request is not in use
+	 */
+	uint8_t operation;
+};
+
+typedef struct libcfile_io_ring libcfile_io_ring_t;
+
+struct libcfile_io_ring
+{
+	/* The queue depth
+	 */
+	int queue_depth;
+
+	/* The number of requests passed to the kernel that have not completed
+	 */
+	int number_of_requests;
+
+	/* The completions of the requests that were handled synchronously
+	 */
+	libcfile_io_ring_request_t *completions;
+
+	/* The number of completions that were handled synchronously
+	 */
+	int number_of_completions;
+
+	/* The registered buffers
+	 */
+	uint8_t **registered_buffers;
+
+	/* The registered buffer sizes
+	 */
+	size_t *registered_buffer_sizes;
+
+	/* The number of registered buffers
+	 */
+	int number_of_registered_buffers;
+
+#if defined( LIBCFILE_HAVE_IO_URING )
+	/* The requests passed to the kernel, indexed by the user data of their submission entry
+	 */
+	libcfile_io_ring_request_t *requests;
+
+	/* The index of the next request to use
+	 */
+	int request_index;
+
+	/* The ring (file) descriptor
+	 */
+	int descriptor;
+
+	/* The submission queue ring
+	 */
+	uint8_t *submission_ring;
+
+	/* The submission queue ring size
+	 */
+	size_t submission_ring_size;
+
+	/* The completion queue ring
+	 */
+	uint8_t *completion_ring;
+
+	/* The completion queue ring size
+	 */
+	size_t completion_ring_size;
+
+	/* The submission queue entries
+	 */
+	struct io_uring_sqe *submission_entries;
+
+	/* The submission queue entries size
+	 */
+	size_t submission_entries_size;
+
+	/* The submission queue tail
+	 */
+	uint32_t *submission_tail;
+
+	/* The submission queue ring mask
+	 */
+	uint32_t submission_mask;
+
+	/* The submission queue index array
+	 */
+	uint32_t *submission_array;
+
+	/* The completion queue head
+	 */
+	uint32_t *completion_head;
+
+	/* The completion queue tail
+	 */
+	uint32_t *completion_tail;
+
+	/* The completion queue ring mask
+	 */
+	uint32_t completion_mask;
+
+	/* The completion queue entries
+	 */
+	struct io_uring_cqe *completion_entries;
+
+#endif /* defined( LIBCFILE_HAVE_IO_URING ) */
+};
+
+#if defined( LIBCFILE_HAVE_IO_URING )
+
+int libcfile_io_ring_setup(
+     libcfile_io_ring_t *io_ring,
+     libcerror_error_t **error );
+
+int libcfile_io_ring_enter(
+     libcfile_io_ring_t *io_ring,
+     int number_of_submissions,
+     int minimum_number_of_completions,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBCFILE_HAVE_IO_URING ) */
+
+int libcfile_io_ring_initialize(
+     libcfile_io_ring_t **io_ring,
+     int queue_depth,
+     libcerror_error_t **error );
+
+int libcfile_io_ring_free(
+     libcfile_io_ring_t **io_ring,
+     libcerror_error_t **error );
+
+int libcfile_io_ring_is_full(
+     libcfile_io_ring_t *io_ring,
+     libcerror_error_t **error );
+
+int libcfile_io_ring_register_buffers(
+     libcfile_io_ring_t *io_ring,
+     uint8_t **buffers,
+     const size_t *buffer_sizes,
+     int number_of_buffers,
+     libcerror_error_t **error );
+
+int libcfile_io_ring_submit(
+     libcfile_io_ring_t *io_ring,
+     int descriptor,
+     uint8_t operation,
+     uint8_t *buffer,
+     size_t size,
+     off64_t offset,
+     uint64_t request_identifier,
+     libcerror_error_t **error );
+
+int libcfile_io_ring_append_completion(
+     libcfile_io_ring_t *io_ring,
+     uint64_t request_identifier,
+     uint8_t operation,
+     off64_t offset,
+     size_t size,
+     ssize_t result,
+     libcerror_error_t **error );
+
+int libcfile_io_ring_poll(
+     libcfile_io_ring_t *io_ring,
+     libcfile_io_ring_request_t *completions,
+     int maximum_number_of_completions,
+     int minimum_number_of_completions,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCFILE_IO_RING_H ) */
+
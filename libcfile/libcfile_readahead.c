@@ -0,0 +1,438 @@
+/*
+ * Readahead functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcfile_definitions.h"
+#include "libcfile_libcerror.h"
+#include "libcfile_readahead.h"
+
+/* Creates a readahead
+ * Make sure the value readahead is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_readahead_initialize(
+     libcfile_readahead_t **readahead,
+     size_t maximum_window_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_readahead_initialize";
+
+	if( readahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid readahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( *readahead != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid readahead value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_window_size == 0 )
+	 || ( maximum_window_size > (size_t) LIBCFILE_MAXIMUM_READAHEAD_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum window size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*readahead = memory_allocate_structure(
+	              libcfile_readahead_t );
+
+	if( *readahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create readahead.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *readahead,
+	     0,
+	     sizeof( libcfile_readahead_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear readahead.",
+		 function );
+
+		goto on_error;
+	}
+	( *readahead )->minimum_window_size = (size_t) LIBCFILE_MINIMUM_READAHEAD_SIZE;
+	( *readahead )->maximum_window_size = maximum_window_size;
+
+	if( ( *readahead )->minimum_window_size > maximum_window_size )
+	{
+		( *readahead )->minimum_window_size = maximum_window_size;
+	}
+	if( libcfile_readahead_reset(
+	     *readahead,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to reset readahead.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *readahead != NULL )
+	{
+		memory_free(
+		 *readahead );
+
+		*readahead = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a readahead
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_readahead_free(
+     libcfile_readahead_t **readahead,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_readahead_free";
+
+	if( readahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid readahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( *readahead != NULL )
+	{
+		memory_free(
+		 *readahead );
+
+		*readahead = NULL;
+	}
+	return( 1 );
+}
+
+/* Resets a readahead, forgetting the detected stream
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_readahead_reset(
+     libcfile_readahead_t *readahead,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_readahead_reset";
+
+	if( readahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid readahead.",
+		 function );
+
+		return( -1 );
+	}
+	readahead->window_size       = readahead->minimum_window_size;
+	readahead->previous_offset   = -1;
+	readahead->previous_size     = 0;
+	readahead->stride            = 0;
+	readahead->number_of_hits    = 0;
+	readahead->prefetched_offset = 0;
+	readahead->range_offset      = 0;
+	readahead->range_end_offset  = 0;
+
+	return( 1 );
+}
+
+/* Updates the readahead with the range of a read
+ * A read that continues where the previous read ended follows a sequential stream,
+ * a read that is a fixed distance from the previous read follows a strided stream.
+ * The window grows every time the prefetched data is used and shrinks on reads
+ * that do not follow the stream. Use libcfile_readahead_get_range to retrieve
+ * the ranges to prefetch.
+ * Returns 1 if there are ranges to prefetch, 0 if not or -1 on error
+ */
+int libcfile_readahead_update(
+     libcfile_readahead_t *readahead,
+     off64_t offset,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function          = "libcfile_readahead_update";
+	off64_t end_offset             = 0;
+	off64_t stride                 = -1;
+	int number_of_ranges           = 0;
+	int number_of_remaining_ranges = 0;
+
+	if( readahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid readahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	readahead->range_offset     = 0;
+	readahead->range_end_offset = 0;
+
+	if( ( size == 0 )
+	 || ( offset > ( (off64_t) INT64_MAX - (off64_t) size - (off64_t) LIBCFILE_MAXIMUM_READAHEAD_SIZE ) ) )
+	{
+		return( 0 );
+	}
+	end_offset = offset + (off64_t) size;
+
+	if( readahead->previous_offset != -1 )
+	{
+		if( offset == ( readahead->previous_offset + (off64_t) readahead->previous_size ) )
+		{
+			stride = 0;
+		}
+		else if( offset > readahead->previous_offset )
+		{
+			stride = offset - readahead->previous_offset;
+		}
+	}
+	readahead->previous_offset = offset;
+	readahead->previous_size   = size;
+
+	if( ( stride == -1 )
+	 || ( stride != readahead->stride ) )
+	{
+		/* The read does not follow the stream
+		 */
+		if( readahead->number_of_hits > 0 )
+		{
+			readahead->window_size /= 2;
+
+			if( readahead->window_size < readahead->minimum_window_size )
+			{
+				readahead->window_size = readahead->minimum_window_size;
+			}
+		}
+		readahead->stride            = ( stride > 0 ) ? stride : 0;
+		readahead->number_of_hits    = 0;
+		readahead->prefetched_offset = 0;
+
+		return( 0 );
+	}
+	readahead->number_of_hits += 1;
+
+	if( readahead->number_of_hits < LIBCFILE_READAHEAD_NUMBER_OF_HITS )
+	{
+		return( 0 );
+	}
+	if( stride == 0 )
+	{
+		/* Start a new prefetch when less than half the window is left
+		 */
+		if( readahead->prefetched_offset > end_offset )
+		{
+			if( ( readahead->prefetched_offset - end_offset ) >= (off64_t) ( readahead->window_size / 2 ) )
+			{
+				return( 0 );
+			}
+			readahead->window_size *= 2;
+
+			if( readahead->window_size > readahead->maximum_window_size )
+			{
+				readahead->window_size = readahead->maximum_window_size;
+			}
+		}
+		else
+		{
+			readahead->prefetched_offset = end_offset;
+		}
+		readahead->range_offset     = readahead->prefetched_offset;
+		readahead->range_end_offset = end_offset + (off64_t) readahead->window_size;
+	}
+	else
+	{
+		number_of_ranges = (int) ( readahead->window_size / size );
+
+		if( number_of_ranges < 1 )
+		{
+			number_of_ranges = 1;
+		}
+		else if( number_of_ranges > LIBCFILE_MAXIMUM_NUMBER_OF_READAHEAD_RANGES )
+		{
+			number_of_ranges = LIBCFILE_MAXIMUM_NUMBER_OF_READAHEAD_RANGES;
+		}
+		if( stride > ( ( (off64_t) INT64_MAX - end_offset ) / ( number_of_ranges + 1 ) ) )
+		{
+			return( 0 );
+		}
+		/* Start a new prefetch when less than half the ranges are left
+		 */
+		if( readahead->prefetched_offset > offset )
+		{
+			number_of_remaining_ranges = (int) ( ( readahead->prefetched_offset - offset ) / stride ) - 1;
+
+			if( number_of_remaining_ranges >= ( number_of_ranges / 2 ) )
+			{
+				return( 0 );
+			}
+			readahead->window_size *= 2;
+
+			if( readahead->window_size > readahead->maximum_window_size )
+			{
+				readahead->window_size = readahead->maximum_window_size;
+			}
+		}
+		else
+		{
+			readahead->prefetched_offset = offset + stride;
+		}
+		readahead->range_offset     = readahead->prefetched_offset;
+		readahead->range_end_offset = offset + ( stride * ( number_of_ranges + 1 ) );
+	}
+	if( readahead->range_offset >= readahead->range_end_offset )
+	{
+		return( 0 );
+	}
+	readahead->prefetched_offset = readahead->range_end_offset;
+
+	return( 1 );
+}
+
+/* Retrieves the next range to prefetch
+ * Returns 1 if successful, 0 if there are no more ranges or -1 on error
+ */
+int libcfile_readahead_get_range(
+     libcfile_readahead_t *readahead,
+     off64_t *range_offset,
+     size64_t *range_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_readahead_get_range";
+
+	if( readahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid readahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range size.",
+		 function );
+
+		return( -1 );
+	}
+	if( readahead->range_offset >= readahead->range_end_offset )
+	{
+		return( 0 );
+	}
+	*range_offset = readahead->range_offset;
+
+	if( readahead->stride == 0 )
+	{
+		*range_size = (size64_t) ( readahead->range_end_offset - readahead->range_offset );
+
+		readahead->range_offset = readahead->range_end_offset;
+	}
+	else
+	{
+		*range_size = (size64_t) readahead->previous_size;
+
+		readahead->range_offset += readahead->stride;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,110 @@
+/*
+ * Readahead functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCFILE_READAHEAD_H )
+#define _LIBCFILE_READAHEAD_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcfile_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libcfile_readahead libcfile_readahead_t;
+
+struct libcfile_readahead
+{
+	/* The minimum window size
+	 */
+	size_t minimum_window_size;
+
+	/* The maximum window size
+	 */
+	size_t maximum_window_size;
+
+	/* The current window size
+	 */
+	size_t window_size;
+
+	/* The offset of the previous read or -1 if not set
+	 */
+	off64_t previous_offset;
+
+	/* The size of the previous read
+	 */
+	size_t previous_size;
+
+	/* The stride between the offsets of consecutive reads
+	 * or 0 if the reads are sequential
+	 */
+	off64_t stride;
+
+	/* The number of consecutive reads that followed the stream
+	 */
+	int number_of_hits;
+
+	/* The offset up to which data was prefetched
+	 */
+	off64_t prefetched_offset;
+
+	/* The offset of the next range to prefetch
+	 */
+	off64_t range_offset;
+
+	/* The end offset of the ranges to prefetch
+	 */
+	off64_t range_end_offset;
+};
+
+int libcfile_readahead_initialize(
+     libcfile_readahead_t **readahead,
+     size_t maximum_window_size,
+     libcerror_error_t **error );
+
+int libcfile_readahead_free(
+     libcfile_readahead_t **readahead,
+     libcerror_error_t **error );
+
+int libcfile_readahead_reset(
+     libcfile_readahead_t *readahead,
+     libcerror_error_t **error );
+
+int libcfile_readahead_update(
+     libcfile_readahead_t *readahead,
+     off64_t offset,
+     size_t size,
+     libcerror_error_t **error );
+
+int libcfile_readahead_get_range(
+     libcfile_readahead_t *readahead,
+     off64_t *range_offset,
+     size64_t *range_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCFILE_READAHEAD_H ) */
+
@@ -0,0 +1,409 @@
+/*
+ * Input/output statistics functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_CLOCK_GETTIME ) && !defined( WINAPI )
+#include <time.h>
+#endif
+
+#include "libcfile_definitions.h"
+#include "libcfile_libcerror.h"
+#include "libcfile_statistics.h"
+
+/* The counters are updated with relaxed atomic operations so that
+ * they can be maintained without locking
+ */
+#if defined( WINAPI )
+#define libcfile_statistics_atomic_add( value, increment ) \
+	InterlockedExchangeAdd64( (LONGLONG volatile *) value, (LONGLONG) increment )
+
+#define libcfile_statistics_atomic_load( value ) \
+	(uint64_t) InterlockedCompareExchange64( (LONGLONG volatile *) value, 0, 0 )
+
+#define libcfile_statistics_atomic_store( value, new_value ) \
+	InterlockedExchange64( (LONGLONG volatile *) value, (LONGLONG) new_value )
+
+#elif defined( __GNUC__ )
+#define libcfile_statistics_atomic_add( value, increment ) \
+	__atomic_fetch_add( value, increment, __ATOMIC_RELAXED )
+
+#define libcfile_statistics_atomic_load( value ) \
+	__atomic_load_n( value, __ATOMIC_RELAXED )
+
+#define libcfile_statistics_atomic_store( value, new_value ) \
+	__atomic_store_n( value, new_value, __ATOMIC_RELAXED )
+
+#elif defined( HAVE_LIBCFILE_STATISTICS )
+#error Missing atomic functions
+
+#else
+#define libcfile_statistics_atomic_add( value, increment ) \
+	*( value ) += increment
+
+#define libcfile_statistics_atomic_load( value ) \
+	*( value )
+
+#define libcfile_statistics_atomic_store( value, new_value ) \
+	*( value ) = new_value
+
+#endif
+
+/* Retrieves a monotonic timestamp
+ * Returns the timestamp in nanoseconds or 0 if not available
+ */
+uint64_t libcfile_statistics_get_timestamp(
+          void )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+	if( QueryPerformanceFrequency(
+	     &frequency ) == 0 )
+	{
+		return( 0 );
+	}
+	if( QueryPerformanceCounter(
+	     &counter ) == 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) ( counter.QuadPart / frequency.QuadPart ) * 1000000000UL )
+	      + ( (uint64_t) ( counter.QuadPart % frequency.QuadPart ) * 1000000000UL / (uint64_t) frequency.QuadPart ) );
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec timestamp;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &timestamp ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) timestamp.tv_sec * 1000000000UL ) + (uint64_t) timestamp.tv_nsec );
+
+#else
+	return( 0 );
+#endif
+}
+
+/* Adds an operation to the statistics
+ * The count is the number of bytes of the operation or -1 if the operation failed
+ * This function is called on every operation and therefore does not report errors
+ */
+void libcfile_statistics_add_operation(
+      libcfile_statistics_t *statistics,
+      int operation_type,
+      ssize_t count,
+      uint64_t start_timestamp )
+{
+	uint64_t latency    = 0;
+	uint64_t timestamp  = 0;
+	int bucket_index    = 0;
+	int operation_index = 0;
+
+	if( statistics == NULL )
+	{
+		return;
+	}
+	if( ( operation_type < LIBCFILE_OPERATION_TYPE_READ )
+	 || ( operation_type > LIBCFILE_NUMBER_OF_OPERATION_TYPES ) )
+	{
+		return;
+	}
+	operation_index = operation_type - 1;
+
+	libcfile_statistics_atomic_add(
+	 &( statistics->number_of_operations[ operation_index ] ),
+	 1 );
+
+	if( count > 0 )
+	{
+		libcfile_statistics_atomic_add(
+		 &( statistics->number_of_bytes[ operation_index ] ),
+		 (uint64_t) count );
+	}
+	timestamp = libcfile_statistics_get_timestamp();
+
+	if( timestamp > start_timestamp )
+	{
+		latency = timestamp - start_timestamp;
+	}
+	while( ( latency > 1 )
+	    && ( bucket_index < ( LIBCFILE_NUMBER_OF_LATENCY_BUCKETS - 1 ) ) )
+	{
+		latency >>= 1;
+
+		bucket_index++;
+	}
+	libcfile_statistics_atomic_add(
+	 &( statistics->latency_histograms[ operation_index ][ bucket_index ] ),
+	 1 );
+}
+
+/* Adds bytes that were read but not requested to the statistics
+ * This function is called on every operation and therefore does not report errors
+ */
+void libcfile_statistics_add_read_amplification(
+      libcfile_statistics_t *statistics,
+      size_t number_of_bytes )
+{
+	if( statistics == NULL )
+	{
+		return;
+	}
+	libcfile_statistics_atomic_add(
+	 &( statistics->read_amplification ),
+	 (uint64_t) number_of_bytes );
+}
+
+/* Resets the statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_statistics_reset(
+     libcfile_statistics_t *statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_statistics_reset";
+	int bucket_index      = 0;
+	int operation_index   = 0;
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	for( operation_index = 0;
+	     operation_index < LIBCFILE_NUMBER_OF_OPERATION_TYPES;
+	     operation_index++ )
+	{
+		libcfile_statistics_atomic_store(
+		 &( statistics->number_of_operations[ operation_index ] ),
+		 0 );
+
+		libcfile_statistics_atomic_store(
+		 &( statistics->number_of_bytes[ operation_index ] ),
+		 0 );
+
+		for( bucket_index = 0;
+		     bucket_index < LIBCFILE_NUMBER_OF_LATENCY_BUCKETS;
+		     bucket_index++ )
+		{
+			libcfile_statistics_atomic_store(
+			 &( statistics->latency_histograms[ operation_index ][ bucket_index ] ),
+			 0 );
+		}
+	}
+	libcfile_statistics_atomic_store(
+	 &( statistics->read_amplification ),
+	 0 );
+
+	return( 1 );
+}
+
+/* Retrieves the number of operations and bytes of a specific operation type
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_statistics_get_operation(
+     libcfile_statistics_t *statistics,
+     int operation_type,
+     uint64_t *number_of_operations,
+     uint64_t *number_of_bytes,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_statistics_get_operation";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( operation_type < LIBCFILE_OPERATION_TYPE_READ )
+	 || ( operation_type > LIBCFILE_NUMBER_OF_OPERATION_TYPES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported operation type: %d.",
+		 function,
+		 operation_type );
+
+		return( -1 );
+	}
+	if( number_of_operations == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of operations.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bytes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of bytes.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_operations = libcfile_statistics_atomic_load(
+	                         &( statistics->number_of_operations[ operation_type - 1 ] ) );
+
+	*number_of_bytes = libcfile_statistics_atomic_load(
+	                    &( statistics->number_of_bytes[ operation_type - 1 ] ) );
+
+	return( 1 );
+}
+
+/* Retrieves the number of bytes read that were not requested
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_statistics_get_read_amplification(
+     libcfile_statistics_t *statistics,
+     uint64_t *number_of_bytes,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_statistics_get_read_amplification";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bytes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of bytes.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_bytes = libcfile_statistics_atomic_load(
+	                    &( statistics->read_amplification ) );
+
+	return( 1 );
+}
+
+/* Retrieves the latency histogram of a specific operation type
+ * At most LIBCFILE_NUMBER_OF_LATENCY_BUCKETS buckets are retrieved
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_statistics_get_latency_histogram(
+     libcfile_statistics_t *statistics,
+     int operation_type,
+     uint64_t *histogram,
+     int number_of_buckets,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_statistics_get_latency_histogram";
+	int bucket_index      = 0;
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( operation_type < LIBCFILE_OPERATION_TYPE_READ )
+	 || ( operation_type > LIBCFILE_NUMBER_OF_OPERATION_TYPES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported operation type: %d.",
+		 function,
+		 operation_type );
+
+		return( -1 );
+	}
+	if( histogram == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid histogram.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_buckets < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of buckets value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_buckets > LIBCFILE_NUMBER_OF_LATENCY_BUCKETS )
+	{
+		number_of_buckets = LIBCFILE_NUMBER_OF_LATENCY_BUCKETS;
+	}
+	for( bucket_index = 0;
+	     bucket_index < number_of_buckets;
+	     bucket_index++ )
+	{
+		histogram[ bucket_index ] = libcfile_statistics_atomic_load(
+		                             &( statistics->latency_histograms[ operation_type - 1 ][ bucket_index ] ) );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,97 @@
+/*
+ * Input/output statistics functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCFILE_STATISTICS_H )
+#define _LIBCFILE_STATISTICS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcfile_definitions.h"
+#include "libcfile_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libcfile_statistics libcfile_statistics_t;
+
+struct libcfile_statistics
+{
+	/* The number of operations per operation type
+	 */
+	uint64_t number_of_operations[ LIBCFILE_NUMBER_OF_OPERATION_TYPES ];
+
+	/* The number of bytes per operation type
+	 */
+	uint64_t number_of_bytes[ LIBCFILE_NUMBER_OF_OPERATION_TYPES ];
+
+	/* The number of bytes read that were not requested
+	 */
+	uint64_t read_amplification;
+
+	/* The latency histograms per operation type
+	 */
+	uint64_t latency_histograms[ LIBCFILE_NUMBER_OF_OPERATION_TYPES ][ LIBCFILE_NUMBER_OF_LATENCY_BUCKETS ];
+};
+
+uint64_t libcfile_statistics_get_timestamp(
+          void );
+
+void libcfile_statistics_add_operation(
+      libcfile_statistics_t *statistics,
+      int operation_type,
+      ssize_t count,
+      uint64_t start_timestamp );
+
+void libcfile_statistics_add_read_amplification(
+      libcfile_statistics_t *statistics,
+      size_t number_of_bytes );
+
+int libcfile_statistics_reset(
+     libcfile_statistics_t *statistics,
+     libcerror_error_t **error );
+
+int libcfile_statistics_get_operation(
+     libcfile_statistics_t *statistics,
+     int operation_type,
+     uint64_t *number_of_operations,
+     uint64_t *number_of_bytes,
+     libcerror_error_t **error );
+
+int libcfile_statistics_get_read_amplification(
+     libcfile_statistics_t *statistics,
+     uint64_t *number_of_bytes,
+     libcerror_error_t **error );
+
+int libcfile_statistics_get_latency_histogram(
+     libcfile_statistics_t *statistics,
+     int operation_type,
+     uint64_t *histogram,
+     int number_of_buckets,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCFILE_STATISTICS_H ) */
+
@@ -109,6 +109,36 @@ int libcfile_set_codepage(
 
 #endif /* !defined( HAVE_LOCAL_LIBCFILE ) */
 
+/* Determines if a file exists
+ * Returns 1 if the file exists, 0 if not or -1 on error
+ */
+int libcfile_file_exists(
+     const char *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_file_exists";
+	uint32_t error_code   = 0;
+	int result            = 0;
+
+	result = libcfile_file_exists_with_error_code(
+	          filename,
+	          &error_code,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if file exists.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 #if defined( WINAPI )
 
 /* Determines if a file exists
@@ -116,13 +146,13 @@ int libcfile_set_codepage(
  * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
  * Returns 1 if the file exists, 0 if not or -1 on error
  */
-int libcfile_file_exists(
+int libcfile_file_exists_with_error_code(
      const char *filename,
+     uint32_t *error_code,
      libcerror_error_t **error )
 {
-	static char *function  = "libcfile_file_exists";
+	static char *function  = "libcfile_file_exists_with_error_code";
 	size_t filename_length = 0;
-	DWORD error_code       = 0;
 	DWORD file_attributes  = 0;
 	HANDLE handle          = INVALID_HANDLE_VALUE;
 	int is_device_filename = 0;
@@ -139,6 +169,17 @@ int libcfile_file_exists(
 
 		return( -1 );
 	}
+	if( error_code == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
+		 function );
+
+		return( -1 );
+	}
 	filename_length = narrow_string_length(
 	                   filename );
 
@@ -182,9 +223,9 @@ int libcfile_file_exists(
 #endif
 		if( handle == INVALID_HANDLE_VALUE )
 		{
-			error_code = (uint32_t) GetLastError();
+			*error_code = (uint32_t) GetLastError();
 
-			switch( error_code )
+			switch( *error_code )
 			{
 				case ERROR_ACCESS_DENIED:
 					result = 1;
@@ -202,7 +243,7 @@ int libcfile_file_exists(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_IO,
 					 LIBCERROR_IO_ERROR_OPEN_FAILED,
-					 error_code,
+					 *error_code,
 					 "%s: unable to open file: %s.",
 					 function,
 					 filename );
@@ -221,13 +262,13 @@ int libcfile_file_exists(
 #endif
 			if( result == 0 )
 			{
-				error_code = GetLastError();
+				*error_code = (uint32_t) GetLastError();
 
 				libcerror_system_set_error(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_IO,
 				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-				 error_code,
+				 *error_code,
 				 "%s: unable to close file.",
 				 function );
 
@@ -249,9 +290,9 @@ int libcfile_file_exists(
 #endif
 		if( file_attributes == INVALID_FILE_ATTRIBUTES )
 		{
-			error_code = GetLastError();
+			*error_code = (uint32_t) GetLastError();
 
-			switch( error_code )
+			switch( *error_code )
 			{
 				case ERROR_ACCESS_DENIED:
 					result = 1;
@@ -269,7 +310,7 @@ int libcfile_file_exists(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_IO,
 					 LIBCERROR_IO_ERROR_GENERIC,
-					 error_code,
+					 *error_code,
 					 "%s: unable to determine attributes of file: %s.",
 					 function,
 					 filename );
@@ -287,13 +328,14 @@ int libcfile_file_exists(
  * This function uses the POSIX stat function or equivalent
  * Returns 1 if the file exists, 0 if not or -1 on error
  */
-int libcfile_file_exists(
+int libcfile_file_exists_with_error_code(
      const char *filename,
+     uint32_t *error_code,
      libcerror_error_t **error )
 {
 	struct stat file_statistics;
 
-	static char *function = "libcfile_file_exists";
+	static char *function = "libcfile_file_exists_with_error_code";
 	int result            = 0;
 
 	if( filename == NULL )
@@ -307,6 +349,17 @@ int libcfile_file_exists(
 
 		return( -1 );
 	}
+	if( error_code == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
+		 function );
+
+		return( -1 );
+	}
 	if( memory_set(
 	     &file_statistics,
 	     0,
@@ -327,7 +380,9 @@ int libcfile_file_exists(
 
 	if( result != 0 )
 	{
-		switch( errno )
+		*error_code = (uint32_t) errno;
+
+		switch( *error_code )
 		{
 			case EACCES:
 				result = 1;
@@ -344,7 +399,7 @@ int libcfile_file_exists(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_IO,
 				 LIBCERROR_IO_ERROR_GENERIC,
-				 errno,
+				 *error_code,
 				 "%s: unable to stat file: %" PRIs_SYSTEM ".",
 				 function,
 				 filename );
@@ -365,6 +420,36 @@ int libcfile_file_exists(
 
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
+/* Determines if a file exists
+ * Returns 1 if the file exists, 0 if not or -1 on error
+ */
+int libcfile_file_exists_wide(
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_file_exists_wide";
+	uint32_t error_code   = 0;
+	int result            = 0;
+
+	result = libcfile_file_exists_wide_with_error_code(
+	          filename,
+	          &error_code,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if file exists.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 #if defined( WINAPI )
 
 /* Determines if a file exists using get file attibutes
@@ -372,13 +457,13 @@ int libcfile_file_exists(
  * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
  * Returns 1 if the file exists, 0 if not or -1 on error
  */
-int libcfile_file_exists_wide(
+int libcfile_file_exists_wide_with_error_code(
      const wchar_t *filename,
+     uint32_t *error_code,
      libcerror_error_t **error )
 {
-	static char *function  = "libcfile_file_exists_wide";
+	static char *function  = "libcfile_file_exists_wide_with_error_code";
 	size_t filename_length = 0;
-	DWORD error_code       = 0;
 	DWORD file_attributes  = 0;
 	HANDLE handle          = INVALID_HANDLE_VALUE;
 	int is_device_filename = 0;
@@ -395,6 +480,17 @@ int libcfile_file_exists_wide(
 
 		return( -1 );
 	}
+	if( error_code == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
+		 function );
+
+		return( -1 );
+	}
 	filename_length = wide_string_length(
 	                   filename );
 
@@ -438,9 +534,9 @@ int libcfile_file_exists_wide(
 #endif
 		if( handle == INVALID_HANDLE_VALUE )
 		{
-			error_code = (uint32_t) GetLastError();
+			*error_code = (uint32_t) GetLastError();
 
-			switch( error_code )
+			switch( *error_code )
 			{
 				case ERROR_ACCESS_DENIED:
 					result = 1;
@@ -458,7 +554,7 @@ int libcfile_file_exists_wide(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_IO,
 					 LIBCERROR_IO_ERROR_OPEN_FAILED,
-					 error_code,
+					 *error_code,
 					 "%s: unable to open file: %ls.",
 					 function,
 					 filename );
@@ -477,13 +573,13 @@ int libcfile_file_exists_wide(
 #endif
 			if( result == 0 )
 			{
-				error_code = GetLastError();
+				*error_code = (uint32_t) GetLastError();
 
 				libcerror_system_set_error(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_IO,
 				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-				 error_code,
+				 *error_code,
 				 "%s: unable to close file.",
 				 function );
 
@@ -505,9 +601,9 @@ int libcfile_file_exists_wide(
 #endif
 		if( file_attributes == INVALID_FILE_ATTRIBUTES )
 		{
-			error_code = GetLastError();
+			*error_code = (uint32_t) GetLastError();
 
-			switch( error_code )
+			switch( *error_code )
 			{
 				case ERROR_ACCESS_DENIED:
 					result = 1;
@@ -525,7 +621,7 @@ int libcfile_file_exists_wide(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_IO,
 					 LIBCERROR_IO_ERROR_GENERIC,
-					 error_code,
+					 *error_code,
 					 "%s: unable to determine attributes of file: %ls.",
 					 function,
 					 filename );
@@ -543,14 +639,15 @@ int libcfile_file_exists_wide(
  * This function uses the POSIX stat function or equivalent
  * Returns 1 if the file exists, 0 if not or -1 on error
  */
-int libcfile_file_exists_wide(
+int libcfile_file_exists_wide_with_error_code(
      const wchar_t *filename,
+     uint32_t *error_code,
      libcerror_error_t **error )
 {
 	struct stat file_statistics;
 
 	char *narrow_filename       = NULL;
-	static char *function       = "libcfile_file_exists_wide";
+	static char *function       = "libcfile_file_exists_wide_with_error_code";
 	size_t narrow_filename_size = 0;
 	size_t filename_size        = 0;
 	int result                  = 0;
@@ -566,6 +663,17 @@ int libcfile_file_exists_wide(
 
 		return( -1 );
 	}
+	if( error_code == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
+		 function );
+
+		return( -1 );
+	}
 	filename_size = 1 + wide_string_length(
 	                     filename );
 
@@ -695,12 +803,16 @@ int libcfile_file_exists_wide(
 	          narrow_filename,
 	          &file_statistics );
 
+	if( result != 0 )
+	{
+		*error_code = (uint32_t) errno;
+	}
 	memory_free(
 	 narrow_filename );
 
 	if( result != 0 )
 	{
-		switch( errno )
+		switch( *error_code )
 		{
 			case EACCES:
 				result = 1;
@@ -717,7 +829,7 @@ int libcfile_file_exists_wide(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_IO,
 				 LIBCERROR_IO_ERROR_GENERIC,
-				 errno,
+				 *error_code,
 				 "%s: unable to stat file: %" PRIs_SYSTEM ".",
 				 function,
 				 filename );
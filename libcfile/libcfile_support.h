@@ -55,6 +55,12 @@ int libcfile_file_exists(
      const char *filename,
      libcerror_error_t **error );
 
+LIBCFILE_EXTERN \
+int libcfile_file_exists_with_error_code(
+     const char *filename,
+     uint32_t *error_code,
+     libcerror_error_t **error );
+
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
 LIBCFILE_EXTERN \
@@ -62,6 +68,12 @@ int libcfile_file_exists_wide(
      const wchar_t *filename,
      libcerror_error_t **error );
 
+LIBCFILE_EXTERN \
+int libcfile_file_exists_wide_with_error_code(
+     const wchar_t *filename,
+     uint32_t *error_code,
+     libcerror_error_t **error );
+
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
 LIBCFILE_EXTERN \
@@ -0,0 +1,957 @@
+/*
+ * Library read, write and seek throughput benchmark program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if !defined( WINAPI )
+#include <time.h>
+#endif
+
+#include "cfile_test_functions.h"
+#include "cfile_test_getopt.h"
+#include "cfile_test_libcerror.h"
+#include "cfile_test_libcfile.h"
+
+/* The workload types
+ */
+enum CFILE_BENCH_WORKLOAD_TYPES
+{
+	CFILE_BENCH_WORKLOAD_TYPE_SEQUENTIAL_READ,
+	CFILE_BENCH_WORKLOAD_TYPE_RANDOM_READ,
+	CFILE_BENCH_WORKLOAD_TYPE_UNALIGNED_READ,
+	CFILE_BENCH_WORKLOAD_TYPE_SEEK_READ,
+	CFILE_BENCH_WORKLOAD_TYPE_WRITE
+};
+
+#define CFILE_BENCH_DEFAULT_BLOCK_SIZE			512
+#define CFILE_BENCH_DEFAULT_NUMBER_OF_OPERATIONS	1024
+#define CFILE_BENCH_DEFAULT_SEED			0x5eed5eedUL
+#define CFILE_BENCH_MAXIMUM_IO_SIZE			( 64 * 1024 )
+#define CFILE_BENCH_MAXIMUM_NUMBER_OF_OPERATIONS	( 16 * 1024 * 1024 )
+
+typedef struct cfile_bench_workload cfile_bench_workload_t;
+
+struct cfile_bench_workload
+{
+	/* The name
+	 */
+	const char *name;
+
+	/* The type
+	 */
+	int type;
+
+	/* The size of a single input/output operation
+	 */
+	size_t io_size;
+};
+
+const cfile_bench_workload_t cfile_bench_workloads[] = {
+	{ "sequential_read", CFILE_BENCH_WORKLOAD_TYPE_SEQUENTIAL_READ, 64 * 1024 },
+	{ "random_read_4k", CFILE_BENCH_WORKLOAD_TYPE_RANDOM_READ, 4 * 1024 },
+	{ "random_read_64k", CFILE_BENCH_WORKLOAD_TYPE_RANDOM_READ, 64 * 1024 },
+	{ "unaligned_read", CFILE_BENCH_WORKLOAD_TYPE_UNALIGNED_READ, 777 },
+	{ "seek_read", CFILE_BENCH_WORKLOAD_TYPE_SEEK_READ, 4 * 1024 },
+	{ "write", CFILE_BENCH_WORKLOAD_TYPE_WRITE, 64 * 1024 },
+	{ NULL, 0, 0 } };
+
+const int cfile_bench_access_behaviors[] = {
+	LIBCFILE_ACCESS_BEHAVIOR_NORMAL,
+	LIBCFILE_ACCESS_BEHAVIOR_RANDOM,
+	LIBCFILE_ACCESS_BEHAVIOR_SEQUENTIAL,
+	LIBCFILE_ACCESS_BEHAVIOR_STREAMING,
+	-1 };
+
+/* Prints usage information
+ */
+void cfile_bench_usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use cfile_bench to measure the read, write and seek throughput of\n"
+	                 "libcfile.\n\n" );
+
+	fprintf( stream, "Usage: cfile_bench [ -b block_size ] [ -n number_of_operations ]\n"
+	                 "                   [ -s seed ] [ -h ] source\n\n" );
+
+	fprintf( stream, "\tsource: the source file or device\n\n" );
+
+	fprintf( stream, "\t-b:     block size used by the unaligned read workload,\n"
+	                 "\t        the default is 512. The source size must be a multiple\n"
+	                 "\t        of the block size, for example a loop device\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-n:     number of operations per workload, the default is 1024\n" );
+	fprintf( stream, "\t-s:     seed of the random offsets, the default is 1592614637\n\n" );
+
+	fprintf( stream, "The results are written to stdout as comma separated values with\n"
+	                 "the throughput in MiB/s and the latencies in microseconds.\n" );
+}
+
+/* Copies a decimal string to an unsigned 64-bit value
+ * Returns 1 if successful or -1 on error
+ */
+int cfile_bench_copy_from_system_string(
+     const system_character_t *string,
+     uint64_t *value_64bit )
+{
+	uint64_t safe_value_64bit = 0;
+	uint8_t digit             = 0;
+
+	if( ( string == NULL )
+	 || ( *string == 0 )
+	 || ( value_64bit == NULL ) )
+	{
+		return( -1 );
+	}
+	while( *string != 0 )
+	{
+		if( ( *string < (system_character_t) '0' )
+		 || ( *string > (system_character_t) '9' ) )
+		{
+			return( -1 );
+		}
+		digit = (uint8_t) ( *string - (system_character_t) '0' );
+
+		if( safe_value_64bit > ( ( (uint64_t) UINT64_MAX - digit ) / 10 ) )
+		{
+			return( -1 );
+		}
+		safe_value_64bit *= 10;
+		safe_value_64bit += digit;
+
+		string++;
+	}
+	*value_64bit = safe_value_64bit;
+
+	return( 1 );
+}
+
+/* Retrieves a monotonic timestamp in nanoseconds
+ */
+uint64_t cfile_bench_get_timestamp(
+          void )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+	if( ( QueryPerformanceCounter(
+	       &counter ) == 0 )
+	 || ( QueryPerformanceFrequency(
+	       &frequency ) == 0 )
+	 || ( frequency.QuadPart <= 0 ) )
+	{
+		return( 0 );
+	}
+	return( (uint64_t) ( ( (double) counter.QuadPart * 1000000000.0 ) / (double) frequency.QuadPart ) );
+
+#elif defined( HAVE_CLOCK_GETTIME )
+	struct timespec time_value;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) time_value.tv_sec * 1000000000UL ) + (uint64_t) time_value.tv_nsec );
+
+#else
+	return( (uint64_t) ( ( (double) clock() * 1000000000.0 ) / (double) CLOCKS_PER_SEC ) );
+
+#endif
+}
+
+/* Retrieves the next pseudo random value
+ */
+uint64_t cfile_bench_get_random_value(
+          uint64_t *random_state )
+{
+	uint64_t value_64bit = *random_state;
+
+	/* xorshift64
+	 */
+	value_64bit ^= value_64bit << 13;
+	value_64bit ^= value_64bit >> 7;
+	value_64bit ^= value_64bit << 17;
+
+	*random_state = value_64bit;
+
+	return( value_64bit );
+}
+
+/* Compares two latencies
+ * Returns -1, 0 or 1 for use with qsort
+ */
+int cfile_bench_compare_latencies(
+     const void *first_latency,
+     const void *second_latency )
+{
+	uint64_t first_value  = *( (const uint64_t *) first_latency );
+	uint64_t second_value = *( (const uint64_t *) second_latency );
+
+	if( first_value < second_value )
+	{
+		return( -1 );
+	}
+	else if( first_value > second_value )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Prints the result of a workload
+ */
+void cfile_bench_result_fprint(
+      FILE *stream,
+      const cfile_bench_workload_t *workload,
+      int access_behavior,
+      int number_of_operations,
+      uint64_t number_of_bytes,
+      uint64_t elapsed_time,
+      uint64_t *latencies )
+{
+	const char *access_behavior_string = "normal";
+	double elapsed_seconds             = 0.0;
+	double iops                        = 0.0;
+	double throughput                  = 0.0;
+	uint64_t p50_latency               = 0;
+	uint64_t p99_latency               = 0;
+
+	if( ( stream == NULL )
+	 || ( workload == NULL )
+	 || ( latencies == NULL ) )
+	{
+		return;
+	}
+	if( access_behavior == LIBCFILE_ACCESS_BEHAVIOR_RANDOM )
+	{
+		access_behavior_string = "random";
+	}
+	else if( access_behavior == LIBCFILE_ACCESS_BEHAVIOR_SEQUENTIAL )
+	{
+		access_behavior_string = "sequential";
+	}
+	else if( access_behavior == LIBCFILE_ACCESS_BEHAVIOR_STREAMING )
+	{
+		access_behavior_string = "streaming";
+	}
+	if( number_of_operations > 0 )
+	{
+		qsort(
+		 latencies,
+		 (size_t) number_of_operations,
+		 sizeof( uint64_t ),
+		 &cfile_bench_compare_latencies );
+
+		p50_latency = latencies[ ( number_of_operations * 50 ) / 100 ];
+		p99_latency = latencies[ ( number_of_operations * 99 ) / 100 ];
+	}
+	elapsed_seconds = (double) elapsed_time / 1000000000.0;
+
+	if( elapsed_seconds > 0.0 )
+	{
+		throughput = ( (double) number_of_bytes / ( 1024.0 * 1024.0 ) ) / elapsed_seconds;
+		iops       = (double) number_of_operations / elapsed_seconds;
+	}
+	fprintf(
+	 stream,
+	 "%s,%s,%" PRIzd ",%d,%" PRIu64 ",%.6f,%.2f,%.0f,%.3f,%.3f\n",
+	 workload->name,
+	 access_behavior_string,
+	 workload->io_size,
+	 number_of_operations,
+	 number_of_bytes,
+	 elapsed_seconds,
+	 throughput,
+	 iops,
+	 (double) p50_latency / 1000.0,
+	 (double) p99_latency / 1000.0 );
+}
+
+/* Runs a workload
+ * Returns 1 if successful, 0 if the workload does not apply to the file or -1 on error
+ */
+int cfile_bench_run_workload(
+     libcfile_file_t *file,
+     const cfile_bench_workload_t *workload,
+     int access_behavior,
+     size_t block_size,
+     int number_of_operations,
+     uint8_t *buffer,
+     uint64_t *latencies,
+     uint64_t *random_state,
+     libcerror_error_t **error )
+{
+	static char *function     = "cfile_bench_run_workload";
+	size64_t file_size        = 0;
+	size64_t maximum_offset   = 0;
+	ssize_t io_count          = 0;
+	uint64_t end_timestamp    = 0;
+	uint64_t number_of_bytes  = 0;
+	uint64_t start_timestamp  = 0;
+	uint64_t total_time       = 0;
+	off64_t offset            = 0;
+	int operation_index       = 0;
+
+	if( workload == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid workload.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcfile_file_set_access_behavior(
+	     file,
+	     access_behavior,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set access behavior.",
+		 function );
+
+		return( -1 );
+	}
+	if( workload->type == CFILE_BENCH_WORKLOAD_TYPE_UNALIGNED_READ )
+	{
+		if( libcfile_file_set_block_size(
+		     file,
+		     block_size,
+		     NULL ) != 1 )
+		{
+			return( 0 );
+		}
+	}
+	if( libcfile_file_get_size(
+	     file,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		return( -1 );
+	}
+	if( workload->type != CFILE_BENCH_WORKLOAD_TYPE_WRITE )
+	{
+		if( file_size < (size64_t) workload->io_size )
+		{
+			return( 0 );
+		}
+		maximum_offset = file_size - workload->io_size;
+	}
+	for( operation_index = 0;
+	     operation_index < number_of_operations;
+	     operation_index++ )
+	{
+		if( ( workload->type == CFILE_BENCH_WORKLOAD_TYPE_RANDOM_READ )
+		 || ( workload->type == CFILE_BENCH_WORKLOAD_TYPE_UNALIGNED_READ )
+		 || ( workload->type == CFILE_BENCH_WORKLOAD_TYPE_SEEK_READ ) )
+		{
+			offset = (off64_t) ( cfile_bench_get_random_value(
+			                      random_state ) % ( maximum_offset + 1 ) );
+
+			if( workload->type == CFILE_BENCH_WORKLOAD_TYPE_RANDOM_READ )
+			{
+				offset -= offset % workload->io_size;
+			}
+			else if( ( workload->type == CFILE_BENCH_WORKLOAD_TYPE_UNALIGNED_READ )
+			      && ( ( offset % block_size ) == 0 )
+			      && ( (size64_t) offset < maximum_offset ) )
+			{
+				offset += 1;
+			}
+		}
+		else if( workload->type == CFILE_BENCH_WORKLOAD_TYPE_SEQUENTIAL_READ )
+		{
+			if( (size64_t) offset > maximum_offset )
+			{
+				offset = 0;
+			}
+		}
+		start_timestamp = cfile_bench_get_timestamp();
+
+		switch( workload->type )
+		{
+			case CFILE_BENCH_WORKLOAD_TYPE_SEQUENTIAL_READ:
+				if( offset == 0 )
+				{
+					if( libcfile_file_seek_offset(
+					     file,
+					     0,
+					     SEEK_SET,
+					     error ) == -1 )
+					{
+						io_count = -1;
+
+						break;
+					}
+				}
+				io_count = libcfile_file_read_buffer(
+				            file,
+				            buffer,
+				            workload->io_size,
+				            error );
+				break;
+
+			case CFILE_BENCH_WORKLOAD_TYPE_RANDOM_READ:
+			case CFILE_BENCH_WORKLOAD_TYPE_UNALIGNED_READ:
+				io_count = libcfile_file_read_buffer_at_offset(
+				            file,
+				            buffer,
+				            workload->io_size,
+				            offset,
+				            error );
+				break;
+
+			case CFILE_BENCH_WORKLOAD_TYPE_SEEK_READ:
+				if( libcfile_file_seek_offset(
+				     file,
+				     offset,
+				     SEEK_SET,
+				     error ) == -1 )
+				{
+					io_count = -1;
+
+					break;
+				}
+				io_count = libcfile_file_read_buffer(
+				            file,
+				            buffer,
+				            workload->io_size,
+				            error );
+				break;
+
+			case CFILE_BENCH_WORKLOAD_TYPE_WRITE:
+				io_count = libcfile_file_write_buffer(
+				            file,
+				            buffer,
+				            workload->io_size,
+				            error );
+				break;
+
+			default:
+				io_count = -1;
+				break;
+		}
+		end_timestamp = cfile_bench_get_timestamp();
+
+		if( io_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to run operation: %d of workload: %s.",
+			 function,
+			 operation_index,
+			 workload->name );
+
+			return( -1 );
+		}
+		if( workload->type == CFILE_BENCH_WORKLOAD_TYPE_SEQUENTIAL_READ )
+		{
+			offset += io_count;
+
+			if( io_count == 0 )
+			{
+				offset = 0;
+			}
+		}
+		latencies[ operation_index ] = end_timestamp - start_timestamp;
+
+		total_time      += latencies[ operation_index ];
+		number_of_bytes += (uint64_t) io_count;
+	}
+	cfile_bench_result_fprint(
+	 stdout,
+	 workload,
+	 access_behavior,
+	 number_of_operations,
+	 number_of_bytes,
+	 total_time,
+	 latencies );
+
+	return( 1 );
+}
+
+/* Opens a file
+ * Returns 1 if successful or -1 on error
+ */
+int cfile_bench_open_file(
+     libcfile_file_t **file,
+     const system_character_t *filename,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "cfile_bench_open_file";
+	int result            = 0;
+
+	if( libcfile_file_initialize(
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+	          *file,
+	          filename,
+	          access_flags,
+	          error );
+#else
+	result = libcfile_file_open(
+	          *file,
+	          filename,
+	          access_flags,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *file != NULL )
+	{
+		libcfile_file_free(
+		 file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes a file
+ * Returns 0 if successful or -1 on error
+ */
+int cfile_bench_close_file(
+     libcfile_file_t **file,
+     libcerror_error_t **error )
+{
+	static char *function = "cfile_bench_close_file";
+	int result            = 0;
+
+	if( libcfile_file_close(
+	     *file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		result = -1;
+	}
+	if( libcfile_file_free(
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	char temporary_filename[ 19 ];
+
+	const cfile_bench_workload_t *workload = NULL;
+	libcerror_error_t *error               = NULL;
+	libcfile_file_t *file                  = NULL;
+	system_character_t *source             = NULL;
+	uint8_t *buffer                        = NULL;
+	uint64_t *latencies                    = NULL;
+	uint64_t random_state                  = CFILE_BENCH_DEFAULT_SEED;
+	uint64_t value_64bit                   = 0;
+	size_t block_size                      = CFILE_BENCH_DEFAULT_BLOCK_SIZE;
+	system_integer_t option                = 0;
+	int access_behavior_index              = 0;
+	int number_of_operations               = CFILE_BENCH_DEFAULT_NUMBER_OF_OPERATIONS;
+	int result                             = 0;
+	int workload_index                     = 0;
+
+	while( ( option = cfile_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "b:hn:s:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				cfile_bench_usage_fprint(
+				 stderr );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'b':
+				if( ( cfile_bench_copy_from_system_string(
+				       optarg,
+				       &value_64bit ) != 1 )
+				 || ( value_64bit == 0 )
+				 || ( value_64bit > (uint64_t) CFILE_BENCH_MAXIMUM_IO_SIZE ) )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported block size: %" PRIs_SYSTEM ".\n",
+					 optarg );
+
+					return( EXIT_FAILURE );
+				}
+				block_size = (size_t) value_64bit;
+
+				break;
+
+			case (system_integer_t) 'h':
+				cfile_bench_usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'n':
+				if( ( cfile_bench_copy_from_system_string(
+				       optarg,
+				       &value_64bit ) != 1 )
+				 || ( value_64bit == 0 )
+				 || ( value_64bit > (uint64_t) CFILE_BENCH_MAXIMUM_NUMBER_OF_OPERATIONS ) )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported number of operations: %" PRIs_SYSTEM ".\n",
+					 optarg );
+
+					return( EXIT_FAILURE );
+				}
+				number_of_operations = (int) value_64bit;
+
+				break;
+
+			case (system_integer_t) 's':
+				if( cfile_bench_copy_from_system_string(
+				     optarg,
+				     &value_64bit ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported seed: %" PRIs_SYSTEM ".\n",
+					 optarg );
+
+					return( EXIT_FAILURE );
+				}
+				/* xorshift64 requires a non-zero state
+				 */
+				if( value_64bit == 0 )
+				{
+					value_64bit = CFILE_BENCH_DEFAULT_SEED;
+				}
+				random_state = value_64bit;
+
+				break;
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file or device.\n" );
+
+		cfile_bench_usage_fprint(
+		 stderr );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * CFILE_BENCH_MAXIMUM_IO_SIZE );
+
+	if( buffer == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create buffer.\n" );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     buffer,
+	     0xa5,
+	     sizeof( uint8_t ) * CFILE_BENCH_MAXIMUM_IO_SIZE ) == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to clear buffer.\n" );
+
+		goto on_error;
+	}
+	latencies = (uint64_t *) memory_allocate(
+	                          sizeof( uint64_t ) * number_of_operations );
+
+	if( latencies == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create latencies.\n" );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "workload,access_behavior,io_size,operations,bytes,seconds,mib_per_second,iops,p50_latency_us,p99_latency_us\n" );
+
+	for( workload_index = 0;
+	     cfile_bench_workloads[ workload_index ].name != NULL;
+	     workload_index++ )
+	{
+		workload = &( cfile_bench_workloads[ workload_index ] );
+
+		for( access_behavior_index = 0;
+		     cfile_bench_access_behaviors[ access_behavior_index ] != -1;
+		     access_behavior_index++ )
+		{
+			if( workload->type == CFILE_BENCH_WORKLOAD_TYPE_WRITE )
+			{
+				if( narrow_string_copy(
+				     temporary_filename,
+				     "cfile_bench_XXXXXX",
+				     19 ) == NULL )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to set temporary filename.\n" );
+
+					goto on_error;
+				}
+				result = cfile_test_get_temporary_filename(
+				          temporary_filename,
+				          19,
+				          &error );
+
+				if( result == -1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to retrieve temporary filename.\n" );
+
+					goto on_error;
+				}
+				else if( result == 0 )
+				{
+					fprintf(
+					 stderr,
+					 "Skipping workload: %s temporary files not supported.\n",
+					 workload->name );
+
+					break;
+				}
+				if( libcfile_file_initialize(
+				     &file,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to initialize file.\n" );
+
+					goto on_error;
+				}
+				if( libcfile_file_open(
+				     file,
+				     temporary_filename,
+				     LIBCFILE_OPEN_WRITE_TRUNCATE,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to open temporary file: %s.\n",
+					 temporary_filename );
+
+					goto on_error;
+				}
+			}
+			else if( cfile_bench_open_file(
+			          &file,
+			          source,
+			          LIBCFILE_OPEN_READ,
+			          &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to open source: %" PRIs_SYSTEM ".\n",
+				 source );
+
+				goto on_error;
+			}
+			result = cfile_bench_run_workload(
+			          file,
+			          workload,
+			          cfile_bench_access_behaviors[ access_behavior_index ],
+			          block_size,
+			          number_of_operations,
+			          buffer,
+			          latencies,
+			          &random_state,
+			          &error );
+
+			if( result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to run workload: %s.\n",
+				 workload->name );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Skipping workload: %s not supported by source.\n",
+				 workload->name );
+			}
+			if( cfile_bench_close_file(
+			     &file,
+			     &error ) != 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to close file.\n" );
+
+				goto on_error;
+			}
+			if( workload->type == CFILE_BENCH_WORKLOAD_TYPE_WRITE )
+			{
+				if( libcfile_file_remove(
+				     temporary_filename,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to remove temporary file: %s.\n",
+					 temporary_filename );
+
+					goto on_error;
+				}
+			}
+			if( result == 0 )
+			{
+				break;
+			}
+		}
+	}
+	memory_free(
+	 latencies );
+
+	memory_free(
+	 buffer );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	if( latencies != NULL )
+	{
+		memory_free(
+		 latencies );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( EXIT_FAILURE );
+}
+
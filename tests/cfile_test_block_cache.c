@@ -0,0 +1,912 @@
+/*
+ * Library block_cache type test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cfile_test_libcerror.h"
+#include "cfile_test_libcfile.h"
+#include "cfile_test_macros.h"
+#include "cfile_test_memory.h"
+#include "cfile_test_unused.h"
+
+#include "../libcfile/libcfile_block_cache.h"
+
+#if defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT )
+
+/* Tests the libcfile_block_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_block_cache_initialize(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libcfile_block_cache_t *block_cache = NULL;
+	int result                          = 0;
+
+#if defined( HAVE_CFILE_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 4;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcfile_block_cache_initialize(
+	          &block_cache,
+	          512,
+	          4,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcfile_block_cache_initialize(
+	          NULL,
+	          512,
+	          4,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	block_cache = (libcfile_block_cache_t *) 0x12345678UL;
+
+	result = libcfile_block_cache_initialize(
+	          &block_cache,
+	          512,
+	          4,
+	          &error );
+
+	block_cache = NULL;
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_block_cache_initialize(
+	          &block_cache,
+	          512,
+	          0,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_block_cache_initialize(
+	          &block_cache,
+	          0,
+	          4,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CFILE_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcfile_block_cache_initialize with malloc failing
+		 */
+		cfile_test_malloc_attempts_before_fail = test_number;
+
+		result = libcfile_block_cache_initialize(
+		          &block_cache,
+		          512,
+		          4,
+		          &error );
+
+		if( cfile_test_malloc_attempts_before_fail != -1 )
+		{
+			cfile_test_malloc_attempts_before_fail = -1;
+
+			if( block_cache != NULL )
+			{
+				libcfile_block_cache_free(
+				 &block_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			CFILE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CFILE_TEST_ASSERT_IS_NULL(
+			 "block_cache",
+			 block_cache );
+
+			CFILE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CFILE_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_cache != NULL )
+	{
+		libcfile_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcfile_block_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_block_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcfile_block_cache_free(
+	          NULL,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcfile_block_cache_get_block and libcfile_block_cache_allocate_block functions
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_block_cache_get_block(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libcfile_block_cache_t *block_cache = NULL;
+	uint8_t *data                       = NULL;
+	uint8_t *first_data                 = NULL;
+	uint64_t number_of_hits             = 0;
+	uint64_t number_of_misses           = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libcfile_block_cache_initialize(
+	          &block_cache,
+	          512,
+	          2,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcfile_block_cache_get_block(
+	          block_cache,
+	          0,
+	          &data,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_block_cache_allocate_block(
+	          block_cache,
+	          0,
+	          &first_data,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "first_data",
+	 first_data );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	first_data[ 0 ] = 'A';
+
+	result = libcfile_block_cache_allocate_block(
+	          block_cache,
+	          512,
+	          &data,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data[ 0 ] = 'B';
+
+	data = NULL;
+
+	result = libcfile_block_cache_get_block(
+	          block_cache,
+	          0,
+	          &data,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "data[ 0 ]",
+	 (int) data[ 0 ],
+	 (int) 'A' );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The block at offset 512 is now the least recently used and is reused
+	 */
+	result = libcfile_block_cache_allocate_block(
+	          block_cache,
+	          1024,
+	          &data,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_block_cache_get_block(
+	          block_cache,
+	          512,
+	          &data,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_block_cache_get_block(
+	          block_cache,
+	          0,
+	          &data,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "data[ 0 ]",
+	 (int) data[ 0 ],
+	 (int) 'A' );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_block_cache_get_statistics(
+	          block_cache,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 2 );
+
+	CFILE_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) 2 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcfile_block_cache_get_block(
+	          NULL,
+	          0,
+	          &data,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_block_cache_get_block(
+	          block_cache,
+	          -1,
+	          &data,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_block_cache_get_block(
+	          block_cache,
+	          0,
+	          NULL,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_block_cache_allocate_block(
+	          NULL,
+	          0,
+	          &data,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_block_cache_allocate_block(
+	          block_cache,
+	          100,
+	          &data,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_block_cache_allocate_block(
+	          block_cache,
+	          0,
+	          NULL,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_block_cache_get_statistics(
+	          NULL,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_block_cache_get_statistics(
+	          block_cache,
+	          NULL,
+	          &number_of_misses,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_block_cache_get_statistics(
+	          block_cache,
+	          &number_of_hits,
+	          NULL,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcfile_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_cache != NULL )
+	{
+		libcfile_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcfile_block_cache_invalidate_range function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_block_cache_invalidate_range(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libcfile_block_cache_t *block_cache = NULL;
+	uint8_t *data                       = NULL;
+	off64_t block_offset                = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libcfile_block_cache_initialize(
+	          &block_cache,
+	          512,
+	          4,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( block_offset = 0;
+	     block_offset < 2048;
+	     block_offset += 512 )
+	{
+		result = libcfile_block_cache_allocate_block(
+		          block_cache,
+		          block_offset,
+		          &data,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libcfile_block_cache_invalidate_range(
+	          block_cache,
+	          600,
+	          512,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_block_cache_get_block(
+	          block_cache,
+	          0,
+	          &data,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_block_cache_get_block(
+	          block_cache,
+	          512,
+	          &data,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_block_cache_get_block(
+	          block_cache,
+	          1024,
+	          &data,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_block_cache_get_block(
+	          block_cache,
+	          1536,
+	          &data,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcfile_block_cache_invalidate_range(
+	          NULL,
+	          0,
+	          512,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_block_cache_invalidate_range(
+	          block_cache,
+	          -1,
+	          512,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcfile_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_cache != NULL )
+	{
+		libcfile_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CFILE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CFILE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CFILE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CFILE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CFILE_TEST_UNREFERENCED_PARAMETER( argc )
+	CFILE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT )
+
+	CFILE_TEST_RUN(
+	 "libcfile_block_cache_initialize",
+	 cfile_test_block_cache_initialize );
+
+	CFILE_TEST_RUN(
+	 "libcfile_block_cache_free",
+	 cfile_test_block_cache_free );
+
+	CFILE_TEST_RUN(
+	 "libcfile_block_cache_get_block",
+	 cfile_test_block_cache_get_block );
+
+	CFILE_TEST_RUN(
+	 "libcfile_block_cache_invalidate_range",
+	 cfile_test_block_cache_invalidate_range );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT ) */
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -936,18 +937,8290 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libcfile_file_sync and libcfile_file_sync_range functions
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_sync(
+     void )
+{
+	char narrow_temporary_filename[ 18 ] = {
+		'c', 'f', 'i', 'l', 'e', '_', 't', 'e', 's', 't', '_', 'X', 'X', 'X', 'X', 'X', 'X', 0 };
+
+	uint8_t buffer[ 32 ] = {
+		'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+		'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', '0', '1', '2', '3', '4', '5' };
+
+	libcerror_error_t *error = NULL;
+	libcfile_file_t *file    = NULL;
+	ssize_t write_count      = 0;
+	int result               = 0;
+	int with_temporary_file  = 0;
+
+	/* Initialize test
+	 */
+	result = libcfile_file_initialize(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = cfile_test_get_temporary_filename(
+	          narrow_temporary_filename,
+	          18,
+	          &error );
+
+	CFILE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	with_temporary_file = result;
+
+	/* Test error cases
+	 */
+	result = libcfile_file_sync(
+	          NULL,
+	          0,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_sync_range(
+	          NULL,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the file is not open
+	 */
+	result = libcfile_file_sync(
+	          file,
+	          0,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( with_temporary_file != 0 )
+	{
+		result = libcfile_file_open(
+		          file,
+		          narrow_temporary_filename,
+		          LIBCFILE_OPEN_READ_WRITE,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		write_count = libcfile_file_write_buffer(
+		               file,
+		               buffer,
+		               32,
+		               &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) 32 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		result = libcfile_file_sync(
+		          file,
+		          0,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_sync(
+		          file,
+		          LIBCFILE_SYNC_FLAG_DATA_ONLY,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_sync_range(
+		          file,
+		          0,
+		          32,
+		          0,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_sync_range(
+		          file,
+		          0,
+		          0,
+		          LIBCFILE_SYNC_RANGE_FLAG_NO_WAIT,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test error cases
+		 */
+		result = libcfile_file_sync(
+		          file,
+		          0xff,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libcfile_file_sync_range(
+		          file,
+		          -1,
+		          32,
+		          0,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libcfile_file_sync_range(
+		          file,
+		          1,
+		          (size64_t) INT64_MAX,
+		          0,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libcfile_file_sync_range(
+		          file,
+		          0,
+		          32,
+		          0xff,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	if( with_temporary_file != 0 )
+	{
+		result = libcfile_file_close(
+		          file,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_remove(
+		          narrow_temporary_filename,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		with_temporary_file = 0;
+	}
+	result = libcfile_file_free(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( with_temporary_file != 0 )
+	{
+		libcfile_file_remove(
+		 narrow_temporary_filename,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcfile_file_commit and libcfile_file_set_commit_interval functions
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_commit(
+     void )
+{
+	char narrow_temporary_filename[ 18 ] = {
+		'c', 'f', 'i', 'l', 'e', '_', 't', 'e', 's', 't', '_', 'X', 'X', 'X', 'X', 'X', 'X', 0 };
+
+	uint8_t buffer[ 32 ] = {
+		'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+		'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', '0', '1', '2', '3', '4', '5' };
+
+	libcerror_error_t *error = NULL;
+	libcfile_file_t *file    = NULL;
+	ssize_t write_count      = 0;
+	int result               = 0;
+	int with_temporary_file  = 0;
+
+	/* Initialize test
+	 */
+	result = libcfile_file_initialize(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = cfile_test_get_temporary_filename(
+	          narrow_temporary_filename,
+	          18,
+	          &error );
+
+	CFILE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	with_temporary_file = result;
+
+	/* Test error cases
+	 */
+	result = libcfile_file_commit(
+	          NULL,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_set_commit_interval(
+	          NULL,
+	          1000,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_set_commit_interval(
+	          file,
+	          0xffffffffUL,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the file is not open
+	 */
+	result = libcfile_file_commit(
+	          file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( with_temporary_file != 0 )
+	{
+		result = libcfile_file_open(
+		          file,
+		          narrow_temporary_filename,
+		          LIBCFILE_OPEN_READ_WRITE,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		write_count = libcfile_file_write_buffer(
+		               file,
+		               buffer,
+		               32,
+		               &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) 32 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		result = libcfile_file_commit(
+		          file,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_set_commit_interval(
+		          file,
+		          1000,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		write_count = libcfile_file_write_buffer(
+		               file,
+		               buffer,
+		               32,
+		               &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) 32 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_commit(
+		          file,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_commit(
+		          file,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test that a failed write back is reported by the next commit only
+		 */
+		( (libcfile_internal_file_t *) file )->writeback_error_code = 5;
+
+		result = libcfile_file_commit(
+		          file,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libcfile_file_commit(
+		          file,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test error cases
+		 */
+		result = libcfile_file_close(
+		          file,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_open(
+		          file,
+		          narrow_temporary_filename,
+		          LIBCFILE_OPEN_READ,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test error case where the file is opened without write access
+		 */
+		result = libcfile_file_commit(
+		          file,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libcfile_file_sync(
+		          file,
+		          0,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	if( with_temporary_file != 0 )
+	{
+		result = libcfile_file_close(
+		          file,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_remove(
+		          narrow_temporary_filename,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		with_temporary_file = 0;
+	}
+	result = libcfile_file_free(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( with_temporary_file != 0 )
+	{
+		libcfile_file_remove(
+		 narrow_temporary_filename,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcfile_file_set_writeback_size function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_set_writeback_size(
+     void )
+{
+	char narrow_temporary_filename[ 18 ] = {
+		'c', 'f', 'i', 'l', 'e', '_', 't', 'e', 's', 't', '_', 'X', 'X', 'X', 'X', 'X', 'X', 0 };
+
+	uint8_t buffer[ 4096 ];
+
+	libcerror_error_t *error = NULL;
+	libcfile_file_t *file    = NULL;
+	size64_t file_size       = 0;
+	ssize_t write_count      = 0;
+	int result               = 0;
+	int with_temporary_file  = 0;
+	int write_index          = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     buffer,
+	     'A',
+	     4096 ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libcfile_file_initialize(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = cfile_test_get_temporary_filename(
+	          narrow_temporary_filename,
+	          18,
+	          &error );
+
+	CFILE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	with_temporary_file = result;
+
+	/* Test error cases
+	 */
+	result = libcfile_file_set_writeback_size(
+	          NULL,
+	          65536,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_set_writeback_size(
+	          file,
+	          (size_t) LIBCFILE_MAXIMUM_WRITEBACK_SIZE + 1,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( with_temporary_file != 0 )
+	{
+		result = libcfile_file_open(
+		          file,
+		          narrow_temporary_filename,
+		          LIBCFILE_OPEN_READ_WRITE,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		result = libcfile_file_set_writeback_size(
+		          file,
+		          65536,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( write_index = 0;
+		     write_index < 64;
+		     write_index++ )
+		{
+			write_count = libcfile_file_write_buffer(
+			               file,
+			               buffer,
+			               4096,
+			               &error );
+
+			CFILE_TEST_ASSERT_EQUAL_SSIZE(
+			 "write_count",
+			 write_count,
+			 (ssize_t) 4096 );
+
+			CFILE_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+#if defined( HAVE_SYNC_FILE_RANGE ) && !defined( WINAPI )
+		if( ( (libcfile_internal_file_t *) file )->writeback_size != 0 )
+		{
+			CFILE_TEST_ASSERT_EQUAL_INT64(
+			 "writeback_offset",
+			 (int64_t) ( (libcfile_internal_file_t *) file )->writeback_offset,
+			 (int64_t) 262144 );
+
+			CFILE_TEST_ASSERT_EQUAL_INT64(
+			 "writeback_wait_offset",
+			 (int64_t) ( (libcfile_internal_file_t *) file )->writeback_wait_offset,
+			 (int64_t) 196608 );
+		}
+#endif
+		/* Test that a failed write back is reported once by the next flush
+		 */
+		( (libcfile_internal_file_t *) file )->writeback_error_code = 5;
+
+		result = libcfile_file_flush(
+		          file,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libcfile_file_flush(
+		          file,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_get_size(
+		          file,
+		          &file_size,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CFILE_TEST_ASSERT_EQUAL_UINT64(
+		 "file_size",
+		 file_size,
+		 (uint64_t) 262144 );
+
+		result = libcfile_file_set_writeback_size(
+		          file,
+		          0,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+#if !defined( WINAPI )
+		/* Test that a failed write back that was not yet reported is reported by the close
+		 */
+		( (libcfile_internal_file_t *) file )->writeback_error_code = 5;
+
+		result = libcfile_file_close(
+		          file,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libcfile_file_is_open(
+		          file,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_open(
+		          file,
+		          narrow_temporary_filename,
+		          LIBCFILE_OPEN_READ,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+#endif /* !defined( WINAPI ) */
+	}
+	/* Clean up
+	 */
+	if( with_temporary_file != 0 )
+	{
+		result = libcfile_file_close(
+		          file,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_remove(
+		          narrow_temporary_filename,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		with_temporary_file = 0;
+	}
+	result = libcfile_file_free(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( with_temporary_file != 0 )
+	{
+		libcfile_file_remove(
+		 narrow_temporary_filename,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcfile_file_write_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_write_buffer_at_offset(
+     void )
+{
+	char narrow_temporary_filename[ 18 ] = {
+		'c', 'f', 'i', 'l', 'e', '_', 't', 'e', 's', 't', '_', 'X', 'X', 'X', 'X', 'X', 'X', 0 };
+
+	uint8_t buffer[ 32 ] = {
+		'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+		'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', '0', '1', '2', '3', '4', '5' };
+
+	uint8_t read_buffer[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	libcfile_file_t *file    = NULL;
+	size64_t file_size       = 0;
+	ssize_t read_count       = 0;
+	ssize_t write_count      = 0;
+	off64_t offset           = 0;
+	int result               = 0;
+	int with_temporary_file  = 0;
+
+	/* Initialize test
+	 */
+	result = libcfile_file_initialize(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = cfile_test_get_temporary_filename(
+	          narrow_temporary_filename,
+	          18,
+	          &error );
+
+	CFILE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	with_temporary_file = result;
+
+	if( with_temporary_file != 0 )
+	{
+		result = libcfile_file_open(
+		          file,
+		          narrow_temporary_filename,
+		          LIBCFILE_OPEN_READ_WRITE,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		/* Write the second half of the buffer first to validate the size
+		 */
+		write_count = libcfile_file_write_buffer_at_offset(
+		               file,
+		               &( buffer[ 16 ] ),
+		               16,
+		               16,
+		               &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) 16 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		write_count = libcfile_file_write_buffer_at_offset(
+		               file,
+		               buffer,
+		               16,
+		               0,
+		               &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) 16 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Make sure the current offset was not changed
+		 */
+		result = libcfile_file_get_offset(
+		          file,
+		          &offset,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 offset,
+		 (int64_t) 0 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_get_size(
+		          file,
+		          &file_size,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_EQUAL_UINT64(
+		 "file_size",
+		 (uint64_t) file_size,
+		 (uint64_t) 32 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_count = libcfile_file_read_buffer_at_offset(
+		              file,
+		              read_buffer,
+		              32,
+		              0,
+		              &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 32 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          read_buffer,
+		          buffer,
+		          32 );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	write_count = libcfile_file_write_buffer_at_offset(
+	               NULL,
+	               buffer,
+	               16,
+	               0,
+	               &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( with_temporary_file != 0 )
+	{
+		write_count = libcfile_file_write_buffer_at_offset(
+		               file,
+		               NULL,
+		               16,
+		               0,
+		               &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) -1 );
+
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		write_count = libcfile_file_write_buffer_at_offset(
+		               file,
+		               buffer,
+		               16,
+		               -1,
+		               &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) -1 );
+
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	if( with_temporary_file != 0 )
+	{
+		result = libcfile_file_close(
+		          file,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_remove(
+		          narrow_temporary_filename,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		with_temporary_file = 0;
+	}
+	result = libcfile_file_free(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( with_temporary_file != 0 )
+	{
+		libcfile_file_remove(
+		 narrow_temporary_filename,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcfile_file_write_vector function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_write_vector(
+     void )
+{
+	char narrow_temporary_filename[ 18 ] = {
+		'c', 'f', 'i', 'l', 'e', '_', 't', 'e', 's', 't', '_', 'X', 'X', 'X', 'X', 'X', 'X', 0 };
+
+	uint8_t buffer[ 32 ] = {
+		'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+		'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', '0', '1', '2', '3', '4', '5' };
+
+	uint8_t read_buffer[ 32 ];
+
+	const uint8_t *buffers[ 2 ] = { NULL, NULL };
+	size_t buffer_sizes[ 2 ]    = { 10, 22 };
+	libcerror_error_t *error    = NULL;
+	libcfile_file_t *file       = NULL;
+	ssize_t read_count          = 0;
+	ssize_t write_count         = 0;
+	off64_t offset              = 0;
+	int result                  = 0;
+	int with_temporary_file     = 0;
+
+	buffers[ 0 ] = &( buffer[ 0 ] );
+	buffers[ 1 ] = &( buffer[ 10 ] );
+
+	/* Initialize test
+	 */
+	result = libcfile_file_initialize(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = cfile_test_get_temporary_filename(
+	          narrow_temporary_filename,
+	          18,
+	          &error );
+
+	CFILE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	with_temporary_file = result;
+
+	if( with_temporary_file != 0 )
+	{
+		result = libcfile_file_open(
+		          file,
+		          narrow_temporary_filename,
+		          LIBCFILE_OPEN_READ_WRITE,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		write_count = libcfile_file_write_vector(
+		               file,
+		               buffers,
+		               buffer_sizes,
+		               2,
+		               &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) 32 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_get_offset(
+		          file,
+		          &offset,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 offset,
+		 (int64_t) 32 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_count = libcfile_file_read_buffer_at_offset(
+		              file,
+		              read_buffer,
+		              32,
+		              0,
+		              &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 32 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          read_buffer,
+		          buffer,
+		          32 );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	write_count = libcfile_file_write_vector(
+	               NULL,
+	               buffers,
+	               buffer_sizes,
+	               2,
+	               &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( with_temporary_file != 0 )
+	{
+		write_count = libcfile_file_write_vector(
+		               file,
+		               NULL,
+		               buffer_sizes,
+		               2,
+		               &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) -1 );
+
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		write_count = libcfile_file_write_vector(
+		               file,
+		               buffers,
+		               NULL,
+		               2,
+		               &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) -1 );
+
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	if( with_temporary_file != 0 )
+	{
+		result = libcfile_file_close(
+		          file,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_remove(
+		          narrow_temporary_filename,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		with_temporary_file = 0;
+	}
+	result = libcfile_file_free(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( with_temporary_file != 0 )
+	{
+		libcfile_file_remove(
+		 narrow_temporary_filename,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcfile_file_write_vector_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_write_vector_at_offset(
+     void )
+{
+	char narrow_temporary_filename[ 18 ] = {
+		'c', 'f', 'i', 'l', 'e', '_', 't', 'e', 's', 't', '_', 'X', 'X', 'X', 'X', 'X', 'X', 0 };
+
+	uint8_t buffer[ 32 ] = {
+		'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+		'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', '0', '1', '2', '3', '4', '5' };
+
+	uint8_t read_buffer[ 32 ];
+
+	const uint8_t *buffers[ 2 ] = { NULL, NULL };
+	size_t buffer_sizes[ 2 ]    = { 16, 16 };
+	libcerror_error_t *error    = NULL;
+	libcfile_file_t *file       = NULL;
+	size64_t file_size          = 0;
+	ssize_t read_count          = 0;
+	ssize_t write_count         = 0;
+	off64_t offset              = 0;
+	int result                  = 0;
+	int with_temporary_file     = 0;
+
+	/* Write the second half of the buffer first to validate the order
+	 */
+	buffers[ 0 ] = &( buffer[ 16 ] );
+	buffers[ 1 ] = &( buffer[ 0 ] );
+
+	/* Initialize test
+	 */
+	result = libcfile_file_initialize(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = cfile_test_get_temporary_filename(
+	          narrow_temporary_filename,
+	          18,
+	          &error );
+
+	CFILE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	with_temporary_file = result;
+
+	if( with_temporary_file != 0 )
+	{
+		result = libcfile_file_open(
+		          file,
+		          narrow_temporary_filename,
+		          LIBCFILE_OPEN_READ_WRITE,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		write_count = libcfile_file_write_vector_at_offset(
+		               file,
+		               buffers,
+		               buffer_sizes,
+		               2,
+		               16,
+		               &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) 32 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Make sure the current offset was not changed
+		 */
+		result = libcfile_file_get_offset(
+		          file,
+		          &offset,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 offset,
+		 (int64_t) 0 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_get_size(
+		          file,
+		          &file_size,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_EQUAL_UINT64(
+		 "file_size",
+		 (uint64_t) file_size,
+		 (uint64_t) 48 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_count = libcfile_file_read_buffer_at_offset(
+		              file,
+		              read_buffer,
+		              16,
+		              32,
+		              &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 16 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          read_buffer,
+		          buffer,
+		          16 );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	write_count = libcfile_file_write_vector_at_offset(
+	               NULL,
+	               buffers,
+	               buffer_sizes,
+	               2,
+	               0,
+	               &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( with_temporary_file != 0 )
+	{
+		write_count = libcfile_file_write_vector_at_offset(
+		               file,
+		               buffers,
+		               buffer_sizes,
+		               2,
+		               -1,
+		               &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) -1 );
+
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		write_count = libcfile_file_write_vector_at_offset(
+		               file,
+		               buffers,
+		               buffer_sizes,
+		               -1,
+		               0,
+		               &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) -1 );
+
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	if( with_temporary_file != 0 )
+	{
+		result = libcfile_file_close(
+		          file,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_remove(
+		          narrow_temporary_filename,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		with_temporary_file = 0;
+	}
+	result = libcfile_file_free(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( with_temporary_file != 0 )
+	{
+		libcfile_file_remove(
+		 narrow_temporary_filename,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcfile_file_submit_write, libcfile_file_set_queue_depth and libcfile_file_register_buffers functions
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_submit_write(
+     void )
+{
+	char narrow_temporary_filename[ 18 ] = {
+		'c', 'f', 'i', 'l', 'e', '_', 't', 'e', 's', 't', '_', 'X', 'X', 'X', 'X', 'X', 'X', 0 };
+
+	uint8_t buffer[ 32 ] = {
+		'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+		'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', '0', '1', '2', '3', '4', '5' };
+
+	uint8_t read_buffer[ 32 ];
+	uint64_t request_identifiers[ 2 ];
+	ssize_t results[ 2 ];
+
+	uint8_t *buffers[ 1 ]     = { NULL };
+	size_t buffer_sizes[ 1 ]  = { 32 };
+	libcerror_error_t *error  = NULL;
+	libcfile_file_t *file     = NULL;
+	size64_t file_size        = 0;
+	ssize_t read_count        = 0;
+	int completion_index      = 0;
+	int number_of_completions = 0;
+	int result                = 0;
+	int with_temporary_file   = 0;
+
+	buffers[ 0 ] = buffer;
+
+	/* Initialize test
+	 */
+	result = libcfile_file_initialize(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = cfile_test_get_temporary_filename(
+	          narrow_temporary_filename,
+	          18,
+	          &error );
+
+	CFILE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	with_temporary_file = result;
+
+	/* Test error cases
+	 */
+	result = libcfile_file_set_queue_depth(
+	          NULL,
+	          2,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_set_queue_depth(
+	          file,
+	          0,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_register_buffers(
+	          NULL,
+	          buffers,
+	          buffer_sizes,
+	          1,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_submit_write(
+	          NULL,
+	          buffer,
+	          16,
+	          0,
+	          0,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the file is not open
+	 */
+	result = libcfile_file_submit_write(
+	          file,
+	          buffer,
+	          16,
+	          0,
+	          0,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( with_temporary_file != 0 )
+	{
+		result = libcfile_file_open(
+		          file,
+		          narrow_temporary_filename,
+		          LIBCFILE_OPEN_READ_WRITE,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		result = libcfile_file_set_queue_depth(
+		          file,
+		          2,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_register_buffers(
+		          file,
+		          buffers,
+		          buffer_sizes,
+		          1,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_submit_write(
+		          file,
+		          &( buffer[ 16 ] ),
+		          16,
+		          16,
+		          1,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_submit_write(
+		          file,
+		          buffer,
+		          16,
+		          0,
+		          2,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test error case where the queue is full
+		 */
+		result = libcfile_file_submit_write(
+		          file,
+		          buffer,
+		          16,
+		          32,
+		          3,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		/* Test that the size is not extended before the completions are polled
+		 */
+		result = libcfile_file_get_size(
+		          file,
+		          &file_size,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_EQUAL_UINT64(
+		 "file_size",
+		 (uint64_t) file_size,
+		 (uint64_t) 0 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		while( completion_index < 2 )
+		{
+			number_of_completions = libcfile_file_poll_completions(
+			                         file,
+			                         request_identifiers,
+			                         results,
+			                         2,
+			                         2 - completion_index,
+			                         &error );
+
+			CFILE_TEST_ASSERT_GREATER_THAN_INT(
+			 "number_of_completions",
+			 number_of_completions,
+			 0 );
+
+			CFILE_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			CFILE_TEST_ASSERT_EQUAL_SSIZE(
+			 "results[ 0 ]",
+			 results[ 0 ],
+			 (ssize_t) 16 );
+
+			completion_index += number_of_completions;
+		}
+		result = libcfile_file_get_size(
+		          file,
+		          &file_size,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_EQUAL_UINT64(
+		 "file_size",
+		 (uint64_t) file_size,
+		 (uint64_t) 32 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_count = libcfile_file_read_buffer_at_offset(
+		              file,
+		              read_buffer,
+		              32,
+		              0,
+		              &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 32 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          read_buffer,
+		          buffer,
+		          32 );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Clean up
+	 */
+	if( with_temporary_file != 0 )
+	{
+		result = libcfile_file_close(
+		          file,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_remove(
+		          narrow_temporary_filename,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		with_temporary_file = 0;
+	}
+	result = libcfile_file_free(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( with_temporary_file != 0 )
+	{
+		libcfile_file_remove(
+		 narrow_temporary_filename,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcfile_file_set_write_buffer_size and libcfile_file_flush functions
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_set_write_buffer_size(
+     void )
+{
+	char narrow_temporary_filename[ 18 ] = {
+		'c', 'f', 'i', 'l', 'e', '_', 't', 'e', 's', 't', '_', 'X', 'X', 'X', 'X', 'X', 'X', 0 };
+
+	uint8_t buffer[ 32 ] = {
+		'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+		'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', '0', '1', '2', '3', '4', '5' };
+
+	uint8_t read_buffer[ 32 ];
+
+	libcerror_error_t *error          = NULL;
+	libcfile_file_t *file             = NULL;
+	libcfile_file_t *read_only_file   = NULL;
+	size64_t file_size                = 0;
+	ssize_t read_count                = 0;
+	ssize_t write_count               = 0;
+	off64_t offset                    = 0;
+	int result                        = 0;
+	int with_temporary_file           = 0;
+
+#if defined( WINAPI )
+	HANDLE file_handle                = INVALID_HANDLE_VALUE;
+#else
+	int file_descriptor               = -1;
+#endif
+
+	/* Initialize test
+	 */
+	result = libcfile_file_initialize(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = cfile_test_get_temporary_filename(
+	          narrow_temporary_filename,
+	          18,
+	          &error );
+
+	CFILE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	with_temporary_file = result;
+
+	/* Test error cases
+	 */
+	result = libcfile_file_set_write_buffer_size(
+	          NULL,
+	          16,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_set_write_buffer_size(
+	          file,
+	          (size_t) LIBCFILE_MAXIMUM_WRITE_BUFFER_SIZE + 1,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_flush(
+	          NULL,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( with_temporary_file != 0 )
+	{
+		result = libcfile_file_open(
+		          file,
+		          narrow_temporary_filename,
+		          LIBCFILE_OPEN_READ_WRITE,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		result = libcfile_file_set_write_buffer_size(
+		          file,
+		          16,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		write_count = libcfile_file_write_buffer(
+		               file,
+		               buffer,
+		               5,
+		               &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) 5 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		write_count = libcfile_file_write_buffer(
+		               file,
+		               &( buffer[ 5 ] ),
+		               5,
+		               &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) 5 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test if the size includes the buffered data
+		 */
+		result = libcfile_file_get_size(
+		          file,
+		          &file_size,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_EQUAL_UINT64(
+		 "file_size",
+		 (uint64_t) file_size,
+		 (uint64_t) 10 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test if the buffered data can be read
+		 */
+		read_count = libcfile_file_read_buffer_at_offset(
+		              file,
+		              read_buffer,
+		              10,
+		              0,
+		              &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 10 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          read_buffer,
+		          buffer,
+		          10 );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* Test a write that fills the write buffer and continues past it
+		 */
+		write_count = libcfile_file_write_buffer(
+		               file,
+		               &( buffer[ 10 ] ),
+		               22,
+		               &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) 22 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_flush(
+		          file,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		offset = libcfile_file_seek_offset(
+		          file,
+		          0,
+		          SEEK_SET,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 offset,
+		 (int64_t) 0 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_count = libcfile_file_read_buffer(
+		              file,
+		              read_buffer,
+		              32,
+		              &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 32 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          read_buffer,
+		          buffer,
+		          32 );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* Test if seek flushes the write buffer
+		 */
+		offset = libcfile_file_seek_offset(
+		          file,
+		          0,
+		          SEEK_SET,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 offset,
+		 (int64_t) 0 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		write_count = libcfile_file_write_buffer(
+		               file,
+		               &( buffer[ 16 ] ),
+		               4,
+		               &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) 4 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		offset = libcfile_file_seek_offset(
+		          file,
+		          0,
+		          SEEK_SET,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 offset,
+		 (int64_t) 0 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_count = libcfile_file_read_buffer(
+		              file,
+		              read_buffer,
+		              4,
+		              &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 4 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          read_buffer,
+		          &( buffer[ 16 ] ),
+		          4 );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* Test if a write returns the size consumed when flushing the write buffer fails
+		 */
+		offset = libcfile_file_seek_offset(
+		          file,
+		          0,
+		          SEEK_SET,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 offset,
+		 (int64_t) 0 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		write_count = libcfile_file_write_buffer(
+		               file,
+		               buffer,
+		               4,
+		               &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) 4 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* A read-only handle or descriptor makes flushing the write buffer fail
+		 */
+		result = libcfile_file_initialize(
+		          &read_only_file,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_open(
+		          read_only_file,
+		          narrow_temporary_filename,
+		          LIBCFILE_OPEN_READ,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+#if defined( WINAPI )
+		file_handle = ( (libcfile_internal_file_t *) file )->handle;
+
+		( (libcfile_internal_file_t *) file )->handle = ( (libcfile_internal_file_t *) read_only_file )->handle;
+#else
+		file_descriptor = ( (libcfile_internal_file_t *) file )->descriptor;
+
+		( (libcfile_internal_file_t *) file )->descriptor = ( (libcfile_internal_file_t *) read_only_file )->descriptor;
+#endif
+
+		write_count = libcfile_file_write_buffer(
+		               file,
+		               &( buffer[ 4 ] ),
+		               16,
+		               &error );
+
+#if defined( WINAPI )
+		( (libcfile_internal_file_t *) file )->handle = file_handle;
+#else
+		( (libcfile_internal_file_t *) file )->descriptor = file_descriptor;
+#endif
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) 12 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_close(
+		          read_only_file,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_free(
+		          &read_only_file,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_flush(
+		          file,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_count = libcfile_file_read_buffer_at_offset(
+		              file,
+		              read_buffer,
+		              16,
+		              0,
+		              &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 16 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          read_buffer,
+		          buffer,
+		          16 );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* Test if close flushes the write buffer
+		 */
+		offset = libcfile_file_seek_offset(
+		          file,
+		          0,
+		          SEEK_END,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 offset,
+		 (int64_t) 32 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		write_count = libcfile_file_write_buffer(
+		               file,
+		               buffer,
+		               4,
+		               &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) 4 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_close(
+		          file,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_open(
+		          file,
+		          narrow_temporary_filename,
+		          LIBCFILE_OPEN_READ,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_get_size(
+		          file,
+		          &file_size,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_EQUAL_UINT64(
+		 "file_size",
+		 (uint64_t) file_size,
+		 (uint64_t) 36 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_count = libcfile_file_read_buffer_at_offset(
+		              file,
+		              read_buffer,
+		              4,
+		              32,
+		              &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 4 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          read_buffer,
+		          buffer,
+		          4 );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = libcfile_file_set_write_buffer_size(
+		          file,
+		          0,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	if( with_temporary_file != 0 )
+	{
+		result = libcfile_file_close(
+		          file,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_remove(
+		          narrow_temporary_filename,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		with_temporary_file = 0;
+	}
+	result = libcfile_file_free(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( with_temporary_file != 0 )
+	{
+		libcfile_file_remove(
+		 narrow_temporary_filename,
+		 NULL );
+	}
+	if( read_only_file != NULL )
+	{
+		libcfile_file_free(
+		 &read_only_file,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcfile_file_allocate and libcfile_file_set_preallocation_size functions
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_allocate(
+     void )
+{
+	char narrow_temporary_filename[ 18 ] = {
+		'c', 'f', 'i', 'l', 'e', '_', 't', 'e', 's', 't', '_', 'X', 'X', 'X', 'X', 'X', 'X', 0 };
+
+	uint8_t buffer[ 32 ] = {
+		'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+		'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', '0', '1', '2', '3', '4', '5' };
+
+	libcerror_error_t *error = NULL;
+	libcfile_file_t *file    = NULL;
+	size64_t expected_size   = 0;
+	size64_t file_size       = 0;
+	ssize_t write_count      = 0;
+	off64_t offset           = 0;
+	int result               = 0;
+	int with_temporary_file  = 0;
+
+	/* Initialize test
+	 */
+	result = libcfile_file_initialize(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = cfile_test_get_temporary_filename(
+	          narrow_temporary_filename,
+	          18,
+	          &error );
+
+	CFILE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	with_temporary_file = result;
+
+	/* Test error cases
+	 */
+	result = libcfile_file_allocate(
+	          NULL,
+	          0,
+	          4096,
+	          0,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_set_preallocation_size(
+	          NULL,
+	          65536,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_set_preallocation_size(
+	          file,
+	          (size64_t) LIBCFILE_MAXIMUM_PREALLOCATION_SIZE + 1,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the file is not open
+	 */
+	result = libcfile_file_allocate(
+	          file,
+	          0,
+	          4096,
+	          0,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( with_temporary_file != 0 )
+	{
+		result = libcfile_file_open(
+		          file,
+		          narrow_temporary_filename,
+		          LIBCFILE_OPEN_READ_WRITE,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		result = libcfile_file_allocate(
+		          file,
+		          0,
+		          4096,
+		          0,
+		          &error );
+
+		CFILE_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result != 0 )
+		{
+			expected_size = 4096;
+		}
+		result = libcfile_file_allocate(
+		          file,
+		          4096,
+		          8192,
+		          LIBCFILE_ALLOCATE_FLAG_KEEP_SIZE,
+		          &error );
+
+		CFILE_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_get_size(
+		          file,
+		          &file_size,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_EQUAL_UINT64(
+		 "file_size",
+		 (uint64_t) file_size,
+		 (uint64_t) expected_size );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_set_preallocation_size(
+		          file,
+		          65536,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		offset = libcfile_file_seek_offset(
+		          file,
+		          0,
+		          SEEK_END,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 offset,
+		 (int64_t) expected_size );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		write_count = libcfile_file_write_buffer(
+		               file,
+		               buffer,
+		               32,
+		               &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) 32 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test if close releases the preallocated storage without changing the size
+		 */
+		result = libcfile_file_close(
+		          file,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_open(
+		          file,
+		          narrow_temporary_filename,
+		          LIBCFILE_OPEN_READ,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_get_size(
+		          file,
+		          &file_size,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_EQUAL_UINT64(
+		 "file_size",
+		 (uint64_t) file_size,
+		 (uint64_t) expected_size + 32 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test error cases
+		 */
+		result = libcfile_file_allocate(
+		          file,
+		          0,
+		          4096,
+		          0,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libcfile_file_set_preallocation_size(
+		          file,
+		          0,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	if( with_temporary_file != 0 )
+	{
+		result = libcfile_file_close(
+		          file,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_remove(
+		          narrow_temporary_filename,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		with_temporary_file = 0;
+	}
+	result = libcfile_file_free(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( with_temporary_file != 0 )
+	{
+		libcfile_file_remove(
+		 narrow_temporary_filename,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcfile_file_get_next_data_extent and libcfile_file_set_skip_holes functions
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_get_next_data_extent(
+     void )
+{
+	char narrow_temporary_filename[ 18 ] = {
+		'c', 'f', 'i', 'l', 'e', '_', 't', 'e', 's', 't', '_', 'X', 'X', 'X', 'X', 'X', 'X', 0 };
+
+	uint8_t buffer[ 32 ] = {
+		'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+		'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', '0', '1', '2', '3', '4', '5' };
+
+	uint8_t zero_buffer[ 16 ] = {
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+	uint8_t read_buffer[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	libcfile_file_t *file    = NULL;
+	size64_t extent_size     = 0;
+	ssize_t read_count       = 0;
+	ssize_t write_count      = 0;
+	off64_t extent_offset    = 0;
+	int result               = 0;
+	int with_temporary_file  = 0;
+
+	/* Initialize test
+	 */
+	result = libcfile_file_initialize(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = cfile_test_get_temporary_filename(
+	          narrow_temporary_filename,
+	          18,
+	          &error );
+
+	CFILE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	with_temporary_file = result;
+
+	/* Test error cases
+	 */
+	result = libcfile_file_get_next_data_extent(
+	          NULL,
+	          0,
+	          &extent_offset,
+	          &extent_size,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_set_skip_holes(
+	          NULL,
+	          1,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the file is not open
+	 */
+	result = libcfile_file_get_next_data_extent(
+	          file,
+	          0,
+	          &extent_offset,
+	          &extent_size,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( with_temporary_file != 0 )
+	{
+		/* Create a file with a hole between 2 data extents
+		 */
+		result = libcfile_file_open(
+		          file,
+		          narrow_temporary_filename,
+		          LIBCFILE_OPEN_READ_WRITE,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		write_count = libcfile_file_write_buffer_at_offset(
+		               file,
+		               buffer,
+		               16,
+		               0,
+		               &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) 16 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		write_count = libcfile_file_write_buffer_at_offset(
+		               file,
+		               &( buffer[ 16 ] ),
+		               16,
+		               1048576,
+		               &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) 16 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test error case where holes are skipped with write access
+		 */
+		result = libcfile_file_set_skip_holes(
+		          file,
+		          1,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libcfile_file_close(
+		          file,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_open(
+		          file,
+		          narrow_temporary_filename,
+		          LIBCFILE_OPEN_READ,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		result = libcfile_file_get_next_data_extent(
+		          file,
+		          0,
+		          &extent_offset,
+		          &extent_size,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT64(
+		 "extent_offset",
+		 extent_offset,
+		 (int64_t) 0 );
+
+		CFILE_TEST_ASSERT_NOT_EQUAL_INT64(
+		 "extent_size",
+		 (int64_t) extent_size,
+		 (int64_t) 0 );
+
+		result = libcfile_file_get_next_data_extent(
+		          file,
+		          1048576,
+		          &extent_offset,
+		          &extent_size,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CFILE_TEST_ASSERT_EQUAL_UINT64(
+		 "extent_end",
+		 (uint64_t) extent_offset + extent_size,
+		 (uint64_t) 1048592 );
+
+		result = libcfile_file_get_next_data_extent(
+		          file,
+		          1048592,
+		          &extent_offset,
+		          &extent_size,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_set_skip_holes(
+		          file,
+		          1,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_count = libcfile_file_read_buffer_at_offset(
+		              file,
+		              read_buffer,
+		              32,
+		              1048560,
+		              &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 32 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          read_buffer,
+		          zero_buffer,
+		          16 );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = memory_compare(
+		          &( read_buffer[ 16 ] ),
+		          &( buffer[ 16 ] ),
+		          16 );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		read_count = libcfile_file_read_buffer(
+		              file,
+		              read_buffer,
+		              32,
+		              &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 32 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          read_buffer,
+		          buffer,
+		          16 );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = memory_compare(
+		          &( read_buffer[ 16 ] ),
+		          zero_buffer,
+		          16 );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* Test error cases
+		 */
+		result = libcfile_file_get_next_data_extent(
+		          file,
+		          -1,
+		          &extent_offset,
+		          &extent_size,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libcfile_file_get_next_data_extent(
+		          file,
+		          0,
+		          NULL,
+		          &extent_size,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libcfile_file_get_next_data_extent(
+		          file,
+		          0,
+		          &extent_offset,
+		          NULL,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	if( with_temporary_file != 0 )
+	{
+		result = libcfile_file_close(
+		          file,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_remove(
+		          narrow_temporary_filename,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		with_temporary_file = 0;
+	}
+	result = libcfile_file_free(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( with_temporary_file != 0 )
+	{
+		libcfile_file_remove(
+		 narrow_temporary_filename,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcfile_file_get_extents function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_get_extents(
+     void )
+{
+	char narrow_temporary_filename[ 18 ] = {
+		'c', 'f', 'i', 'l', 'e', '_', 't', 'e', 's', 't', '_', 'X', 'X', 'X', 'X', 'X', 'X', 0 };
+
+	uint8_t buffer[ 32 ] = {
+		'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+		'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', '0', '1', '2', '3', '4', '5' };
+
+	off64_t logical_offsets[ 8 ];
+	off64_t physical_offsets[ 8 ];
+	size64_t extent_sizes[ 8 ];
+	uint32_t extent_flags[ 8 ];
+
+	libcerror_error_t *error = NULL;
+	libcfile_file_t *file    = NULL;
+	ssize_t write_count      = 0;
+	int number_of_extents    = 0;
+	int result               = 0;
+	int with_temporary_file  = 0;
+
+	/* Initialize test
+	 */
+	result = libcfile_file_initialize(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = cfile_test_get_temporary_filename(
+	          narrow_temporary_filename,
+	          18,
+	          &error );
+
+	CFILE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	with_temporary_file = result;
+
+	/* Test error cases
+	 */
+	result = libcfile_file_get_extents(
+	          NULL,
+	          0,
+	          logical_offsets,
+	          physical_offsets,
+	          extent_sizes,
+	          extent_flags,
+	          8,
+	          &number_of_extents,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the file is not open
+	 */
+	result = libcfile_file_get_extents(
+	          file,
+	          0,
+	          logical_offsets,
+	          physical_offsets,
+	          extent_sizes,
+	          extent_flags,
+	          8,
+	          &number_of_extents,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( with_temporary_file != 0 )
+	{
+		result = libcfile_file_open(
+		          file,
+		          narrow_temporary_filename,
+		          LIBCFILE_OPEN_READ_WRITE,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		write_count = libcfile_file_write_buffer(
+		               file,
+		               buffer,
+		               32,
+		               &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) 32 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		result = libcfile_file_get_extents(
+		          file,
+		          0,
+		          logical_offsets,
+		          physical_offsets,
+		          extent_sizes,
+		          extent_flags,
+		          8,
+		          &number_of_extents,
+		          &error );
+
+		CFILE_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result == 1 )
+		{
+			CFILE_TEST_ASSERT_EQUAL_INT(
+			 "number_of_extents",
+			 number_of_extents,
+			 1 );
+
+			CFILE_TEST_ASSERT_EQUAL_INT64(
+			 "logical_offsets[ 0 ]",
+			 (int64_t) logical_offsets[ 0 ],
+			 (int64_t) 0 );
+
+			CFILE_TEST_ASSERT_EQUAL_UINT32(
+			 "extent_flags[ 0 ] & LIBCFILE_EXTENT_FLAG_LAST",
+			 ( extent_flags[ 0 ] & LIBCFILE_EXTENT_FLAG_LAST ),
+			 LIBCFILE_EXTENT_FLAG_LAST );
+		}
+		result = libcfile_file_get_extents(
+		          file,
+		          1048576,
+		          logical_offsets,
+		          physical_offsets,
+		          extent_sizes,
+		          extent_flags,
+		          8,
+		          &number_of_extents,
+		          &error );
+
+		CFILE_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result == 1 )
+		{
+			CFILE_TEST_ASSERT_EQUAL_INT(
+			 "number_of_extents",
+			 number_of_extents,
+			 0 );
+		}
+		/* Test error cases
+		 */
+		result = libcfile_file_get_extents(
+		          file,
+		          -1,
+		          logical_offsets,
+		          physical_offsets,
+		          extent_sizes,
+		          extent_flags,
+		          8,
+		          &number_of_extents,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libcfile_file_get_extents(
+		          file,
+		          0,
+		          NULL,
+		          physical_offsets,
+		          extent_sizes,
+		          extent_flags,
+		          8,
+		          &number_of_extents,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libcfile_file_get_extents(
+		          file,
+		          0,
+		          logical_offsets,
+		          NULL,
+		          extent_sizes,
+		          extent_flags,
+		          8,
+		          &number_of_extents,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libcfile_file_get_extents(
+		          file,
+		          0,
+		          logical_offsets,
+		          physical_offsets,
+		          NULL,
+		          extent_flags,
+		          8,
+		          &number_of_extents,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libcfile_file_get_extents(
+		          file,
+		          0,
+		          logical_offsets,
+		          physical_offsets,
+		          extent_sizes,
+		          NULL,
+		          8,
+		          &number_of_extents,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libcfile_file_get_extents(
+		          file,
+		          0,
+		          logical_offsets,
+		          physical_offsets,
+		          extent_sizes,
+		          extent_flags,
+		          0,
+		          &number_of_extents,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libcfile_file_get_extents(
+		          file,
+		          0,
+		          logical_offsets,
+		          physical_offsets,
+		          extent_sizes,
+		          extent_flags,
+		          8,
+		          NULL,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	if( with_temporary_file != 0 )
+	{
+		result = libcfile_file_close(
+		          file,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_remove(
+		          narrow_temporary_filename,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		with_temporary_file = 0;
+	}
+	result = libcfile_file_free(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( with_temporary_file != 0 )
+	{
+		libcfile_file_remove(
+		 narrow_temporary_filename,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_CFILE_TEST_MEMORY )
+
+/* Starts counting memory allocations
+ * Every allocation decrements the number of attempts before fail
+ */
+void cfile_test_file_start_allocation_count(
+      void )
+{
+	cfile_test_malloc_attempts_before_fail  = 1024;
+	cfile_test_realloc_attempts_before_fail = 1024;
+
+#if defined( HAVE_POSIX_MEMALIGN )
+	cfile_test_posix_memalign_attempts_before_fail = 1024;
+#endif
+}
+
+/* Stops counting memory allocations
+ * Returns the number of memory allocations since the count was started
+ */
+int cfile_test_file_stop_allocation_count(
+     void )
+{
+	int number_of_allocations = 0;
+
+	number_of_allocations = ( 1024 - cfile_test_malloc_attempts_before_fail )
+	                      + ( 1024 - cfile_test_realloc_attempts_before_fail );
+
+	cfile_test_malloc_attempts_before_fail  = -1;
+	cfile_test_realloc_attempts_before_fail = -1;
+
+#if defined( HAVE_POSIX_MEMALIGN )
+	number_of_allocations += 1024 - cfile_test_posix_memalign_attempts_before_fail;
+
+	cfile_test_posix_memalign_attempts_before_fail = -1;
+#endif
+	return( number_of_allocations );
+}
+
+/* Tests that reading, writing and seeking an open file does not allocate memory
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_read_write_without_allocation(
+     void )
+{
+	char narrow_temporary_filename[ 18 ] = {
+		'c', 'f', 'i', 'l', 'e', '_', 't', 'e', 's', 't', '_', 'X', 'X', 'X', 'X', 'X', 'X', 0 };
+
+	uint8_t buffer[ 8192 + 1 ];
+
+	libcerror_error_t *error  = NULL;
+	libcfile_file_t *file     = NULL;
+	ssize_t read_count        = 0;
+	ssize_t write_count       = 0;
+	off64_t current_offset    = 0;
+	off64_t offset            = 0;
+	int number_of_allocations = 0;
+	int record_index          = 0;
+	int result                = 0;
+	int with_temporary_file   = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          buffer,
+	          'A',
+	          8192 + 1 ) != NULL;
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcfile_file_initialize(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = cfile_test_get_temporary_filename(
+	          narrow_temporary_filename,
+	          18,
+	          &error );
+
+	CFILE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	with_temporary_file = result;
+
+	if( with_temporary_file != 0 )
+	{
+		result = libcfile_file_open(
+		          file,
+		          narrow_temporary_filename,
+		          LIBCFILE_OPEN_READ_WRITE,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		cfile_test_file_start_allocation_count();
+
+		for( record_index = 0;
+		     record_index < 256;
+		     record_index++ )
+		{
+			write_count = libcfile_file_write_buffer(
+			               file,
+			               buffer,
+			               32,
+			               &error );
+
+			if( write_count != 32 )
+			{
+				break;
+			}
+		}
+		if( record_index == 256 )
+		{
+			offset = libcfile_file_seek_offset(
+			          file,
+			          0,
+			          SEEK_SET,
+			          &error );
+
+			for( record_index = 0;
+			     record_index < 256;
+			     record_index++ )
+			{
+				read_count = libcfile_file_read_buffer(
+				              file,
+				              buffer,
+				              32,
+				              &error );
+
+				if( read_count != 32 )
+				{
+					break;
+				}
+				result = libcfile_file_get_offset(
+				          file,
+				          &current_offset,
+				          &error );
+
+				if( ( result != 1 )
+				 || ( current_offset != (off64_t) ( ( record_index + 1 ) * 32 ) ) )
+				{
+					break;
+				}
+			}
+		}
+		number_of_allocations = cfile_test_file_stop_allocation_count();
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "record_index",
+		 record_index,
+		 256 );
+
+		CFILE_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 (int64_t) offset,
+		 (int64_t) 0 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "number_of_allocations",
+		 number_of_allocations,
+		 0 );
+
+		result = libcfile_file_close(
+		          file,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test with direct access reading into a buffer that is not aligned in memory
+		 */
+		result = libcfile_file_open(
+		          file,
+		          narrow_temporary_filename,
+		          LIBCFILE_OPEN_READ | LIBCFILE_ACCESS_FLAG_DIRECT,
+		          &error );
+
+		CFILE_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		if( result == -1 )
+		{
+			/* Not all file systems support direct access
+			 */
+			CFILE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+		else
+		{
+			CFILE_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			cfile_test_file_start_allocation_count();
+
+			read_count = libcfile_file_read_buffer(
+			              file,
+			              &( buffer[ 1 ] ),
+			              8192,
+			              &error );
+
+			if( read_count == 8192 )
+			{
+				offset = libcfile_file_seek_offset(
+				          file,
+				          7,
+				          SEEK_SET,
+				          &error );
+
+				read_count = libcfile_file_read_buffer(
+				              file,
+				              buffer,
+				              16,
+				              &error );
+			}
+			number_of_allocations = cfile_test_file_stop_allocation_count();
+
+			CFILE_TEST_ASSERT_EQUAL_SSIZE(
+			 "read_count",
+			 read_count,
+			 (ssize_t) 16 );
+
+			CFILE_TEST_ASSERT_EQUAL_INT64(
+			 "offset",
+			 (int64_t) offset,
+			 (int64_t) 7 );
+
+			CFILE_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			CFILE_TEST_ASSERT_EQUAL_INT(
+			 "number_of_allocations",
+			 number_of_allocations,
+			 0 );
+
+			result = libcfile_file_close(
+			          file,
+			          &error );
+
+			CFILE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			CFILE_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		/* Clean up
+		 */
+		result = libcfile_file_remove(
+		          narrow_temporary_filename,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		with_temporary_file = 0;
+	}
+	result = libcfile_file_free(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( with_temporary_file != 0 )
+	{
+		libcfile_file_remove(
+		 narrow_temporary_filename,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_CFILE_TEST_MEMORY ) */
+
 /* Tests the libcfile_file_seek_offset function
  * Returns 1 if successful or 0 if not
  */
-int cfile_test_file_seek_offset(
+int cfile_test_file_seek_offset(
+     libcfile_file_t *file )
+{
+	libcerror_error_t *error     = NULL;
+	libcfile_file_t *closed_file = NULL;
+	size64_t file_size           = 0;
+	off64_t offset               = 0;
+	off64_t seek_offset          = 0;
+	int result                   = 0;
+
+#if !defined( WINAPI )
+	off64_t descriptor_offset    = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = libcfile_file_get_size(
+	          file,
+	          &file_size,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: 0 and whence: SEEK_SET
+	 */
+	seek_offset = 0;
+
+	offset = libcfile_file_seek_offset(
+	          file,
+	          seek_offset,
+	          SEEK_SET,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) seek_offset );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if !defined( WINAPI )
+	/* Test that the seek does not change the offset of the file descriptor
+	 */
+	descriptor_offset = ( (libcfile_internal_file_t *) file )->descriptor_offset;
+
+	seek_offset = (off64_t) ( file_size / 3 );
+
+	offset = libcfile_file_seek_offset(
+	          file,
+	          seek_offset,
+	          SEEK_SET,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) seek_offset );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT64(
+	 "descriptor_offset",
+	 (int64_t) ( (libcfile_internal_file_t *) file )->descriptor_offset,
+	 (int64_t) descriptor_offset );
+
+#endif /* !defined( WINAPI ) */
+
+	/* Test seek offset with offset: <file_size> and whence: SEEK_SET
+	 */
+	seek_offset = (off64_t) file_size;
+
+	offset = libcfile_file_seek_offset(
+	          file,
+	          seek_offset,
+	          SEEK_SET,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) seek_offset );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: <file_size / 5> and whence: SEEK_SET
+	 */
+	seek_offset = (off64_t) ( file_size / 5 );
+
+	offset = libcfile_file_seek_offset(
+	          file,
+	          seek_offset,
+	          SEEK_SET,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) seek_offset );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: <file_size / 5> and whence: SEEK_CUR
+	 */
+	offset = libcfile_file_seek_offset(
+	          file,
+	          seek_offset,
+	          SEEK_CUR,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) seek_offset + seek_offset );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: <-1 * (file_size / 5)> and whence: SEEK_CUR
+	 */
+	offset = libcfile_file_seek_offset(
+	          file,
+	          -1 * seek_offset,
+	          SEEK_CUR,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) seek_offset );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: <file_size + 987> and whence: SEEK_SET
+	 */
+	seek_offset = (off64_t) ( file_size + 987 );
+
+	offset = libcfile_file_seek_offset(
+	          file,
+	          seek_offset,
+	          SEEK_SET,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) seek_offset );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: 0 and whence: SEEK_CUR
+	 */
+	offset = libcfile_file_seek_offset(
+	          file,
+	          0,
+	          SEEK_CUR,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) seek_offset );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: 0 and whence: SEEK_END
+	 */
+	offset = libcfile_file_seek_offset(
+	          file,
+	          0,
+	          SEEK_END,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) file_size );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: <-1 * (file_size / 4)> and whence: SEEK_END
+	 */
+	seek_offset = (off64_t) ( file_size / 4 );
+
+	offset = libcfile_file_seek_offset(
+	          file,
+	          -1 * seek_offset,
+	          SEEK_END,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) file_size - seek_offset );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: 542 and whence: SEEK_END
+	 */
+	offset = libcfile_file_seek_offset(
+	          file,
+	          542,
+	          SEEK_END,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) file_size + 542 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: <-1 * file_size> and whence: SEEK_END
+	 */
+	offset = libcfile_file_seek_offset(
+	          file,
+	          -1 * file_size,
+	          SEEK_END,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	offset = libcfile_file_seek_offset(
+	          NULL,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test seek offset with offset: -987 and whence: SEEK_SET
+	 */
+	offset = libcfile_file_seek_offset(
+	          file,
+	          -987,
+	          SEEK_SET,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test seek offset with offset: <1 * (file_size + 542)> and whence: SEEK_END
+	 */
+	offset = libcfile_file_seek_offset(
+	          file,
+	          -1 * (file_size + 542),
+	          SEEK_END,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test seek offset with offset: INT64_MAX and whence: SEEK_CUR
+	 */
+	offset = libcfile_file_seek_offset(
+	          file,
+	          1,
+	          SEEK_SET,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libcfile_file_seek_offset(
+	          file,
+	          (off64_t) INT64_MAX,
+	          SEEK_CUR,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test seek offset with offset: 0 and whence: UNKNOWN (88)
+	 */
+	offset = libcfile_file_seek_offset(
+	          file,
+	          0,
+	          88,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Initialize test
+	 */
+	result = libcfile_file_initialize(
+	          &closed_file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "closed_file",
+	 closed_file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset on a closed file
+	 */
+	offset = libcfile_file_seek_offset(
+	          closed_file,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcfile_file_free(
+	          &closed_file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "closed_file",
+	 closed_file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( closed_file != NULL )
+	{
+		libcfile_file_free(
+		 &closed_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcfile_file_resize function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_resize(
+     void )
+{
+	char narrow_temporary_filename[ 18 ] = {
+		'c', 'f', 'i', 'l', 'e', '_', 't', 'e', 's', 't', '_', 'X', 'X', 'X', 'X', 'X', 'X', 0 };
+
+	uint8_t buffer[ 32 ] = {
+		'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+		'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', '0', '1', '2', '3', '4', '5' };
+
+	libcerror_error_t *error = NULL;
+	libcfile_file_t *file    = NULL;
+	ssize_t write_count      = 0;
+	int result               = 0;
+	int with_temporary_file  = 0;
+
+	/* Initialize test
+	 */
+	result = libcfile_file_initialize(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = cfile_test_get_temporary_filename(
+	          narrow_temporary_filename,
+	          18,
+	          &error );
+
+	CFILE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	with_temporary_file = result;
+
+	if( with_temporary_file != 0 )
+	{
+		result = libcfile_file_open(
+		          file,
+		          narrow_temporary_filename,
+		          LIBCFILE_OPEN_WRITE,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		write_count = libcfile_file_write_buffer(
+		               file,
+		               buffer,
+		               32,
+		               &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) 32 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		result = libcfile_file_resize(
+		          file,
+		          16,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libcfile_file_resize(
+	          NULL,
+	          16,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_resize(
+	          file,
+	          (size64_t) INT64_MAX + 1,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	if( with_temporary_file != 0 )
+	{
+		result = libcfile_file_close(
+		          file,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_remove(
+		          narrow_temporary_filename,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		with_temporary_file = 0;
+	}
+	result = libcfile_file_free(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( with_temporary_file != 0 )
+	{
+		libcfile_file_remove(
+		 narrow_temporary_filename,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcfile_file_open functions
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_open(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	libcfile_file_t *file    = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = cfile_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_file_initialize(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcfile_file_open(
+	          file,
+	          narrow_source,
+	          LIBCFILE_OPEN_READ,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcfile_file_open(
+	          file,
+	          narrow_source,
+	          LIBCFILE_OPEN_READ,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcfile_file_close(
+	          file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_file_free(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcfile_file_open_with_error_code functions
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_open_with_error_code(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	libcfile_file_t *file    = NULL;
+	uint32_t error_code      = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = cfile_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_file_initialize(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcfile_file_open_with_error_code(
+	          file,
+	          narrow_source,
+	          LIBCFILE_OPEN_READ,
+	          &error_code,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcfile_file_open_with_error_code(
+	          file,
+	          narrow_source,
+	          LIBCFILE_OPEN_READ,
+	          &error_code,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcfile_file_close(
+	          file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcfile_file_open_with_error_code(
+	          NULL,
+	          narrow_source,
+	          LIBCFILE_OPEN_READ,
+	          &error_code,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_open_with_error_code(
+	          file,
+	          NULL,
+	          LIBCFILE_OPEN_READ,
+	          &error_code,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_open_with_error_code(
+	          file,
+	          narrow_source,
+	          0,
+	          &error_code,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_open_with_error_code(
+	          file,
+	          narrow_source,
+	          LIBCFILE_OPEN_READ,
+	          NULL,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases without an error
+	 */
+	error_code = 0;
+
+#if defined( HAVE_CFILE_TEST_MEMORY )
+	/* Test that libcfile_file_open_with_error_code does not allocate memory
+	 */
+	cfile_test_malloc_attempts_before_fail = 0;
+#endif
+	result = libcfile_file_open_with_error_code(
+	          file,
+	          "bogus",
+	          LIBCFILE_OPEN_READ,
+	          &error_code,
+	          NULL );
+
+#if defined( HAVE_CFILE_TEST_MEMORY )
+	/* A malloc attempt would have reset the value to -1
+	 */
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "cfile_test_malloc_attempts_before_fail",
+	 cfile_test_malloc_attempts_before_fail,
+	 0 );
+
+	cfile_test_malloc_attempts_before_fail = -1;
+
+#endif
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_NOT_EQUAL_INT32(
+	 "error_code",
+	 (int32_t) error_code,
+	 (int32_t) 0 );
+
+	/* Clean up
+	 */
+	result = libcfile_file_close(
+	          file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_file_free(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Tests the libcfile_file_open_wide functions
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_open_wide(
+     const system_character_t *source )
+{
+	wchar_t wide_source[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	libcfile_file_t *file    = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = cfile_test_get_wide_source(
+	          source,
+	          wide_source,
+	          256,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_file_initialize(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcfile_file_open_wide(
+	          file,
+	          wide_source,
+	          LIBCFILE_OPEN_READ,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcfile_file_open_wide(
+	          file,
+	          wide_source,
+	          LIBCFILE_OPEN_READ,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcfile_file_close(
+	          file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_file_free(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcfile_file_open_wide_with_error_code functions
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_open_wide_with_error_code(
+     const system_character_t *source )
+{
+	wchar_t wide_source[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	libcfile_file_t *file    = NULL;
+	uint32_t error_code      = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = cfile_test_get_wide_source(
+	          source,
+	          wide_source,
+	          256,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_file_initialize(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcfile_file_open_wide_with_error_code(
+	          file,
+	          wide_source,
+	          LIBCFILE_OPEN_READ,
+	          &error_code,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcfile_file_open_wide_with_error_code(
+	          file,
+	          wide_source,
+	          LIBCFILE_OPEN_READ,
+	          &error_code,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcfile_file_close(
+	          file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcfile_file_open_wide_with_error_code(
+	          NULL,
+	          wide_source,
+	          LIBCFILE_OPEN_READ,
+	          &error_code,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_open_wide_with_error_code(
+	          file,
+	          NULL,
+	          LIBCFILE_OPEN_READ,
+	          &error_code,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_open_wide_with_error_code(
+	          file,
+	          wide_source,
+	          0,
+	          &error_code,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_open_wide_with_error_code(
+	          file,
+	          wide_source,
+	          LIBCFILE_OPEN_READ,
+	          NULL,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcfile_file_close(
+	          file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_file_free(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Tests the libcfile_file_close function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_close(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcfile_file_close(
+	          NULL,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcfile_file_open and libcfile_file_close functions
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_open_close(
+     const system_character_t *source )
+{
+	libcerror_error_t *error = NULL;
+	libcfile_file_t *file    = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libcfile_file_initialize(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+	          file,
+	          source,
+	          LIBCFILE_OPEN_READ,
+	          &error );
+#else
+	result = libcfile_file_open(
+	          file,
+	          source,
+	          LIBCFILE_OPEN_READ,
+	          &error );
+#endif
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_file_close(
+	          file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close a second time to validate clean up on close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+	          file,
+	          source,
+	          LIBCFILE_OPEN_READ,
+	          &error );
+#else
+	result = libcfile_file_open(
+	          file,
+	          source,
+	          LIBCFILE_OPEN_READ,
+	          &error );
+#endif
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_file_close(
+	          file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libcfile_file_free(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcfile_file_read_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_read_buffer(
+     libcfile_file_t *file )
+{
+	uint8_t buffer[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	size64_t file_size       = 0;
+	ssize_t read_count       = 0;
+	off64_t offset           = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libcfile_file_get_size(
+	          file,
+	          &file_size,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( file_size < 32 )
+	{
+		return( 1 );
+	}
+	offset = libcfile_file_seek_offset(
+	          file,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_count = libcfile_file_read_buffer(
+	              file,
+	              buffer,
+	              32,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 32 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libcfile_file_read_buffer(
+	              NULL,
+	              buffer,
+	              32,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT )
+
+/* Tests the libcfile_internal_file_read_buffer_at_offset_with_error_code function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_internal_file_read_buffer_at_offset_with_error_code(
+     libcfile_file_t *file )
+{
+	uint8_t buffer[ 32 ];
+
+	libcerror_error_t *error     = NULL;
+	libcfile_file_t *closed_file = NULL;
+	size64_t file_size           = 0;
+	ssize_t read_count           = 0;
+	off64_t offset               = 0;
+	uint32_t error_code          = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = libcfile_file_get_size(
+	          file,
+	          &file_size,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( file_size < 32 )
+	{
+		return( 1 );
+	}
+	offset = libcfile_file_seek_offset(
+	          file,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_count = libcfile_internal_file_read_buffer_at_offset_with_error_code(
+	              (libcfile_internal_file_t *) file,
+	              0,
+	              buffer,
+	              32,
+	              &error_code,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 32 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libcfile_internal_file_read_buffer_at_offset_with_error_code(
+	              NULL,
+	              0,
+	              buffer,
+	              32,
+	              &error_code,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libcfile_internal_file_read_buffer_at_offset_with_error_code(
+	              (libcfile_internal_file_t *) file,
+	              -1,
+	              buffer,
+	              32,
+	              &error_code,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libcfile_internal_file_read_buffer_at_offset_with_error_code(
+	              (libcfile_internal_file_t *) file,
+	              0,
+	              NULL,
+	              32,
+	              &error_code,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libcfile_internal_file_read_buffer_at_offset_with_error_code(
+	              (libcfile_internal_file_t *) file,
+	              0,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              &error_code,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libcfile_internal_file_read_buffer_at_offset_with_error_code(
+	              (libcfile_internal_file_t *) file,
+	              0,
+	              buffer,
+	              32,
+	              NULL,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Initialize test
+	 */
+	result = libcfile_file_initialize(
+	          &closed_file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "closed_file",
+	 closed_file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read buffer with error code on a closed file
+	 */
+	read_count = libcfile_internal_file_read_buffer_at_offset_with_error_code(
+	              (libcfile_internal_file_t *) closed_file,
+	              0,
+	              buffer,
+	              32,
+	              &error_code,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcfile_file_free(
+	          &closed_file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "closed_file",
+	 closed_file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( closed_file != NULL )
+	{
+		libcfile_file_free(
+		 &closed_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT ) */
+
+/* Tests the libcfile_file_read_buffer_with_error_code function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_read_buffer_with_error_code(
+     libcfile_file_t *file )
+{
+	uint8_t buffer[ 32 ];
+
+	libcerror_error_t *error     = NULL;
+	libcfile_file_t *closed_file = NULL;
+	size64_t file_size           = 0;
+	ssize_t read_count           = 0;
+	off64_t offset               = 0;
+	uint32_t error_code          = 0;
+	int result                   = 0;
+
+#if defined( WINAPI )
+	HANDLE file_handle           = INVALID_HANDLE_VALUE;
+#else
+	int file_descriptor          = -1;
+#endif
+
+	/* Initialize test
+	 */
+	result = libcfile_file_get_size(
+	          file,
+	          &file_size,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( file_size < 32 )
+	{
+		return( 1 );
+	}
+	offset = libcfile_file_seek_offset(
+	          file,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_count = libcfile_file_read_buffer_with_error_code(
+	              file,
+	              buffer,
+	              32,
+	              &error_code,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 32 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libcfile_file_read_buffer_with_error_code(
+	              NULL,
+	              buffer,
+	              0,
+	              &error_code,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( WINAPI )
+	file_handle = ( (libcfile_internal_file_t *) file )->handle;
+
+	( (libcfile_internal_file_t *) file )->handle = INVALID_HANDLE_VALUE;
+#else
+	file_descriptor = ( (libcfile_internal_file_t *) file )->descriptor;
+
+	( (libcfile_internal_file_t *) file )->descriptor = -1;
+#endif
+
+	read_count = libcfile_file_read_buffer_with_error_code(
+	              file,
+	              buffer,
+	              0,
+	              &error_code,
+	              &error );
+
+#if defined( WINAPI )
+	( (libcfile_internal_file_t *) file )->handle = file_handle;
+#else
+	( (libcfile_internal_file_t *) file )->descriptor = file_descriptor;
+#endif
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libcfile_file_read_buffer_with_error_code(
+	              file,
+	              NULL,
+	              0,
+	              &error_code,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libcfile_file_read_buffer_with_error_code(
+	              file,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              &error_code,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libcfile_file_read_buffer_with_error_code(
+	              file,
+	              buffer,
+	              0,
+	              NULL,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Initialize test
+	 */
+	result = libcfile_file_initialize(
+	          &closed_file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "closed_file",
+	 closed_file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read buffer with error code on a closed file
+	 */
+	read_count = libcfile_file_read_buffer_with_error_code(
+	              closed_file,
+	              buffer,
+	              0,
+	              &error_code,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcfile_file_free(
+	          &closed_file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "closed_file",
+	 closed_file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( closed_file != NULL )
+	{
+		libcfile_file_free(
+		 &closed_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcfile_file_read_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_read_buffer_at_offset(
+     libcfile_file_t *file )
+{
+	uint8_t buffer[ 32 ];
+	uint8_t reference_buffer[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	size64_t file_size       = 0;
+	ssize_t read_count       = 0;
+	off64_t offset           = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libcfile_file_get_size(
+	          file,
+	          &file_size,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( file_size < 32 )
+	{
+		return( 1 );
+	}
+	offset = libcfile_file_seek_offset(
+	          file,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libcfile_file_read_buffer(
+	              file,
+	              reference_buffer,
+	              32,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 32 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_count = libcfile_file_read_buffer_at_offset(
+	              file,
+	              buffer,
+	              16,
+	              7,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( reference_buffer[ 7 ] ),
+	          16 );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+#if defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT )
+	/* Make sure the block data of the read is kept for reuse
+	 */
+	if( ( ( (libcfile_internal_file_t *) file )->block_size != 0 )
+	 && ( ( (libcfile_internal_file_t *) file )->mapped_data == NULL ) )
+	{
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "read_block_data",
+		 ( (libcfile_internal_file_t *) file )->read_block_data );
+	}
+#endif /* defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT ) */
+
+	/* Make sure the current offset was not changed
+	 */
+	result = libcfile_file_get_offset(
+	          file,
+	          &offset,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 32 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libcfile_file_read_buffer_at_offset(
+	              file,
+	              buffer,
+	              32,
+	              (off64_t) file_size - 1,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libcfile_file_read_buffer_at_offset(
+	              file,
+	              buffer,
+	              32,
+	              (off64_t) file_size,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libcfile_file_read_buffer_at_offset(
+	              NULL,
+	              buffer,
+	              32,
+	              0,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libcfile_file_read_buffer_at_offset(
+	              file,
+	              NULL,
+	              32,
+	              0,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libcfile_file_read_buffer_at_offset(
+	              file,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              0,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libcfile_file_read_buffer_at_offset(
+	              file,
+	              buffer,
+	              32,
+	              -1,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcfile_file_read_buffer_at_offset_with_error_code function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_read_buffer_at_offset_with_error_code(
+     libcfile_file_t *file )
+{
+	uint8_t buffer[ 32 ];
+
+	libcerror_error_t *error     = NULL;
+	libcfile_file_t *closed_file = NULL;
+	size64_t file_size           = 0;
+	ssize_t read_count           = 0;
+	uint32_t error_code          = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = libcfile_file_get_size(
+	          file,
+	          &file_size,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( file_size < 32 )
+	{
+		return( 1 );
+	}
+	/* Test regular cases
+	 */
+	read_count = libcfile_file_read_buffer_at_offset_with_error_code(
+	              file,
+	              buffer,
+	              32,
+	              0,
+	              &error_code,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 32 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libcfile_file_read_buffer_at_offset_with_error_code(
+	              NULL,
+	              buffer,
+	              32,
+	              0,
+	              &error_code,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libcfile_file_read_buffer_at_offset_with_error_code(
+	              file,
+	              NULL,
+	              32,
+	              0,
+	              &error_code,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libcfile_file_read_buffer_at_offset_with_error_code(
+	              file,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              0,
+	              &error_code,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libcfile_file_read_buffer_at_offset_with_error_code(
+	              file,
+	              buffer,
+	              32,
+	              -1,
+	              &error_code,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libcfile_file_read_buffer_at_offset_with_error_code(
+	              file,
+	              buffer,
+	              32,
+	              0,
+	              NULL,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Initialize test
+	 */
+	result = libcfile_file_initialize(
+	          &closed_file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "closed_file",
+	 closed_file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read buffer at offset with error code on a closed file
+	 */
+	read_count = libcfile_file_read_buffer_at_offset_with_error_code(
+	              closed_file,
+	              buffer,
+	              32,
+	              0,
+	              &error_code,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcfile_file_free(
+	          &closed_file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "closed_file",
+	 closed_file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( closed_file != NULL )
+	{
+		libcfile_file_free(
+		 &closed_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcfile_file_get_data_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_get_data_at_offset(
+     const system_character_t *source )
+{
+	uint8_t buffer[ 32 ];
+
+	const uint8_t *data      = NULL;
+	libcerror_error_t *error = NULL;
+	libcfile_file_t *file    = NULL;
+	size64_t file_size       = 0;
+	size_t data_size         = 0;
+	size_t expected_size     = 0;
+	ssize_t read_count       = 0;
+	off64_t offset           = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libcfile_file_initialize(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test file that is not opened with memory map
+	 */
+	result = libcfile_file_get_data_at_offset(
+	          file,
+	          0,
+	          16,
+	          &data,
+	          &data_size,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+	          file,
+	          source,
+	          LIBCFILE_OPEN_READ | LIBCFILE_ACCESS_FLAG_MEMORY_MAP | LIBCFILE_ACCESS_FLAG_MEMORY_MAP_POPULATE,
+	          &error );
+#else
+	result = libcfile_file_open(
+	          file,
+	          source,
+	          LIBCFILE_OPEN_READ | LIBCFILE_ACCESS_FLAG_MEMORY_MAP | LIBCFILE_ACCESS_FLAG_MEMORY_MAP_POPULATE,
+	          &error );
+#endif
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_file_get_size(
+	          file,
+	          &file_size,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcfile_file_get_data_at_offset(
+	          file,
+	          7,
+	          16,
+	          &data,
+	          &data_size,
+	          &error );
+
+	CFILE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( file_size == 0 )
+	{
+		/* An empty file is not memory mapped
+		 */
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	if( result == 1 )
+	{
+		expected_size = 0;
+
+		if( file_size > 7 )
+		{
+			expected_size = (size_t) file_size - 7;
+
+			if( expected_size > 16 )
+			{
+				expected_size = 16;
+			}
+		}
+		CFILE_TEST_ASSERT_EQUAL_SIZE(
+		 "data_size",
+		 data_size,
+		 expected_size );
+
+		if( expected_size > 0 )
+		{
+			CFILE_TEST_ASSERT_IS_NOT_NULL(
+			 "data",
+			 data );
+
+			read_count = libcfile_file_read_buffer_at_offset(
+			              file,
+			              buffer,
+			              16,
+			              7,
+			              &error );
+
+			CFILE_TEST_ASSERT_EQUAL_SSIZE(
+			 "read_count",
+			 read_count,
+			 (ssize_t) expected_size );
+
+			CFILE_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = memory_compare(
+			          buffer,
+			          data,
+			          expected_size );
+
+			CFILE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+		result = libcfile_file_get_data_at_offset(
+		          file,
+		          (off64_t) file_size,
+		          16,
+		          &data,
+		          &data_size,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_EQUAL_SIZE(
+		 "data_size",
+		 data_size,
+		 (size_t) 0 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_set_access_behavior(
+		          file,
+		          LIBCFILE_ACCESS_BEHAVIOR_RANDOM,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Reading from the memory mapped file must advance the current offset
+	 */
+	if( file_size >= 32 )
+	{
+		read_count = libcfile_file_read_buffer(
+		              file,
+		              buffer,
+		              16,
+		              &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 16 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		offset = libcfile_file_seek_offset(
+		          file,
+		          4,
+		          SEEK_CUR,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 offset,
+		 (int64_t) 20 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libcfile_file_get_data_at_offset(
+	          NULL,
+	          0,
+	          16,
+	          &data,
+	          &data_size,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_get_data_at_offset(
+	          file,
+	          -1,
+	          16,
+	          &data,
+	          &data_size,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_get_data_at_offset(
+	          file,
+	          0,
+	          (size_t) SSIZE_MAX + 1,
+	          &data,
+	          &data_size,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_get_data_at_offset(
+	          file,
+	          0,
+	          16,
+	          NULL,
+	          &data_size,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_get_data_at_offset(
+	          file,
+	          0,
+	          16,
+	          &data,
+	          NULL,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = cfile_test_file_close_source(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcfile_file_open function with direct access
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_open_direct(
+     const system_character_t *source )
+{
+	uint8_t buffer[ 8192 + 1 ];
+	uint8_t reference_buffer[ 8192 ];
+
+	libcerror_error_t *error        = NULL;
+	libcfile_file_t *file           = NULL;
+	libcfile_file_t *reference_file = NULL;
+	ssize_t read_count              = 0;
+	ssize_t reference_read_count    = 0;
+	off64_t offset                  = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libcfile_file_initialize(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = cfile_test_file_open_source(
+	          &reference_file,
+	          source,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "reference_file",
+	 reference_file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+	          file,
+	          source,
+	          LIBCFILE_OPEN_READ_WRITE | LIBCFILE_ACCESS_FLAG_DIRECT,
+	          &error );
+#else
+	result = libcfile_file_open(
+	          file,
+	          source,
+	          LIBCFILE_OPEN_READ_WRITE | LIBCFILE_ACCESS_FLAG_DIRECT,
+	          &error );
+#endif
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+	          file,
+	          source,
+	          LIBCFILE_OPEN_READ | LIBCFILE_ACCESS_FLAG_MEMORY_MAP | LIBCFILE_ACCESS_FLAG_DIRECT,
+	          &error );
+#else
+	result = libcfile_file_open(
+	          file,
+	          source,
+	          LIBCFILE_OPEN_READ | LIBCFILE_ACCESS_FLAG_MEMORY_MAP | LIBCFILE_ACCESS_FLAG_DIRECT,
+	          &error );
+#endif
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+	          file,
+	          source,
+	          LIBCFILE_OPEN_READ | LIBCFILE_ACCESS_FLAG_DIRECT,
+	          &error );
+#else
+	result = libcfile_file_open(
+	          file,
+	          source,
+	          LIBCFILE_OPEN_READ | LIBCFILE_ACCESS_FLAG_DIRECT,
+	          &error );
+#endif
+	CFILE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	if( result == -1 )
+	{
+		/* Not all file systems support direct access
+		 */
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	else
+	{
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_set_readahead_size(
+		          file,
+		          65536,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Read block aligned data into a buffer that is not aligned in memory
+		 */
+		read_count = libcfile_file_read_buffer_at_offset(
+		              file,
+		              &( buffer[ 1 ] ),
+		              8192,
+		              0,
+		              &error );
+
+		reference_read_count = libcfile_file_read_buffer_at_offset(
+		                        reference_file,
+		                        reference_buffer,
+		                        8192,
+		                        0,
+		                        NULL );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 reference_read_count );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( read_count > 0 )
+		{
+			result = memory_compare(
+			          &( buffer[ 1 ] ),
+			          reference_buffer,
+			          (size_t) read_count );
+
+			CFILE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+		/* Read data that is not block aligned
+		 */
+		offset = libcfile_file_seek_offset(
+		          file,
+		          7,
+		          SEEK_SET,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 (int64_t) offset,
+		 (int64_t) 7 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_count = libcfile_file_read_buffer(
+		              file,
+		              buffer,
+		              16,
+		              &error );
+
+		reference_read_count = libcfile_file_read_buffer_at_offset(
+		                        reference_file,
+		                        reference_buffer,
+		                        16,
+		                        7,
+		                        NULL );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 reference_read_count );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( read_count > 0 )
+		{
+			result = memory_compare(
+			          buffer,
+			          reference_buffer,
+			          (size_t) read_count );
+
+			CFILE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+#if defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT )
+		/* Direct access reads are not tracked by the readahead
+		 */
+		if( ( (libcfile_internal_file_t *) file )->readahead != NULL )
+		{
+			CFILE_TEST_ASSERT_EQUAL_SIZE(
+			 "readahead->previous_size",
+			 ( (libcfile_internal_file_t *) file )->readahead->previous_size,
+			 (size_t) 0 );
+		}
+#endif /* defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT ) */
+
+		/* Test error case where the block size is removed
+		 */
+		result = libcfile_file_set_block_size(
+		          file,
+		          0,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libcfile_file_close(
+		          file,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = cfile_test_file_close_source(
+	          &reference_file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_file_free(
+	          &file,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( reference_file != NULL )
+	{
+		libcfile_file_free(
+		 &reference_file,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcfile_file_read_vector function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_read_vector(
      libcfile_file_t *file )
 {
-	libcerror_error_t *error     = NULL;
-	libcfile_file_t *closed_file = NULL;
-	size64_t file_size           = 0;
-	off64_t offset               = 0;
-	off64_t seek_offset          = 0;
-	int result                   = 0;
+	uint8_t buffer[ 32 ];
+	uint8_t reference_buffer[ 32 ];
+
+	uint8_t *buffers[ 3 ]    = { NULL, NULL, NULL };
+	size_t buffer_sizes[ 3 ] = { 5, 11, 16 };
+	libcerror_error_t *error = NULL;
+	size64_t file_size       = 0;
+	ssize_t read_count       = 0;
+	off64_t offset           = 0;
+	int result               = 0;
 
 	/* Initialize test
 	 */
@@ -965,194 +9238,310 @@ int cfile_test_file_seek_offset(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: 0 and whence: SEEK_SET
-	 */
-	seek_offset = 0;
+	if( file_size < 32 )
+	{
+		return( 1 );
+	}
+	read_count = libcfile_file_read_buffer_at_offset(
+	              file,
+	              reference_buffer,
+	              32,
+	              0,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 32 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	offset = libcfile_file_seek_offset(
 	          file,
-	          seek_offset,
+	          0,
 	          SEEK_SET,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT64(
 	 "offset",
 	 offset,
-	 (int64_t) seek_offset );
+	 (int64_t) 0 );
 
 	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: <file_size> and whence: SEEK_SET
-	 */
-	seek_offset = (off64_t) file_size;
+	buffers[ 0 ] = &( buffer[ 0 ] );
+	buffers[ 1 ] = &( buffer[ 5 ] );
+	buffers[ 2 ] = &( buffer[ 16 ] );
 
-	offset = libcfile_file_seek_offset(
-	          file,
-	          seek_offset,
-	          SEEK_SET,
-	          &error );
+	/* Test regular cases
+	 */
+	read_count = libcfile_file_read_vector(
+	              file,
+	              buffers,
+	              buffer_sizes,
+	              3,
+	              &error );
 
-	CFILE_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) seek_offset );
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 32 );
 
 	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: <file_size / 5> and whence: SEEK_SET
-	 */
-	seek_offset = (off64_t) ( file_size / 5 );
+	result = memory_compare(
+	          buffer,
+	          reference_buffer,
+	          32 );
 
-	offset = libcfile_file_seek_offset(
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcfile_file_get_offset(
 	          file,
-	          seek_offset,
-	          SEEK_SET,
+	          &offset,
 	          &error );
 
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
 	CFILE_TEST_ASSERT_EQUAL_INT64(
 	 "offset",
 	 offset,
-	 (int64_t) seek_offset );
+	 (int64_t) 32 );
 
 	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: <file_size / 5> and whence: SEEK_CUR
+	read_count = libcfile_file_read_vector(
+	              file,
+	              buffers,
+	              buffer_sizes,
+	              0,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
 	 */
-	offset = libcfile_file_seek_offset(
-	          file,
-	          seek_offset,
-	          SEEK_CUR,
-	          &error );
+	read_count = libcfile_file_read_vector(
+	              NULL,
+	              buffers,
+	              buffer_sizes,
+	              3,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libcfile_file_read_vector(
+	              file,
+	              NULL,
+	              buffer_sizes,
+	              3,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libcfile_file_read_vector(
+	              file,
+	              buffers,
+	              NULL,
+	              3,
+	              &error );
 
-	CFILE_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) seek_offset + seek_offset );
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
 
-	CFILE_TEST_ASSERT_IS_NULL(
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: <-1 * (file_size / 5)> and whence: SEEK_CUR
-	 */
-	offset = libcfile_file_seek_offset(
-	          file,
-	          -1 * seek_offset,
-	          SEEK_CUR,
-	          &error );
+	libcerror_error_free(
+	 &error );
 
-	CFILE_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) seek_offset );
+	read_count = libcfile_file_read_vector(
+	              file,
+	              buffers,
+	              buffer_sizes,
+	              -1,
+	              &error );
 
-	CFILE_TEST_ASSERT_IS_NULL(
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: <file_size + 987> and whence: SEEK_SET
-	 */
-	seek_offset = (off64_t) ( file_size + 987 );
+	libcerror_error_free(
+	 &error );
 
-	offset = libcfile_file_seek_offset(
-	          file,
-	          seek_offset,
-	          SEEK_SET,
-	          &error );
+	return( 1 );
 
-	CFILE_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) seek_offset );
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
 
-	CFILE_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+/* Tests the libcfile_file_read_vector_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_read_vector_at_offset(
+     libcfile_file_t *file )
+{
+	uint8_t buffer[ 32 ];
+	uint8_t reference_buffer[ 32 ];
 
-	/* Test seek offset with offset: 0 and whence: SEEK_CUR
+	uint8_t *buffers[ 3 ]    = { NULL, NULL, NULL };
+	size_t buffer_sizes[ 3 ] = { 5, 11, 13 };
+	libcerror_error_t *error = NULL;
+	size64_t file_size       = 0;
+	ssize_t read_count       = 0;
+	off64_t offset           = 0;
+	int result               = 0;
+
+	/* Initialize test
 	 */
-	offset = libcfile_file_seek_offset(
+	result = libcfile_file_get_size(
 	          file,
-	          0,
-	          SEEK_CUR,
+	          &file_size,
 	          &error );
 
-	CFILE_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) seek_offset );
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: 0 and whence: SEEK_END
-	 */
-	offset = libcfile_file_seek_offset(
-	          file,
-	          0,
-	          SEEK_END,
-	          &error );
+	if( file_size < 32 )
+	{
+		return( 1 );
+	}
+	read_count = libcfile_file_read_buffer_at_offset(
+	              file,
+	              reference_buffer,
+	              32,
+	              0,
+	              &error );
 
-	CFILE_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) file_size );
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 32 );
 
 	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: <-1 * (file_size / 4)> and whence: SEEK_END
-	 */
-	seek_offset = (off64_t) ( file_size / 4 );
-
 	offset = libcfile_file_seek_offset(
 	          file,
-	          -1 * seek_offset,
-	          SEEK_END,
+	          0,
+	          SEEK_SET,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT64(
 	 "offset",
 	 offset,
-	 (int64_t) file_size - seek_offset );
+	 (int64_t) 0 );
 
 	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: 542 and whence: SEEK_END
+	buffers[ 0 ] = &( buffer[ 0 ] );
+	buffers[ 1 ] = &( buffer[ 5 ] );
+	buffers[ 2 ] = &( buffer[ 16 ] );
+
+	/* Test regular cases
 	 */
-	offset = libcfile_file_seek_offset(
-	          file,
-	          542,
-	          SEEK_END,
-	          &error );
+	read_count = libcfile_file_read_vector_at_offset(
+	              file,
+	              buffers,
+	              buffer_sizes,
+	              3,
+	              3,
+	              &error );
 
-	CFILE_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) file_size + 542 );
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 29 );
 
 	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: <-1 * file_size> and whence: SEEK_END
+	result = memory_compare(
+	          buffer,
+	          &( reference_buffer[ 3 ] ),
+	          29 );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Make sure the current offset was not changed
 	 */
-	offset = libcfile_file_seek_offset(
+	result = libcfile_file_get_offset(
 	          file,
-	          -1 * file_size,
-	          SEEK_END,
+	          &offset,
 	          &error );
 
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
 	CFILE_TEST_ASSERT_EQUAL_INT64(
 	 "offset",
 	 offset,
@@ -1162,38 +9551,37 @@ int cfile_test_file_seek_offset(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	offset = libcfile_file_seek_offset(
-	          NULL,
-	          0,
-	          SEEK_SET,
-	          &error );
+	read_count = libcfile_file_read_vector_at_offset(
+	              file,
+	              buffers,
+	              buffer_sizes,
+	              3,
+	              (off64_t) file_size,
+	              &error );
 
-	CFILE_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
 
-	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	/* Test seek offset with offset: -987 and whence: SEEK_SET
+	/* Test error cases
 	 */
-	offset = libcfile_file_seek_offset(
-	          file,
-	          -987,
-	          SEEK_SET,
-	          &error );
+	read_count = libcfile_file_read_vector_at_offset(
+	              NULL,
+	              buffers,
+	              buffer_sizes,
+	              3,
+	              0,
+	              &error );
 
-	CFILE_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
 
 	CFILE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -1202,18 +9590,18 @@ int cfile_test_file_seek_offset(
 	libcerror_error_free(
 	 &error );
 
-	/* Test seek offset with offset: <1 * (file_size + 542)> and whence: SEEK_END
-	 */
-	offset = libcfile_file_seek_offset(
-	          file,
-	          -1 * (file_size + 542),
-	          SEEK_END,
-	          &error );
+	read_count = libcfile_file_read_vector_at_offset(
+	              file,
+	              NULL,
+	              buffer_sizes,
+	              3,
+	              0,
+	              &error );
 
-	CFILE_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
 
 	CFILE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -1222,18 +9610,18 @@ int cfile_test_file_seek_offset(
 	libcerror_error_free(
 	 &error );
 
-	/* Test seek offset with offset: 0 and whence: UNKNOWN (88)
-	 */
-	offset = libcfile_file_seek_offset(
-	          file,
-	          0,
-	          88,
-	          &error );
+	read_count = libcfile_file_read_vector_at_offset(
+	              file,
+	              buffers,
+	              NULL,
+	              3,
+	              0,
+	              &error );
 
-	CFILE_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
 
 	CFILE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -1242,37 +9630,18 @@ int cfile_test_file_seek_offset(
 	libcerror_error_free(
 	 &error );
 
-	/* Initialize test
-	 */
-	result = libcfile_file_initialize(
-	          &closed_file,
-	          &error );
-
-	CFILE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	CFILE_TEST_ASSERT_IS_NOT_NULL(
-	 "closed_file",
-	 closed_file );
-
-	CFILE_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	/* Test seek offset on a closed file
-	 */
-	offset = libcfile_file_seek_offset(
-	          closed_file,
-	          0,
-	          SEEK_SET,
-	          &error );
+	read_count = libcfile_file_read_vector_at_offset(
+	              file,
+	              buffers,
+	              buffer_sizes,
+	              -1,
+	              0,
+	              &error );
 
-	CFILE_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
 
 	CFILE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -1281,25 +9650,26 @@ int cfile_test_file_seek_offset(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up
-	 */
-	result = libcfile_file_free(
-	          &closed_file,
-	          &error );
-
-	CFILE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	read_count = libcfile_file_read_vector_at_offset(
+	              file,
+	              buffers,
+	              buffer_sizes,
+	              3,
+	              -1,
+	              &error );
 
-	CFILE_TEST_ASSERT_IS_NULL(
-	 "closed_file",
-	 closed_file );
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
 
-	CFILE_TEST_ASSERT_IS_NULL(
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -1308,38 +9678,32 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( closed_file != NULL )
-	{
-		libcfile_file_free(
-		 &closed_file,
-		 NULL );
-	}
 	return( 0 );
 }
 
-/* Tests the libcfile_file_resize function
+/* Tests the libcfile_file_read_ranges function
  * Returns 1 if successful or 0 if not
  */
-int cfile_test_file_resize(
-     void )
+int cfile_test_file_read_ranges(
+     libcfile_file_t *file )
 {
-	char narrow_temporary_filename[ 18 ] = {
-		'c', 'f', 'i', 'l', 'e', '_', 't', 'e', 's', 't', '_', 'X', 'X', 'X', 'X', 'X', 'X', 0 };
-
-	uint8_t buffer[ 32 ] = {
-		'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
-		'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', '0', '1', '2', '3', '4', '5' };
+	uint8_t buffer[ 64 ];
+	uint8_t reference_buffer[ 64 ];
 
+	uint8_t *buffers[ 4 ]    = { NULL, NULL, NULL, NULL };
+	off64_t offsets[ 4 ]     = { 40, 3, 12, 8 };
+	size_t sizes[ 4 ]        = { 16, 5, 10, 8 };
 	libcerror_error_t *error = NULL;
-	libcfile_file_t *file    = NULL;
-	ssize_t write_count      = 0;
+	size64_t file_size       = 0;
+	ssize_t read_count       = 0;
+	off64_t offset           = 0;
 	int result               = 0;
-	int with_temporary_file  = 0;
 
 	/* Initialize test
 	 */
-	result = libcfile_file_initialize(
-	          &file,
+	result = libcfile_file_get_size(
+	          file,
+	          &file_size,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
@@ -1347,148 +9711,127 @@ int cfile_test_file_resize(
 	 result,
 	 1 );
 
-	CFILE_TEST_ASSERT_IS_NOT_NULL(
-	 "file",
-	 file );
-
 	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = cfile_test_get_temporary_filename(
-	          narrow_temporary_filename,
-	          18,
-	          &error );
+	if( file_size < 64 )
+	{
+		return( 1 );
+	}
+	read_count = libcfile_file_read_buffer_at_offset(
+	              file,
+	              reference_buffer,
+	              64,
+	              0,
+	              &error );
 
-	CFILE_TEST_ASSERT_NOT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 64 );
 
 	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	with_temporary_file = result;
-
-	if( with_temporary_file != 0 )
-	{
-		result = libcfile_file_open(
-		          file,
-		          narrow_temporary_filename,
-		          LIBCFILE_OPEN_WRITE,
-		          &error );
-
-		CFILE_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
-
-		CFILE_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-
-		write_count = libcfile_file_write_buffer(
-		               file,
-		               buffer,
-		               32,
-		               &error );
-
-		CFILE_TEST_ASSERT_EQUAL_SSIZE(
-		 "write_count",
-		 write_count,
-		 (ssize_t) 32 );
+	offset = libcfile_file_seek_offset(
+	          file,
+	          0,
+	          SEEK_SET,
+	          &error );
 
-		CFILE_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	CFILE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
 
-		/* Test regular cases
-		 */
-		result = libcfile_file_resize(
-		          file,
-		          16,
-		          &error );
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		CFILE_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	/* The ranges are unsorted, the range at offset 12 overlaps
+	 * the range at offset 8 and the range at offset 40 is separated by a gap
+	 */
+	buffers[ 0 ] = &( buffer[ 0 ] );
+	buffers[ 1 ] = &( buffer[ 16 ] );
+	buffers[ 2 ] = &( buffer[ 21 ] );
+	buffers[ 3 ] = &( buffer[ 31 ] );
 
-		CFILE_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
-	/* Test error cases
+	/* Test regular cases
 	 */
-	result = libcfile_file_resize(
-	          NULL,
-	          16,
+	result = libcfile_file_read_ranges(
+	          file,
+	          buffers,
+	          offsets,
+	          sizes,
+	          4,
+	          0,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libcfile_file_resize(
-	          file,
-	          (size64_t) INT64_MAX + 1,
-	          &error );
+	result = memory_compare(
+	          &( buffer[ 0 ] ),
+	          &( reference_buffer[ 40 ] ),
+	          16 );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
-
-	CFILE_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+	 0 );
 
-	libcerror_error_free(
-	 &error );
+	result = memory_compare(
+	          &( buffer[ 16 ] ),
+	          &( reference_buffer[ 3 ] ),
+	          5 );
 
-	/* Clean up
-	 */
-	if( with_temporary_file != 0 )
-	{
-		result = libcfile_file_close(
-		          file,
-		          &error );
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-		CFILE_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 0 );
+	result = memory_compare(
+	          &( buffer[ 21 ] ),
+	          &( reference_buffer[ 12 ] ),
+	          10 );
 
-		CFILE_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-		result = libcfile_file_remove(
-		          narrow_temporary_filename,
-		          &error );
+	result = memory_compare(
+	          &( buffer[ 31 ] ),
+	          &( reference_buffer[ 8 ] ),
+	          8 );
 
-		CFILE_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-		CFILE_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	/* Test with all ranges combined into a single read
+	 */
+	memory_set(
+	 buffer,
+	 0,
+	 64 );
 
-		with_temporary_file = 0;
-	}
-	result = libcfile_file_free(
-	          &file,
+	result = libcfile_file_read_ranges(
+	          file,
+	          buffers,
+	          offsets,
+	          sizes,
+	          4,
+	          32,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
@@ -1496,55 +9839,55 @@ int cfile_test_file_resize(
 	 result,
 	 1 );
 
-	CFILE_TEST_ASSERT_IS_NULL(
-	 "file",
-	 file );
-
 	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	return( 1 );
+	result = memory_compare(
+	          &( buffer[ 0 ] ),
+	          &( reference_buffer[ 40 ] ),
+	          16 );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( with_temporary_file != 0 )
-	{
-		libcfile_file_remove(
-		 narrow_temporary_filename,
-		 NULL );
-	}
-	if( file != NULL )
-	{
-		libcfile_file_free(
-		 &file,
-		 NULL );
-	}
-	return( 0 );
-}
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-/* Tests the libcfile_file_open functions
- * Returns 1 if successful or 0 if not
- */
-int cfile_test_file_open(
-     const system_character_t *source )
-{
-	char narrow_source[ 256 ];
+	result = memory_compare(
+	          &( buffer[ 16 ] ),
+	          &( reference_buffer[ 3 ] ),
+	          5 );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( buffer[ 21 ] ),
+	          &( reference_buffer[ 12 ] ),
+	          10 );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-	libcerror_error_t *error = NULL;
-	libcfile_file_t *file    = NULL;
-	int result               = 0;
+	result = memory_compare(
+	          &( buffer[ 31 ] ),
+	          &( reference_buffer[ 8 ] ),
+	          8 );
 
-	/* Initialize test
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Make sure the current offset was not changed
 	 */
-	result = cfile_test_get_narrow_source(
-	          source,
-	          narrow_source,
-	          256,
+	result = libcfile_file_get_offset(
+	          file,
+	          &offset,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
@@ -1552,12 +9895,22 @@ int cfile_test_file_open(
 	 result,
 	 1 );
 
+	CFILE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
 	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcfile_file_initialize(
-	          &file,
+	result = libcfile_file_read_ranges(
+	          file,
+	          buffers,
+	          offsets,
+	          sizes,
+	          0,
+	          0,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
@@ -1565,37 +9918,61 @@ int cfile_test_file_open(
 	 result,
 	 1 );
 
-	CFILE_TEST_ASSERT_IS_NOT_NULL(
-	 "file",
-	 file );
-
 	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
+	/* Test error cases
 	 */
-	result = libcfile_file_open(
+	result = libcfile_file_read_ranges(
+	          NULL,
+	          buffers,
+	          offsets,
+	          sizes,
+	          4,
+	          0,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_read_ranges(
 	          file,
-	          narrow_source,
-	          LIBCFILE_OPEN_READ,
+	          NULL,
+	          offsets,
+	          sizes,
+	          4,
+	          0,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	CFILE_TEST_ASSERT_IS_NULL(
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libcfile_file_open(
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_read_ranges(
 	          file,
-	          narrow_source,
-	          LIBCFILE_OPEN_READ,
+	          buffers,
+	          NULL,
+	          sizes,
+	          4,
+	          0,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
@@ -1610,38 +9987,73 @@ int cfile_test_file_open(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up
-	 */
-	result = libcfile_file_close(
+	result = libcfile_file_read_ranges(
 	          file,
+	          buffers,
+	          offsets,
+	          NULL,
+	          4,
+	          0,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	CFILE_TEST_ASSERT_IS_NULL(
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libcfile_file_free(
-	          &file,
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_read_ranges(
+	          file,
+	          buffers,
+	          offsets,
+	          sizes,
+	          -1,
+	          0,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	CFILE_TEST_ASSERT_IS_NULL(
-	 "file",
-	 file );
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	CFILE_TEST_ASSERT_IS_NULL(
+	libcerror_error_free(
+	 &error );
+
+	offsets[ 0 ] = (off64_t) file_size - 8;
+
+	result = libcfile_file_read_ranges(
+	          file,
+	          buffers,
+	          offsets,
+	          sizes,
+	          4,
+	          0,
+	          &error );
+
+	offsets[ 0 ] = 40;
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -1650,34 +10062,33 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( file != NULL )
-	{
-		libcfile_file_free(
-		 &file,
-		 NULL );
-	}
 	return( 0 );
 }
 
-/* Tests the libcfile_file_open_with_error_code functions
+/* Tests the libcfile_file_submit_read and libcfile_file_poll_completions functions
  * Returns 1 if successful or 0 if not
  */
-int cfile_test_file_open_with_error_code(
-     const system_character_t *source )
+int cfile_test_file_submit_read(
+     libcfile_file_t *file )
 {
-	char narrow_source[ 256 ];
-
-	libcerror_error_t *error = NULL;
-	libcfile_file_t *file    = NULL;
-	uint32_t error_code      = 0;
-	int result               = 0;
+	uint8_t buffer[ 64 ];
+	uint8_t reference_buffer[ 64 ];
+	uint64_t request_identifiers[ 4 ];
+	ssize_t results[ 4 ];
+
+	libcerror_error_t *error  = NULL;
+	size64_t file_size        = 0;
+	ssize_t read_count        = 0;
+	int completion_index      = 0;
+	int number_of_completions = 0;
+	int request_index         = 0;
+	int result                = 0;
 
 	/* Initialize test
 	 */
-	result = cfile_test_get_narrow_source(
-	          source,
-	          narrow_source,
-	          256,
+	result = libcfile_file_get_size(
+	          file,
+	          &file_size,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
@@ -1689,18 +10100,21 @@ int cfile_test_file_open_with_error_code(
 	 "error",
 	 error );
 
-	result = libcfile_file_initialize(
-	          &file,
-	          &error );
-
-	CFILE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	if( file_size < 64 )
+	{
+		return( 1 );
+	}
+	read_count = libcfile_file_read_buffer_at_offset(
+	              file,
+	              reference_buffer,
+	              64,
+	              0,
+	              &error );
 
-	CFILE_TEST_ASSERT_IS_NOT_NULL(
-	 "file",
-	 file );
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 64 );
 
 	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -1708,17 +10122,86 @@ int cfile_test_file_open_with_error_code(
 
 	/* Test regular cases
 	 */
-	result = libcfile_file_open_with_error_code(
-	          file,
-	          narrow_source,
-	          LIBCFILE_OPEN_READ,
-	          &error_code,
-	          &error );
+	for( request_index = 0;
+	     request_index < 4;
+	     request_index++ )
+	{
+		result = libcfile_file_submit_read(
+		          file,
+		          &( buffer[ request_index * 16 ] ),
+		          16,
+		          (off64_t) ( request_index * 16 ),
+		          (uint64_t) request_index,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	while( completion_index < 4 )
+	{
+		number_of_completions = libcfile_file_poll_completions(
+		                         file,
+		                         request_identifiers,
+		                         results,
+		                         4,
+		                         1,
+		                         &error );
+
+		CFILE_TEST_ASSERT_GREATER_THAN_INT(
+		 "number_of_completions",
+		 number_of_completions,
+		 0 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( request_index = 0;
+		     request_index < number_of_completions;
+		     request_index++ )
+		{
+			CFILE_TEST_ASSERT_LESS_THAN_UINT64(
+			 "request_identifiers[ request_index ]",
+			 request_identifiers[ request_index ],
+			 (uint64_t) 4 );
+
+			CFILE_TEST_ASSERT_EQUAL_SSIZE(
+			 "results[ request_index ]",
+			 results[ request_index ],
+			 (ssize_t) 16 );
+		}
+		completion_index += number_of_completions;
+	}
+	result = memory_compare(
+	          buffer,
+	          reference_buffer,
+	          64 );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
+
+	/* Test polling without outstanding requests
+	 */
+	number_of_completions = libcfile_file_poll_completions(
+	                         file,
+	                         request_identifiers,
+	                         results,
+	                         4,
+	                         1,
+	                         &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_completions",
+	 number_of_completions,
+	 0 );
 
 	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -1726,11 +10209,12 @@ int cfile_test_file_open_with_error_code(
 
 	/* Test error cases
 	 */
-	result = libcfile_file_open_with_error_code(
-	          file,
-	          narrow_source,
-	          LIBCFILE_OPEN_READ,
-	          &error_code,
+	result = libcfile_file_submit_read(
+	          NULL,
+	          buffer,
+	          16,
+	          0,
+	          0,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
@@ -1745,28 +10229,32 @@ int cfile_test_file_open_with_error_code(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up
-	 */
-	result = libcfile_file_close(
+	result = libcfile_file_submit_read(
 	          file,
+	          NULL,
+	          16,
+	          0,
+	          0,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	CFILE_TEST_ASSERT_IS_NULL(
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libcfile_file_open_with_error_code(
-	          NULL,
-	          narrow_source,
-	          LIBCFILE_OPEN_READ,
-	          &error_code,
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_submit_read(
+	          file,
+	          buffer,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          0,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
@@ -1781,11 +10269,12 @@ int cfile_test_file_open_with_error_code(
 	libcerror_error_free(
 	 &error );
 
-	result = libcfile_file_open_with_error_code(
+	result = libcfile_file_submit_read(
 	          file,
-	          NULL,
-	          LIBCFILE_OPEN_READ,
-	          &error_code,
+	          buffer,
+	          16,
+	          -1,
+	          0,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
@@ -1800,11 +10289,51 @@ int cfile_test_file_open_with_error_code(
 	libcerror_error_free(
 	 &error );
 
-	result = libcfile_file_open_with_error_code(
+	number_of_completions = libcfile_file_poll_completions(
+	                         NULL,
+	                         request_identifiers,
+	                         results,
+	                         4,
+	                         0,
+	                         &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_completions",
+	 number_of_completions,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	number_of_completions = libcfile_file_poll_completions(
+	                         file,
+	                         NULL,
+	                         results,
+	                         4,
+	                         0,
+	                         &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_completions",
+	 number_of_completions,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the queue depth is set after the first request
+	 */
+	result = libcfile_file_set_queue_depth(
 	          file,
-	          narrow_source,
-	          0,
-	          &error_code,
+	          8,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
@@ -1819,42 +10348,77 @@ int cfile_test_file_open_with_error_code(
 	libcerror_error_free(
 	 &error );
 
-	result = libcfile_file_open_with_error_code(
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcfile_file_copy_range function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_copy_range(
+     libcfile_file_t *file )
+{
+	char narrow_temporary_filename[ 18 ] = {
+		'c', 'f', 'i', 'l', 'e', '_', 't', 'e', 's', 't', '_', 'X', 'X', 'X', 'X', 'X', 'X', 0 };
+
+	uint8_t copied_buffer[ 64 ];
+	uint8_t source_buffer[ 64 ];
+
+	libcerror_error_t *error          = NULL;
+	libcfile_file_t *destination_file = NULL;
+	size64_t destination_size         = 0;
+	size64_t file_size                = 0;
+	size_t compare_size               = 0;
+	ssize_t copy_count                = 0;
+	ssize_t read_count                = 0;
+	off64_t current_offset            = 0;
+	off64_t offset                    = 0;
+	int result                        = 0;
+	int with_temporary_file           = 0;
+
+#if defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT )
+	uint32_t error_code               = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = libcfile_file_get_size(
 	          file,
-	          narrow_source,
-	          LIBCFILE_OPEN_READ,
-	          NULL,
+	          &file_size,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	/* Clean up
-	 */
-	result = libcfile_file_close(
+	result = libcfile_file_get_offset(
 	          file,
+	          &offset,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
 	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcfile_file_free(
-	          &file,
+	result = libcfile_file_initialize(
+	          &destination_file,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
@@ -1862,108 +10426,340 @@ int cfile_test_file_open_with_error_code(
 	 result,
 	 1 );
 
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_file",
+	 destination_file );
+
 	CFILE_TEST_ASSERT_IS_NULL(
-	 "file",
-	 file );
+	 "error",
+	 error );
+
+	result = cfile_test_get_temporary_filename(
+	          narrow_temporary_filename,
+	          18,
+	          &error );
+
+	CFILE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	return( 1 );
+	with_temporary_file = result;
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( file != NULL )
+	if( with_temporary_file != 0 )
 	{
-		libcfile_file_free(
-		 &file,
-		 NULL );
-	}
-	return( 0 );
-}
+		result = libcfile_file_open(
+		          destination_file,
+		          narrow_temporary_filename,
+		          LIBCFILE_OPEN_READ_WRITE,
+		          &error );
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-/* Tests the libcfile_file_open_wide functions
- * Returns 1 if successful or 0 if not
- */
-int cfile_test_file_open_wide(
-     const system_character_t *source )
-{
-	wchar_t wide_source[ 256 ];
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	libcerror_error_t *error = NULL;
-	libcfile_file_t *file    = NULL;
-	int result               = 0;
+		/* Test regular cases
+		 */
+		copy_count = libcfile_file_copy_range(
+		              file,
+		              0,
+		              destination_file,
+		              0,
+		              (size_t) file_size,
+		              &error );
 
-	/* Initialize test
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "copy_count",
+		 copy_count,
+		 (ssize_t) file_size );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_get_size(
+		          destination_file,
+		          &destination_size,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CFILE_TEST_ASSERT_EQUAL_UINT64(
+		 "destination_size",
+		 (uint64_t) destination_size,
+		 (uint64_t) file_size );
+
+		compare_size = 64;
+
+		if( file_size < (size64_t) compare_size )
+		{
+			compare_size = (size_t) file_size;
+		}
+		read_count = libcfile_file_read_buffer_at_offset(
+		              file,
+		              source_buffer,
+		              compare_size,
+		              0,
+		              &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) compare_size );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_count = libcfile_file_read_buffer_at_offset(
+		              destination_file,
+		              copied_buffer,
+		              compare_size,
+		              0,
+		              &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) compare_size );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          source_buffer,
+		          copied_buffer,
+		          compare_size );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* Test copying beyond the end of the source file
+		 */
+		copy_count = libcfile_file_copy_range(
+		              file,
+		              (off64_t) file_size,
+		              destination_file,
+		              0,
+		              16,
+		              &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "copy_count",
+		 copy_count,
+		 (ssize_t) 0 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test copying with a buffer to an offset beyond the end of the destination file
+		 */
+#if defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT )
+		copy_count = libcfile_internal_file_copy_range_with_buffer(
+		              (libcfile_internal_file_t *) file,
+		              0,
+		              (libcfile_internal_file_t *) destination_file,
+		              (off64_t) file_size + 3,
+		              compare_size,
+		              &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "copy_count",
+		 copy_count,
+		 (ssize_t) compare_size );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The internal function does not update the size of the destination file
+		 * hence the data is read back with the internal read function
+		 */
+		read_count = libcfile_internal_file_read_buffer_at_offset_with_error_code(
+		              (libcfile_internal_file_t *) destination_file,
+		              (off64_t) file_size + 3,
+		              copied_buffer,
+		              compare_size,
+		              &error_code,
+		              &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) compare_size );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          source_buffer,
+		          copied_buffer,
+		          compare_size );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+#endif /* defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT ) */
+
+		/* Make sure the current offset of the source file was not changed
+		 */
+		result = libcfile_file_get_offset(
+		          file,
+		          &current_offset,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT64(
+		 "current_offset",
+		 (int64_t) current_offset,
+		 (int64_t) offset );
+	}
+	/* Test error cases
 	 */
-	result = cfile_test_get_wide_source(
-	          source,
-	          wide_source,
-	          256,
-	          &error );
+	copy_count = libcfile_file_copy_range(
+	              NULL,
+	              0,
+	              file,
+	              0,
+	              16,
+	              &error );
 
-	CFILE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) -1 );
 
-	CFILE_TEST_ASSERT_IS_NULL(
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libcfile_file_initialize(
-	          &file,
-	          &error );
+	libcerror_error_free(
+	 &error );
+
+	copy_count = libcfile_file_copy_range(
+	              file,
+	              0,
+	              NULL,
+	              0,
+	              16,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	copy_count = libcfile_file_copy_range(
+	              file,
+	              -1,
+	              destination_file,
+	              0,
+	              16,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	copy_count = libcfile_file_copy_range(
+	              file,
+	              0,
+	              destination_file,
+	              -1,
+	              16,
+	              &error );
 
-	CFILE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) -1 );
 
 	CFILE_TEST_ASSERT_IS_NOT_NULL(
-	 "file",
-	 file );
-
-	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	result = libcfile_file_open_wide(
-	          file,
-	          wide_source,
-	          LIBCFILE_OPEN_READ,
-	          &error );
+	libcerror_error_free(
+	 &error );
 
-	CFILE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	copy_count = libcfile_file_copy_range(
+	              file,
+	              0,
+	              destination_file,
+	              0,
+	              (size_t) SSIZE_MAX + 1,
+	              &error );
 
-	CFILE_TEST_ASSERT_IS_NULL(
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the source and destination range overlap
 	 */
-	result = libcfile_file_open_wide(
-	          file,
-	          wide_source,
-	          LIBCFILE_OPEN_READ,
-	          &error );
+	copy_count = libcfile_file_copy_range(
+	              file,
+	              0,
+	              file,
+	              8,
+	              16,
+	              &error );
 
-	CFILE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) -1 );
 
 	CFILE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -1974,21 +10770,38 @@ int cfile_test_file_open_wide(
 
 	/* Clean up
 	 */
-	result = libcfile_file_close(
-	          file,
-	          &error );
+	if( with_temporary_file != 0 )
+	{
+		result = libcfile_file_close(
+		          destination_file,
+		          &error );
 
-	CFILE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
 
-	CFILE_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcfile_file_remove(
+		          narrow_temporary_filename,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
+		with_temporary_file = 0;
+	}
 	result = libcfile_file_free(
-	          &file,
+	          &destination_file,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
@@ -1997,8 +10810,8 @@ int cfile_test_file_open_wide(
 	 1 );
 
 	CFILE_TEST_ASSERT_IS_NULL(
-	 "file",
-	 file );
+	 "destination_file",
+	 destination_file );
 
 	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -2012,34 +10825,45 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( file != NULL )
+	if( with_temporary_file != 0 )
+	{
+		libcfile_file_remove(
+		 narrow_temporary_filename,
+		 NULL );
+	}
+	if( destination_file != NULL )
 	{
 		libcfile_file_free(
-		 &file,
+		 &destination_file,
 		 NULL );
 	}
 	return( 0 );
 }
 
-/* Tests the libcfile_file_open_wide_with_error_code functions
+#if defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+/* Tests the libcfile_file_splice_to_descriptor function
  * Returns 1 if successful or 0 if not
  */
-int cfile_test_file_open_wide_with_error_code(
-     const system_character_t *source )
+int cfile_test_file_splice_to_descriptor(
+     libcfile_file_t *file )
 {
-	wchar_t wide_source[ 256 ];
+	uint8_t file_buffer[ 1024 ];
+	uint8_t transferred_buffer[ 1024 ];
 
-	libcerror_error_t *error = NULL;
-	libcfile_file_t *file    = NULL;
-	uint32_t error_code      = 0;
-	int result               = 0;
+	libcerror_error_t *error  = NULL;
+	size64_t file_size        = 0;
+	size_t transfer_size      = 0;
+	ssize_t read_count        = 0;
+	ssize_t transfer_count    = 0;
+	int pipe_descriptors[ 2 ] = { -1, -1 };
+	int result                = 0;
 
 	/* Initialize test
 	 */
-	result = cfile_test_get_wide_source(
-	          source,
-	          wide_source,
-	          256,
+	result = libcfile_file_get_size(
+	          file,
+	          &file_size,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
@@ -2051,90 +10875,256 @@ int cfile_test_file_open_wide_with_error_code(
 	 "error",
 	 error );
 
-	result = libcfile_file_initialize(
-	          &file,
-	          &error );
+	if( pipe(
+	     pipe_descriptors ) != 0 )
+	{
+		goto on_error;
+	}
+	/* Test regular cases
+	 */
+	if( file_size > 1 )
+	{
+		transfer_size = 64;
 
-	CFILE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+		if( ( file_size - 1 ) < (size64_t) transfer_size )
+		{
+			transfer_size = (size_t) file_size - 1;
+		}
+		transfer_count = libcfile_file_splice_to_descriptor(
+		                  file,
+		                  1,
+		                  transfer_size,
+		                  pipe_descriptors[ 1 ],
+		                  &error );
 
-	CFILE_TEST_ASSERT_IS_NOT_NULL(
-	 "file",
-	 file );
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "transfer_count",
+		 transfer_count,
+		 (ssize_t) transfer_size );
 
-	CFILE_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	/* Test regular cases
+		read_count = read(
+		              pipe_descriptors[ 0 ],
+		              transferred_buffer,
+		              transfer_size );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) transfer_size );
+
+		read_count = libcfile_file_read_buffer_at_offset(
+		              file,
+		              file_buffer,
+		              transfer_size,
+		              1,
+		              &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) transfer_size );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          file_buffer,
+		          transferred_buffer,
+		          transfer_size );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+	}
+	/* Test transferring a range that is not block aligned
 	 */
-	result = libcfile_file_open_wide_with_error_code(
-	          file,
-	          wide_source,
-	          LIBCFILE_OPEN_READ,
-	          &error_code,
-	          &error );
+	if( ( ( file_size % 512 ) == 0 )
+	 && ( file_size >= 1024 ) )
+	{
+		result = libcfile_file_set_block_size(
+		          file,
+		          512,
+		          &error );
 
-	CFILE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	CFILE_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	/* Test error cases
+		transfer_count = libcfile_file_splice_to_descriptor(
+		                  file,
+		                  500,
+		                  600,
+		                  pipe_descriptors[ 1 ],
+		                  &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "transfer_count",
+		 transfer_count,
+		 (ssize_t) 600 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_count = read(
+		              pipe_descriptors[ 0 ],
+		              transferred_buffer,
+		              600 );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 600 );
+
+		read_count = libcfile_file_read_buffer_at_offset(
+		              file,
+		              file_buffer,
+		              600,
+		              500,
+		              &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 600 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          file_buffer,
+		          transferred_buffer,
+		          600 );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = libcfile_file_set_block_size(
+		          file,
+		          0,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test transferring beyond the end of the file
 	 */
-	result = libcfile_file_open_wide_with_error_code(
-	          file,
-	          wide_source,
-	          LIBCFILE_OPEN_READ,
-	          &error_code,
-	          &error );
+	transfer_count = libcfile_file_splice_to_descriptor(
+	                  file,
+	                  (off64_t) file_size,
+	                  16,
+	                  pipe_descriptors[ 1 ],
+	                  &error );
 
-	CFILE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "transfer_count",
+	 transfer_count,
+	 (ssize_t) 0 );
 
-	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+#if defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT )
 
-	/* Clean up
+	/* Test transferring with a buffer
 	 */
-	result = libcfile_file_close(
-	          file,
-	          &error );
+	if( file_size > 0 )
+	{
+		transfer_size = 64;
+
+		if( file_size < (size64_t) transfer_size )
+		{
+			transfer_size = (size_t) file_size;
+		}
+		transfer_count = libcfile_internal_file_write_range_to_descriptor(
+		                  (libcfile_internal_file_t *) file,
+		                  0,
+		                  transfer_size,
+		                  pipe_descriptors[ 1 ],
+		                  &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "transfer_count",
+		 transfer_count,
+		 (ssize_t) transfer_size );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_count = read(
+		              pipe_descriptors[ 0 ],
+		              transferred_buffer,
+		              transfer_size );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) transfer_size );
+
+		read_count = libcfile_file_read_buffer_at_offset(
+		              file,
+		              file_buffer,
+		              transfer_size,
+		              0,
+		              &error );
 
-	CFILE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) transfer_size );
 
-	CFILE_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          file_buffer,
+		          transferred_buffer,
+		          transfer_size );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+#endif /* defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT ) */
 
 	/* Test error cases
 	 */
-	result = libcfile_file_open_wide_with_error_code(
-	          NULL,
-	          wide_source,
-	          LIBCFILE_OPEN_READ,
-	          &error_code,
-	          &error );
+	transfer_count = libcfile_file_splice_to_descriptor(
+	                  NULL,
+	                  0,
+	                  16,
+	                  pipe_descriptors[ 1 ],
+	                  &error );
 
-	CFILE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "transfer_count",
+	 transfer_count,
+	 (ssize_t) -1 );
 
 	CFILE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2143,17 +11133,17 @@ int cfile_test_file_open_wide_with_error_code(
 	libcerror_error_free(
 	 &error );
 
-	result = libcfile_file_open_wide_with_error_code(
-	          file,
-	          NULL,
-	          LIBCFILE_OPEN_READ,
-	          &error_code,
-	          &error );
+	transfer_count = libcfile_file_splice_to_descriptor(
+	                  file,
+	                  -1,
+	                  16,
+	                  pipe_descriptors[ 1 ],
+	                  &error );
 
-	CFILE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "transfer_count",
+	 transfer_count,
+	 (ssize_t) -1 );
 
 	CFILE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2162,17 +11152,17 @@ int cfile_test_file_open_wide_with_error_code(
 	libcerror_error_free(
 	 &error );
 
-	result = libcfile_file_open_wide_with_error_code(
-	          file,
-	          wide_source,
-	          0,
-	          &error_code,
-	          &error );
+	transfer_count = libcfile_file_splice_to_descriptor(
+	                  file,
+	                  0,
+	                  (size_t) SSIZE_MAX + 1,
+	                  pipe_descriptors[ 1 ],
+	                  &error );
 
-	CFILE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "transfer_count",
+	 transfer_count,
+	 (ssize_t) -1 );
 
 	CFILE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2181,17 +11171,17 @@ int cfile_test_file_open_wide_with_error_code(
 	libcerror_error_free(
 	 &error );
 
-	result = libcfile_file_open_wide_with_error_code(
-	          file,
-	          wide_source,
-	          LIBCFILE_OPEN_READ,
-	          NULL,
-	          &error );
+	transfer_count = libcfile_file_splice_to_descriptor(
+	                  file,
+	                  0,
+	                  16,
+	                  -1,
+	                  &error );
 
-	CFILE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "transfer_count",
+	 transfer_count,
+	 (ssize_t) -1 );
 
 	CFILE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2202,36 +11192,77 @@ int cfile_test_file_open_wide_with_error_code(
 
 	/* Clean up
 	 */
-	result = libcfile_file_close(
+	close(
+	 pipe_descriptors[ 1 ] );
+
+	close(
+	 pipe_descriptors[ 0 ] );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( pipe_descriptors[ 1 ] != -1 )
+	{
+		close(
+		 pipe_descriptors[ 1 ] );
+	}
+	if( pipe_descriptors[ 0 ] != -1 )
+	{
+		close(
+		 pipe_descriptors[ 0 ] );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+/* Tests the libcfile_file_is_open function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_is_open(
+     libcfile_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcfile_file_is_open(
 	          file,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
 	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcfile_file_free(
-	          &file,
+	/* Test error cases
+	 */
+	result = libcfile_file_is_open(
+	          NULL,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CFILE_TEST_ASSERT_IS_NULL(
-	 "file",
-	 file );
+	 -1 );
 
-	CFILE_TEST_ASSERT_IS_NULL(
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -2240,29 +11271,56 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( file != NULL )
-	{
-		libcfile_file_free(
-		 &file,
-		 NULL );
-	}
 	return( 0 );
 }
 
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
-
-/* Tests the libcfile_file_close function
+/* Tests the libcfile_file_get_offset function
  * Returns 1 if successful or 0 if not
  */
-int cfile_test_file_close(
-     void )
+int cfile_test_file_get_offset(
+     libcfile_file_t *file )
 {
 	libcerror_error_t *error = NULL;
+	off64_t offset           = 0;
 	int result               = 0;
 
+	/* Test regular cases
+	 */
+	result = libcfile_file_get_offset(
+	          file,
+	          &offset,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test error cases
 	 */
-	result = libcfile_file_close(
+	result = libcfile_file_get_offset(
+	          NULL,
+	          &offset,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_get_offset(
+	          file,
 	          NULL,
 	          &error );
 
@@ -2289,20 +11347,23 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libcfile_file_open and libcfile_file_close functions
+#if defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT )
+
+/* Tests the libcfile_internal_file_get_size function
  * Returns 1 if successful or 0 if not
  */
-int cfile_test_file_open_close(
-     const system_character_t *source )
+int cfile_test_internal_file_get_size(
+     libcfile_file_t *file )
 {
 	libcerror_error_t *error = NULL;
-	libcfile_file_t *file    = NULL;
+	size64_t size            = 0;
 	int result               = 0;
 
-	/* Initialize test
+	/* Test regular cases
 	 */
-	result = libcfile_file_initialize(
-	          &file,
+	result = libcfile_internal_file_get_size(
+	          (libcfile_internal_file_t *) file,
+	          &size,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
@@ -2310,67 +11371,75 @@ int cfile_test_file_open_close(
 	 result,
 	 1 );
 
-	CFILE_TEST_ASSERT_IS_NOT_NULL(
-	 "file",
-	 file );
-
 	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test open and close
+	/* Test error cases
 	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libcfile_file_open_wide(
-	          file,
-	          source,
-	          LIBCFILE_OPEN_READ,
-	          &error );
-#else
-	result = libcfile_file_open(
-	          file,
-	          source,
-	          LIBCFILE_OPEN_READ,
+	result = libcfile_internal_file_get_size(
+	          NULL,
+	          &size,
 	          &error );
-#endif
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	CFILE_TEST_ASSERT_IS_NULL(
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libcfile_file_close(
-	          file,
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_internal_file_get_size(
+	          (libcfile_internal_file_t *) file,
+	          NULL,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	CFILE_TEST_ASSERT_IS_NULL(
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test open and close a second time to validate clean up on close
-	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libcfile_file_open_wide(
-	          file,
-	          source,
-	          LIBCFILE_OPEN_READ,
-	          &error );
-#else
-	result = libcfile_file_open(
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT ) */
+
+/* Tests the libcfile_file_get_size function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_get_size(
+     libcfile_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	size64_t size            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcfile_file_get_size(
 	          file,
-	          source,
-	          LIBCFILE_OPEN_READ,
+	          &size,
 	          &error );
-#endif
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -2381,38 +11450,42 @@ int cfile_test_file_open_close(
 	 "error",
 	 error );
 
-	result = libcfile_file_close(
-	          file,
+	/* Test error cases
+	 */
+	result = libcfile_file_get_size(
+	          NULL,
+	          &size,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	CFILE_TEST_ASSERT_IS_NULL(
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Clean up
-	 */
-	result = libcfile_file_free(
-	          &file,
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_get_size(
+	          file,
+	          NULL,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CFILE_TEST_ASSERT_IS_NULL(
-	 "file",
-	 file );
+	 -1 );
 
-	CFILE_TEST_ASSERT_IS_NULL(
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -2421,76 +11494,28 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( file != NULL )
-	{
-		libcfile_file_free(
-		 &file,
-		 NULL );
-	}
 	return( 0 );
 }
 
-/* Tests the libcfile_file_read_buffer function
+/* Tests the libcfile_file_is_device function
  * Returns 1 if successful or 0 if not
  */
-int cfile_test_file_read_buffer(
+int cfile_test_file_is_device(
      libcfile_file_t *file )
 {
-	uint8_t buffer[ 32 ];
-
 	libcerror_error_t *error = NULL;
-	size64_t file_size       = 0;
-	ssize_t read_count       = 0;
-	off64_t offset           = 0;
 	int result               = 0;
 
-	/* Initialize test
+	/* Test regular cases
 	 */
-	result = libcfile_file_get_size(
+	result = libcfile_file_is_device(
 	          file,
-	          &file_size,
 	          &error );
 
-	CFILE_TEST_ASSERT_EQUAL_INT(
+	CFILE_TEST_ASSERT_NOT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CFILE_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	if( file_size < 32 )
-	{
-		return( 1 );
-	}
-	offset = libcfile_file_seek_offset(
-	          file,
-	          0,
-	          SEEK_SET,
-	          &error );
-
-	CFILE_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) 0 );
-
-	CFILE_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	/* Test regular cases
-	 */
-	read_count = libcfile_file_read_buffer(
-	              file,
-	              buffer,
-	              32,
-	              &error );
-
-	CFILE_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) 32 );
+	 -1 );
 
 	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -2498,16 +11523,14 @@ int cfile_test_file_read_buffer(
 
 	/* Test error cases
 	 */
-	read_count = libcfile_file_read_buffer(
-	              NULL,
-	              buffer,
-	              32,
-	              &error );
+	result = libcfile_file_is_device(
+	          NULL,
+	          &error );
 
-	CFILE_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) -1 );
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	CFILE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2527,54 +11550,38 @@ on_error:
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT ) && defined( WINAPI )
+#if defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT )
 
-/* Tests the libcfile_internal_file_read_buffer_at_offset_with_error_code function
+/* Tests the libcfile_internal_file_io_control_read_with_error_code function
  * Returns 1 if successful or 0 if not
  */
-int cfile_test_internal_file_read_buffer_at_offset_with_error_code(
+int cfile_test_internal_file_io_control_read_with_error_code(
      libcfile_file_t *file )
 {
-	uint8_t buffer[ 32 ];
+	uint8_t control_data[ 32 ];
+	uint8_t data[ 128 ];
 
-	libcerror_error_t *error     = NULL;
-	libcfile_file_t *closed_file = NULL;
-	size64_t file_size           = 0;
-	ssize_t read_count           = 0;
-	off64_t offset               = 0;
-	uint32_t error_code          = 0;
-	int result                   = 0;
+	libcerror_error_t *error = NULL;
+	ssize_t read_count       = 0;
+	uint32_t error_code      = 0;
+	int result               = 0;
+
+#if defined( WINAPI )
+	HANDLE file_handle       = INVALID_HANDLE_VALUE;
+#else
+	int file_descriptor      = -1;
+#endif
 
 	/* Initialize test
 	 */
-	result = libcfile_file_get_size(
+	result = libcfile_file_is_device(
 	          file,
-	          &file_size,
 	          &error );
 
-	CFILE_TEST_ASSERT_EQUAL_INT(
+	CFILE_TEST_ASSERT_NOT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CFILE_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	if( file_size < 32 )
-	{
-		return( 1 );
-	}
-	offset = libcfile_file_seek_offset(
-	          file,
-	          0,
-	          SEEK_SET,
-	          &error );
-
-	CFILE_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) 0 );
+	 -1 );
 
 	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -2582,30 +11589,19 @@ int cfile_test_internal_file_read_buffer_at_offset_with_error_code(
 
 	/* Test regular cases
 	 */
-	read_count = libcfile_internal_file_read_buffer_at_offset_with_error_code(
-	              (libcfile_internal_file_t *) file,
-	              0,
-	              buffer,
-	              32,
-	              &error_code,
-	              &error );
-
-	CFILE_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) 32 );
-
-	CFILE_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
+	if( result == 0 )
+	{
+/* TODO implement */
+	}
 	/* Test error cases
 	 */
-	read_count = libcfile_internal_file_read_buffer_at_offset_with_error_code(
+	read_count = libcfile_internal_file_io_control_read_with_error_code(
 	              NULL,
 	              0,
-	              buffer,
+	              control_data,
 	              32,
+	              data,
+	              128,
 	              &error_code,
 	              &error );
 
@@ -2621,14 +11617,32 @@ int cfile_test_internal_file_read_buffer_at_offset_with_error_code(
 	libcerror_error_free(
 	 &error );
 
-	read_count = libcfile_internal_file_read_buffer_at_offset_with_error_code(
+#if defined( WINAPI )
+	file_handle = ( (libcfile_internal_file_t *) file )->handle;
+
+	( (libcfile_internal_file_t *) file )->handle = INVALID_HANDLE_VALUE;
+#else
+	file_descriptor = ( (libcfile_internal_file_t *) file )->descriptor;
+
+	( (libcfile_internal_file_t *) file )->descriptor = -1;
+#endif
+
+	read_count = libcfile_internal_file_io_control_read_with_error_code(
 	              (libcfile_internal_file_t *) file,
-	              -1,
-	              buffer,
+	              0,
+	              control_data,
 	              32,
+	              data,
+	              128,
 	              &error_code,
 	              &error );
 
+#if defined( WINAPI )
+	( (libcfile_internal_file_t *) file )->handle = file_handle;
+#else
+	( (libcfile_internal_file_t *) file )->descriptor = file_descriptor;
+#endif
+
 	CFILE_TEST_ASSERT_EQUAL_SSIZE(
 	 "read_count",
 	 read_count,
@@ -2641,11 +11655,13 @@ int cfile_test_internal_file_read_buffer_at_offset_with_error_code(
 	libcerror_error_free(
 	 &error );
 
-	read_count = libcfile_internal_file_read_buffer_at_offset_with_error_code(
+	read_count = libcfile_internal_file_io_control_read_with_error_code(
 	              (libcfile_internal_file_t *) file,
 	              0,
 	              NULL,
 	              32,
+	              data,
+	              128,
 	              &error_code,
 	              &error );
 
@@ -2661,11 +11677,13 @@ int cfile_test_internal_file_read_buffer_at_offset_with_error_code(
 	libcerror_error_free(
 	 &error );
 
-	read_count = libcfile_internal_file_read_buffer_at_offset_with_error_code(
+	read_count = libcfile_internal_file_io_control_read_with_error_code(
 	              (libcfile_internal_file_t *) file,
 	              0,
-	              buffer,
-	              (size_t) SSIZE_MAX + 1,
+	              control_data,
+	              32,
+	              NULL,
+	              128,
 	              &error_code,
 	              &error );
 
@@ -2681,11 +11699,13 @@ int cfile_test_internal_file_read_buffer_at_offset_with_error_code(
 	libcerror_error_free(
 	 &error );
 
-	read_count = libcfile_internal_file_read_buffer_at_offset_with_error_code(
+	read_count = libcfile_internal_file_io_control_read_with_error_code(
 	              (libcfile_internal_file_t *) file,
 	              0,
-	              buffer,
+	              control_data,
 	              32,
+	              data,
+	              128,
 	              NULL,
 	              &error );
 
@@ -2701,32 +11721,14 @@ int cfile_test_internal_file_read_buffer_at_offset_with_error_code(
 	libcerror_error_free(
 	 &error );
 
-	/* Initialize test
-	 */
-	result = libcfile_file_initialize(
-	          &closed_file,
-	          &error );
-
-	CFILE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	CFILE_TEST_ASSERT_IS_NOT_NULL(
-	 "closed_file",
-	 closed_file );
-
-	CFILE_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	/* Test read buffer with error code on a closed file
-	 */
-	read_count = libcfile_internal_file_read_buffer_at_offset_with_error_code(
-	              (libcfile_internal_file_t *) closed_file,
+#if defined( HAVE_IOCTL )
+	read_count = libcfile_internal_file_io_control_read_with_error_code(
+	              (libcfile_internal_file_t *) file,
 	              0,
-	              buffer,
-	              32,
+	              control_data,
+	              0,
+	              data,
+	              128,
 	              &error_code,
 	              &error );
 
@@ -2742,24 +11744,7 @@ int cfile_test_internal_file_read_buffer_at_offset_with_error_code(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up
-	 */
-	result = libcfile_file_free(
-	          &closed_file,
-	          &error );
-
-	CFILE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	CFILE_TEST_ASSERT_IS_NULL(
-	 "closed_file",
-	 closed_file );
-
-	CFILE_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+#endif /* defined( HAVE_IOCTL ) */
 
 	return( 1 );
 
@@ -2769,69 +11754,34 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( closed_file != NULL )
-	{
-		libcfile_file_free(
-		 &closed_file,
-		 NULL );
-	}
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT ) && defined( WINAPI ) */
+#endif /* defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT ) */
 
-/* Tests the libcfile_file_read_buffer_with_error_code function
+/* Tests the libcfile_file_io_control_read function
  * Returns 1 if successful or 0 if not
  */
-int cfile_test_file_read_buffer_with_error_code(
+int cfile_test_file_io_control_read(
      libcfile_file_t *file )
 {
-	uint8_t buffer[ 32 ];
-
-	libcerror_error_t *error     = NULL;
-	libcfile_file_t *closed_file = NULL;
-	size64_t file_size           = 0;
-	ssize_t read_count           = 0;
-	off64_t offset               = 0;
-	uint32_t error_code          = 0;
-	int result                   = 0;
+	uint8_t control_data[ 32 ];
+	uint8_t data[ 128 ];
 
-#if defined( WINAPI )
-	HANDLE file_handle           = INVALID_HANDLE_VALUE;
-#else
-	int file_descriptor          = -1;
-#endif
+	libcerror_error_t *error = NULL;
+	ssize_t read_count       = 0;
+	int result               = 0;
 
 	/* Initialize test
 	 */
-	result = libcfile_file_get_size(
+	result = libcfile_file_is_device(
 	          file,
-	          &file_size,
 	          &error );
 
-	CFILE_TEST_ASSERT_EQUAL_INT(
+	CFILE_TEST_ASSERT_NOT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CFILE_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	if( file_size < 32 )
-	{
-		return( 1 );
-	}
-	offset = libcfile_file_seek_offset(
-	          file,
-	          0,
-	          SEEK_SET,
-	          &error );
-
-	CFILE_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) 0 );
+	 -1 );
 
 	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -2839,29 +11789,19 @@ int cfile_test_file_read_buffer_with_error_code(
 
 	/* Test regular cases
 	 */
-	read_count = libcfile_file_read_buffer_with_error_code(
-	              file,
-	              buffer,
-	              32,
-	              &error_code,
-	              &error );
-
-	CFILE_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) 32 );
-
-	CFILE_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
+	if( result == 0 )
+	{
+/* TODO implement */
+	}
 	/* Test error cases
 	 */
-	read_count = libcfile_file_read_buffer_with_error_code(
+	read_count = libcfile_file_io_control_read(
 	              NULL,
-	              buffer,
 	              0,
-	              &error_code,
+	              control_data,
+	              32,
+	              data,
+	              128,
 	              &error );
 
 	CFILE_TEST_ASSERT_EQUAL_SSIZE(
@@ -2876,45 +11816,61 @@ int cfile_test_file_read_buffer_with_error_code(
 	libcerror_error_free(
 	 &error );
 
-#if defined( WINAPI )
-	file_handle = ( (libcfile_internal_file_t *) file )->handle;
+	return( 1 );
 
-	( (libcfile_internal_file_t *) file )->handle = INVALID_HANDLE_VALUE;
-#else
-	file_descriptor = ( (libcfile_internal_file_t *) file )->descriptor;
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
 
-	( (libcfile_internal_file_t *) file )->descriptor = -1;
-#endif
+/* Tests the libcfile_file_io_control_read_with_error_code function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_io_control_read_with_error_code(
+     libcfile_file_t *file )
+{
+	uint8_t control_data[ 32 ];
+	uint8_t data[ 128 ];
 
-	read_count = libcfile_file_read_buffer_with_error_code(
-	              file,
-	              buffer,
-	              0,
-	              &error_code,
-	              &error );
+	libcerror_error_t *error = NULL;
+	ssize_t read_count       = 0;
+	uint32_t error_code      = 0;
+	int result               = 0;
 
-#if defined( WINAPI )
-	( (libcfile_internal_file_t *) file )->handle = file_handle;
-#else
-	( (libcfile_internal_file_t *) file )->descriptor = file_descriptor;
-#endif
+	/* Initialize test
+	 */
+	result = libcfile_file_is_device(
+	          file,
+	          &error );
 
-	CFILE_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) -1 );
+	CFILE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	read_count = libcfile_file_read_buffer_with_error_code(
-	              file,
+	/* Test regular cases
+	 */
+	if( result == 0 )
+	{
+/* TODO implement */
+	}
+	/* Test error cases
+	 */
+	read_count = libcfile_file_io_control_read_with_error_code(
 	              NULL,
 	              0,
+	              control_data,
+	              32,
+	              data,
+	              128,
 	              &error_code,
 	              &error );
 
@@ -2930,48 +11886,54 @@ int cfile_test_file_read_buffer_with_error_code(
 	libcerror_error_free(
 	 &error );
 
-	read_count = libcfile_file_read_buffer_with_error_code(
-	              file,
-	              buffer,
-	              (size_t) SSIZE_MAX + 1,
-	              &error_code,
-	              &error );
+	return( 1 );
 
-	CFILE_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) -1 );
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
 
-	CFILE_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+/* Tests the libcfile_file_set_access_behavior function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_set_access_behavior(
+     libcfile_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	size64_t file_size       = 0;
+	int result               = 0;
 
-	libcerror_error_free(
-	 &error );
+#if defined( WINAPI )
+	HANDLE file_handle       = INVALID_HANDLE_VALUE;
+#else
+	int file_descriptor      = -1;
+#endif
 
-	read_count = libcfile_file_read_buffer_with_error_code(
-	              file,
-	              buffer,
-	              0,
-	              NULL,
-	              &error );
+	/* Initialize test
+	 */
+	result = libcfile_file_get_size(
+	          file,
+	          &file_size,
+	          &error );
 
-	CFILE_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) -1 );
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	/* Initialize test
+	/* Test regular cases
 	 */
-	result = libcfile_file_initialize(
-	          &closed_file,
+	result = libcfile_file_set_access_behavior(
+	          file,
+	          LIBCFILE_ACCESS_BEHAVIOR_NORMAL,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
@@ -2979,39 +11941,32 @@ int cfile_test_file_read_buffer_with_error_code(
 	 result,
 	 1 );
 
-	CFILE_TEST_ASSERT_IS_NOT_NULL(
-	 "closed_file",
-	 closed_file );
-
 	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test read buffer with error code on a closed file
-	 */
-	read_count = libcfile_file_read_buffer_with_error_code(
-	              closed_file,
-	              buffer,
-	              0,
-	              &error_code,
-	              &error );
+	result = libcfile_file_set_access_behavior(
+	          file,
+	          LIBCFILE_ACCESS_BEHAVIOR_STREAMING,
+	          &error );
 
-	CFILE_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) -1 );
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "access_behavior",
+	 ( (libcfile_internal_file_t *) file )->access_behavior,
+	 LIBCFILE_ACCESS_BEHAVIOR_STREAMING );
 
-	/* Clean up
-	 */
-	result = libcfile_file_free(
-	          &closed_file,
+	result = libcfile_file_set_access_behavior(
+	          file,
+	          LIBCFILE_ACCESS_BEHAVIOR_NORMAL,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
@@ -3020,58 +11975,64 @@ int cfile_test_file_read_buffer_with_error_code(
 	 1 );
 
 	CFILE_TEST_ASSERT_IS_NULL(
-	 "closed_file",
-	 closed_file );
+	 "error",
+	 error );
 
-	CFILE_TEST_ASSERT_IS_NULL(
+	/* Test error cases
+	 */
+	result = libcfile_file_set_access_behavior(
+	          NULL,
+	          LIBCFILE_ACCESS_BEHAVIOR_NORMAL,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	return( 1 );
+	libcerror_error_free(
+	 &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( closed_file != NULL )
-	{
-		libcfile_file_free(
-		 &closed_file,
-		 NULL );
-	}
-	return( 0 );
-}
+#if defined( WINAPI )
+	file_handle = ( (libcfile_internal_file_t *) file )->handle;
 
-/* Tests the libcfile_file_is_open function
- * Returns 1 if successful or 0 if not
- */
-int cfile_test_file_is_open(
-     libcfile_file_t *file )
-{
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	( (libcfile_internal_file_t *) file )->handle = INVALID_HANDLE_VALUE;
+#else
+	file_descriptor = ( (libcfile_internal_file_t *) file )->descriptor;
 
-	/* Test regular cases
-	 */
-	result = libcfile_file_is_open(
+	( (libcfile_internal_file_t *) file )->descriptor = -1;
+#endif
+
+	result = libcfile_file_set_access_behavior(
 	          file,
+	          LIBCFILE_ACCESS_BEHAVIOR_NORMAL,
 	          &error );
 
+#if defined( WINAPI )
+	( (libcfile_internal_file_t *) file )->handle = file_handle;
+#else
+	( (libcfile_internal_file_t *) file )->descriptor = file_descriptor;
+#endif
+
 	CFILE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	CFILE_TEST_ASSERT_IS_NULL(
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libcfile_file_is_open(
-	          NULL,
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_set_access_behavior(
+	          file,
+	          -1,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
@@ -3097,21 +12058,42 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libcfile_file_get_offset function
+/* Tests the libcfile_file_prefetch function
  * Returns 1 if successful or 0 if not
  */
-int cfile_test_file_get_offset(
+int cfile_test_file_prefetch(
      libcfile_file_t *file )
 {
-	libcerror_error_t *error = NULL;
-	off64_t offset           = 0;
-	int result               = 0;
+	off64_t range_offsets[ 4 ] = { 0, 512, 1024, INT64_MAX };
+	size64_t range_sizes[ 4 ]  = { 1024, 512, 4096, 1 };
+
+	libcerror_error_t *error   = NULL;
+	off64_t invalid_offset     = -1;
+	int result                 = 0;
 
 	/* Test regular cases
 	 */
-	result = libcfile_file_get_offset(
+	result = libcfile_file_prefetch(
 	          file,
-	          &offset,
+	          range_offsets,
+	          range_sizes,
+	          4,
+	          &error );
+
+	CFILE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_file_prefetch(
+	          file,
+	          NULL,
+	          NULL,
+	          0,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
@@ -3125,9 +12107,11 @@ int cfile_test_file_get_offset(
 
 	/* Test error cases
 	 */
-	result = libcfile_file_get_offset(
+	result = libcfile_file_prefetch(
 	          NULL,
-	          &offset,
+	          range_offsets,
+	          range_sizes,
+	          4,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
@@ -3142,9 +12126,11 @@ int cfile_test_file_get_offset(
 	libcerror_error_free(
 	 &error );
 
-	result = libcfile_file_get_offset(
+	result = libcfile_file_prefetch(
 	          file,
-	          NULL,
+	          range_offsets,
+	          range_sizes,
+	          -1,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
@@ -3159,50 +12145,30 @@ int cfile_test_file_get_offset(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-#if defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT )
-
-/* Tests the libcfile_internal_file_get_size function
- * Returns 1 if successful or 0 if not
- */
-int cfile_test_internal_file_get_size(
-     libcfile_file_t *file )
-{
-	libcerror_error_t *error = NULL;
-	size64_t size            = 0;
-	int result               = 0;
-
-	/* Test regular cases
-	 */
-	result = libcfile_internal_file_get_size(
-	          (libcfile_internal_file_t *) file,
-	          &size,
+	result = libcfile_file_prefetch(
+	          file,
+	          NULL,
+	          range_sizes,
+	          4,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	CFILE_TEST_ASSERT_IS_NULL(
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libcfile_internal_file_get_size(
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_prefetch(
+	          file,
+	          range_offsets,
 	          NULL,
-	          &size,
+	          4,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
@@ -3217,9 +12183,11 @@ int cfile_test_internal_file_get_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libcfile_internal_file_get_size(
-	          (libcfile_internal_file_t *) file,
-	          NULL,
+	result = libcfile_file_prefetch(
+	          file,
+	          &invalid_offset,
+	          range_sizes,
+	          1,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
@@ -3245,39 +12213,119 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT ) */
-
-/* Tests the libcfile_file_get_size function
+/* Tests the libcfile_file_get_cache_residency function
  * Returns 1 if successful or 0 if not
  */
-int cfile_test_file_get_size(
+int cfile_test_file_get_cache_residency(
      libcfile_file_t *file )
 {
+	uint8_t bitmap[ 2 ];
+	uint8_t buffer[ 16 ];
+
 	libcerror_error_t *error = NULL;
-	size64_t size            = 0;
+	size_t page_size         = 0;
+	ssize_t read_count       = 0;
 	int result               = 0;
 
+	/* Initialize test
+	 */
+	read_count = libcfile_file_read_buffer_at_offset(
+	              file,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	CFILE_TEST_ASSERT_NOT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test regular cases
 	 */
-	result = libcfile_file_get_size(
+	result = libcfile_file_get_cache_residency(
 	          file,
-	          &size,
+	          0,
+	          16,
+	          bitmap,
+	          2,
+	          &page_size,
 	          &error );
 
-	CFILE_TEST_ASSERT_EQUAL_INT(
+	CFILE_TEST_ASSERT_NOT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( ( result == 1 )
+	 && ( read_count > 0 ) )
+	{
+		CFILE_TEST_ASSERT_NOT_EQUAL_INT(
+		 "page_size",
+		 (int) page_size,
+		 0 );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "bitmap[ 0 ]",
+		 (int) ( bitmap[ 0 ] & 0x01 ),
+		 1 );
+	}
+	result = libcfile_file_get_cache_residency(
+	          file,
+	          INT64_MAX - 1,
+	          0,
+	          bitmap,
+	          2,
+	          &page_size,
+	          &error );
+
+	CFILE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libcfile_file_get_size(
-	          NULL,
-	          &size,
+	/* Test error cases
+	 */
+	result = libcfile_file_get_cache_residency(
+	          NULL,
+	          0,
+	          16,
+	          bitmap,
+	          2,
+	          &page_size,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_get_cache_residency(
+	          file,
+	          -1,
+	          16,
+	          bitmap,
+	          2,
+	          &page_size,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
@@ -3292,9 +12340,13 @@ int cfile_test_file_get_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libcfile_file_get_size(
+	result = libcfile_file_get_cache_residency(
 	          file,
+	          0,
+	          16,
 	          NULL,
+	          2,
+	          &page_size,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
@@ -3309,45 +12361,34 @@ int cfile_test_file_get_size(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libcfile_file_is_device function
- * Returns 1 if successful or 0 if not
- */
-int cfile_test_file_is_device(
-     libcfile_file_t *file )
-{
-	libcerror_error_t *error = NULL;
-	int result               = 0;
-
-	/* Test regular cases
-	 */
-	result = libcfile_file_is_device(
+	result = libcfile_file_get_cache_residency(
 	          file,
+	          0,
+	          16,
+	          bitmap,
+	          2,
+	          NULL,
 	          &error );
 
-	CFILE_TEST_ASSERT_NOT_EQUAL_INT(
+	CFILE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 -1 );
 
-	CFILE_TEST_ASSERT_IS_NULL(
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libcfile_file_is_device(
-	          NULL,
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_get_cache_residency(
+	          file,
+	          0,
+	          16 * 1024 * 1024,
+	          bitmap,
+	          2,
+	          &page_size,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
@@ -3373,38 +12414,32 @@ on_error:
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT )
-
-/* Tests the libcfile_internal_file_io_control_read_with_error_code function
+/* Tests the libcfile_file_read_cached_buffer_at_offset function
  * Returns 1 if successful or 0 if not
  */
-int cfile_test_internal_file_io_control_read_with_error_code(
+int cfile_test_file_read_cached_buffer_at_offset(
      libcfile_file_t *file )
 {
-	uint8_t control_data[ 32 ];
-	uint8_t data[ 128 ];
+	uint8_t buffer[ 16 ];
+	uint8_t expected_buffer[ 16 ];
 
 	libcerror_error_t *error = NULL;
 	ssize_t read_count       = 0;
-	uint32_t error_code      = 0;
 	int result               = 0;
 
-#if defined( WINAPI )
-	HANDLE file_handle       = INVALID_HANDLE_VALUE;
-#else
-	int file_descriptor      = -1;
-#endif
-
 	/* Initialize test
 	 */
-	result = libcfile_file_is_device(
-	          file,
-	          &error );
+	read_count = libcfile_file_read_buffer_at_offset(
+	              file,
+	              expected_buffer,
+	              16,
+	              0,
+	              &error );
 
-	CFILE_TEST_ASSERT_NOT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	CFILE_TEST_ASSERT_NOT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
 
 	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -3412,20 +12447,58 @@ int cfile_test_internal_file_io_control_read_with_error_code(
 
 	/* Test regular cases
 	 */
-	if( result == 0 )
+	read_count = libcfile_file_read_cached_buffer_at_offset(
+	              file,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	CFILE_TEST_ASSERT_NOT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( read_count > 0 )
 	{
-/* TODO implement */
+		result = memory_compare(
+		          buffer,
+		          expected_buffer,
+		          (size_t) read_count );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
 	}
+
+	read_count = libcfile_file_read_cached_buffer_at_offset(
+	              file,
+	              buffer,
+	              0,
+	              0,
+	              &error );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test error cases
 	 */
-	read_count = libcfile_internal_file_io_control_read_with_error_code(
+	read_count = libcfile_file_read_cached_buffer_at_offset(
 	              NULL,
+	              buffer,
+	              16,
 	              0,
-	              control_data,
-	              32,
-	              data,
-	              128,
-	              &error_code,
 	              &error );
 
 	CFILE_TEST_ASSERT_EQUAL_SSIZE(
@@ -3440,32 +12513,13 @@ int cfile_test_internal_file_io_control_read_with_error_code(
 	libcerror_error_free(
 	 &error );
 
-#if defined( WINAPI )
-	file_handle = ( (libcfile_internal_file_t *) file )->handle;
-
-	( (libcfile_internal_file_t *) file )->handle = INVALID_HANDLE_VALUE;
-#else
-	file_descriptor = ( (libcfile_internal_file_t *) file )->descriptor;
-
-	( (libcfile_internal_file_t *) file )->descriptor = -1;
-#endif
-
-	read_count = libcfile_internal_file_io_control_read_with_error_code(
-	              (libcfile_internal_file_t *) file,
+	read_count = libcfile_file_read_cached_buffer_at_offset(
+	              file,
+	              NULL,
+	              16,
 	              0,
-	              control_data,
-	              32,
-	              data,
-	              128,
-	              &error_code,
 	              &error );
 
-#if defined( WINAPI )
-	( (libcfile_internal_file_t *) file )->handle = file_handle;
-#else
-	( (libcfile_internal_file_t *) file )->descriptor = file_descriptor;
-#endif
-
 	CFILE_TEST_ASSERT_EQUAL_SSIZE(
 	 "read_count",
 	 read_count,
@@ -3478,14 +12532,11 @@ int cfile_test_internal_file_io_control_read_with_error_code(
 	libcerror_error_free(
 	 &error );
 
-	read_count = libcfile_internal_file_io_control_read_with_error_code(
-	              (libcfile_internal_file_t *) file,
+	read_count = libcfile_file_read_cached_buffer_at_offset(
+	              file,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
 	              0,
-	              NULL,
-	              32,
-	              data,
-	              128,
-	              &error_code,
 	              &error );
 
 	CFILE_TEST_ASSERT_EQUAL_SSIZE(
@@ -3500,14 +12551,11 @@ int cfile_test_internal_file_io_control_read_with_error_code(
 	libcerror_error_free(
 	 &error );
 
-	read_count = libcfile_internal_file_io_control_read_with_error_code(
-	              (libcfile_internal_file_t *) file,
-	              0,
-	              control_data,
-	              32,
-	              NULL,
-	              128,
-	              &error_code,
+	read_count = libcfile_file_read_cached_buffer_at_offset(
+	              file,
+	              buffer,
+	              16,
+	              -1,
 	              &error );
 
 	CFILE_TEST_ASSERT_EQUAL_SSIZE(
@@ -3522,20 +12570,141 @@ int cfile_test_internal_file_io_control_read_with_error_code(
 	libcerror_error_free(
 	 &error );
 
-	read_count = libcfile_internal_file_io_control_read_with_error_code(
-	              (libcfile_internal_file_t *) file,
-	              0,
-	              control_data,
-	              32,
-	              data,
-	              128,
-	              NULL,
-	              &error );
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT )
+
+/* Tests the libcfile_file_set_readahead_size function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_set_readahead_size(
+     libcfile_file_t *file )
+{
+	uint8_t buffer[ 16 ];
+	uint8_t expected_buffer[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	ssize_t read_count       = 0;
+	off64_t offset           = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcfile_file_set_readahead_size(
+	          file,
+	          1024 * 1024,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libcfile_file_seek_offset(
+	          file,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Read sequentially so that the readahead prefetches the data
+	 */
+	do
+	{
+		read_count = libcfile_file_read_buffer(
+		              file,
+		              buffer,
+		              16,
+		              &error );
+
+		CFILE_TEST_ASSERT_NOT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( read_count > 0 )
+		{
+			read_count = libcfile_file_read_buffer_at_offset(
+			              file,
+			              expected_buffer,
+			              (size_t) read_count,
+			              offset,
+			              &error );
+
+			CFILE_TEST_ASSERT_NOT_EQUAL_SSIZE(
+			 "read_count",
+			 read_count,
+			 (ssize_t) -1 );
+
+			CFILE_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = memory_compare(
+			          buffer,
+			          expected_buffer,
+			          (size_t) read_count );
+
+			CFILE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			offset += (off64_t) read_count;
+		}
+	}
+	while( read_count > 0 );
+
+	result = libcfile_file_set_readahead_size(
+	          file,
+	          0,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	CFILE_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) -1 );
+	/* Test error cases
+	 */
+	result = libcfile_file_set_readahead_size(
+	          NULL,
+	          1024 * 1024,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	CFILE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -3544,21 +12713,15 @@ int cfile_test_internal_file_io_control_read_with_error_code(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_IOCTL )
-	read_count = libcfile_internal_file_io_control_read_with_error_code(
-	              (libcfile_internal_file_t *) file,
-	              0,
-	              control_data,
-	              0,
-	              data,
-	              128,
-	              &error_code,
-	              &error );
+	result = libcfile_file_set_readahead_size(
+	          file,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
 
-	CFILE_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) -1 );
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	CFILE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -3567,8 +12730,6 @@ int cfile_test_internal_file_io_control_read_with_error_code(
 	libcerror_error_free(
 	 &error );
 
-#endif /* defined( HAVE_IOCTL ) */
-
 	return( 1 );
 
 on_error:
@@ -3580,31 +12741,27 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT ) */
-
-/* Tests the libcfile_file_io_control_read function
+/* Tests the libcfile_internal_file_set_block_size function
  * Returns 1 if successful or 0 if not
  */
-int cfile_test_file_io_control_read(
+int cfile_test_internal_file_set_block_size(
      libcfile_file_t *file )
 {
-	uint8_t control_data[ 32 ];
-	uint8_t data[ 128 ];
-
 	libcerror_error_t *error = NULL;
-	ssize_t read_count       = 0;
+	size64_t file_size       = 0;
 	int result               = 0;
 
 	/* Initialize test
 	 */
-	result = libcfile_file_is_device(
+	result = libcfile_file_get_size(
 	          file,
+	          &file_size,
 	          &error );
 
-	CFILE_TEST_ASSERT_NOT_EQUAL_INT(
+	CFILE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -3612,25 +12769,47 @@ int cfile_test_file_io_control_read(
 
 	/* Test regular cases
 	 */
-	if( result == 0 )
-	{
-/* TODO implement */
-	}
+	result = libcfile_internal_file_set_block_size(
+	          (libcfile_internal_file_t *) file,
+	          512,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libcfile_internal_file_set_block_size(
+	          (libcfile_internal_file_t *) file,
+	          0,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test error cases
 	 */
-	read_count = libcfile_file_io_control_read(
-	              NULL,
-	              0,
-	              control_data,
-	              32,
-	              data,
-	              128,
-	              &error );
+	result = libcfile_internal_file_set_block_size(
+	          NULL,
+	          512,
+	          &error );
 
-	CFILE_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) -1 );
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	CFILE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -3639,76 +12818,97 @@ int cfile_test_file_io_control_read(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libcfile_file_io_control_read_with_error_code function
- * Returns 1 if successful or 0 if not
- */
-int cfile_test_file_io_control_read_with_error_code(
-     libcfile_file_t *file )
-{
-	uint8_t control_data[ 32 ];
-	uint8_t data[ 128 ];
-
-	libcerror_error_t *error = NULL;
-	ssize_t read_count       = 0;
-	uint32_t error_code      = 0;
-	int result               = 0;
-
-	/* Initialize test
-	 */
-	result = libcfile_file_is_device(
-	          file,
+	result = libcfile_internal_file_set_block_size(
+	          (libcfile_internal_file_t *) file,
+	          (size_t) SSIZE_MAX + 1,
 	          &error );
 
-	CFILE_TEST_ASSERT_NOT_EQUAL_INT(
+	CFILE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 -1 );
 
-	CFILE_TEST_ASSERT_IS_NULL(
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CFILE_TEST_MEMORY )
+
+	/* Test libcfile_file_initialize with malloc failing
 	 */
-	if( result == 0 )
+	cfile_test_malloc_attempts_before_fail = 0;
+
+	result = libcfile_internal_file_set_block_size(
+	          (libcfile_internal_file_t *) file,
+	          512,
+	          &error );
+
+	if( cfile_test_malloc_attempts_before_fail != -1 )
 	{
-/* TODO implement */
+		cfile_test_malloc_attempts_before_fail = -1;
 	}
-	/* Test error cases
+	else
+	{
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libcfile_file_initialize with memset failing
 	 */
-	read_count = libcfile_file_io_control_read_with_error_code(
-	              NULL,
-	              0,
-	              control_data,
-	              32,
-	              data,
-	              128,
-	              &error_code,
-	              &error );
+	cfile_test_memset_attempts_before_fail = 0;
 
-	CFILE_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) -1 );
+	result = libcfile_internal_file_set_block_size(
+	          (libcfile_internal_file_t *) file,
+	          512,
+	          &error );
 
-	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	if( cfile_test_memset_attempts_before_fail != -1 )
+	{
+		cfile_test_memset_attempts_before_fail = -1;
+	}
+	else
+	{
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_CFILE_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libcfile_internal_file_set_block_size(
+	          (libcfile_internal_file_t *) file,
+	          0,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
 	return( 1 );
 
 on_error:
@@ -3720,10 +12920,12 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libcfile_file_set_access_behavior function
+#endif /* defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT ) */
+
+/* Tests the libcfile_file_set_block_size function
  * Returns 1 if successful or 0 if not
  */
-int cfile_test_file_set_access_behavior(
+int cfile_test_file_set_block_size(
      libcfile_file_t *file )
 {
 	libcerror_error_t *error = NULL;
@@ -3754,25 +12956,43 @@ int cfile_test_file_set_access_behavior(
 
 	/* Test regular cases
 	 */
-	result = libcfile_file_set_access_behavior(
-	          file,
-	          LIBCFILE_ACCESS_BEHAVIOR_NORMAL,
-	          &error );
+	if( ( file_size % 512 ) == 0 )
+	{
+		result = libcfile_file_set_block_size(
+		          file,
+		          512,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	CFILE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	CFILE_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		/* Clean up
+		 */
+		result = libcfile_file_set_block_size(
+		          file,
+		          0,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
 	/* Test error cases
 	 */
-	result = libcfile_file_set_access_behavior(
+	result = libcfile_file_set_block_size(
 	          NULL,
-	          LIBCFILE_ACCESS_BEHAVIOR_NORMAL,
+	          512,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
@@ -3797,9 +13017,9 @@ int cfile_test_file_set_access_behavior(
 	( (libcfile_internal_file_t *) file )->descriptor = -1;
 #endif
 
-	result = libcfile_file_set_access_behavior(
+	result = libcfile_file_set_block_size(
 	          file,
-	          LIBCFILE_ACCESS_BEHAVIOR_NORMAL,
+	          512,
 	          &error );
 
 #if defined( WINAPI )
@@ -3820,9 +13040,9 @@ int cfile_test_file_set_access_behavior(
 	libcerror_error_free(
 	 &error );
 
-	result = libcfile_file_set_access_behavior(
+	result = libcfile_file_set_block_size(
 	          file,
-	          -1,
+	          (size_t) SSIZE_MAX + 1,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
@@ -3837,6 +13057,41 @@ int cfile_test_file_set_access_behavior(
 	libcerror_error_free(
 	 &error );
 
+	if( ( file_size % 511 ) == 0 )
+	{
+		result = libcfile_file_set_block_size(
+		          NULL,
+		          511,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libcfile_file_set_block_size(
+	          file,
+	          0,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -3848,17 +13103,22 @@ on_error:
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT )
-
-/* Tests the libcfile_internal_file_set_block_size function
+/* Tests the libcfile_file_set_cache_size and libcfile_file_get_cache_statistics functions
  * Returns 1 if successful or 0 if not
  */
-int cfile_test_internal_file_set_block_size(
+int cfile_test_file_set_cache_size(
      libcfile_file_t *file )
 {
-	libcerror_error_t *error = NULL;
-	size64_t file_size       = 0;
-	int result               = 0;
+	uint8_t buffer[ 16 ];
+	uint8_t cached_buffer[ 16 ];
+
+	libcerror_error_t *error  = NULL;
+	size64_t file_size        = 0;
+	uint64_t number_of_hits   = 0;
+	uint64_t number_of_misses = 0;
+	ssize_t read_count        = 0;
+	off64_t offset            = 0;
+	int result                = 0;
 
 	/* Initialize test
 	 */
@@ -3878,9 +13138,9 @@ int cfile_test_internal_file_set_block_size(
 
 	/* Test regular cases
 	 */
-	result = libcfile_internal_file_set_block_size(
-	          (libcfile_internal_file_t *) file,
-	          512,
+	result = libcfile_file_set_cache_size(
+	          file,
+	          4,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
@@ -3892,11 +13152,140 @@ int cfile_test_internal_file_set_block_size(
 	 "error",
 	 error );
 
-	/* Clean up
-	 */
-	result = libcfile_internal_file_set_block_size(
-	          (libcfile_internal_file_t *) file,
-	          0,
+	if( ( ( file_size % 512 ) == 0 )
+	 && ( file_size >= 1024 ) )
+	{
+		result = libcfile_file_set_block_size(
+		          file,
+		          512,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Read a range that straddles a block boundary twice
+		 */
+		offset = libcfile_file_seek_offset(
+		          file,
+		          504,
+		          SEEK_SET,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 (int64_t) offset,
+		 (int64_t) 504 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_count = libcfile_file_read_buffer(
+		              file,
+		              buffer,
+		              16,
+		              &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 16 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		offset = libcfile_file_seek_offset(
+		          file,
+		          504,
+		          SEEK_SET,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 (int64_t) offset,
+		 (int64_t) 504 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_count = libcfile_file_read_buffer(
+		              file,
+		              cached_buffer,
+		              16,
+		              &error );
+
+		CFILE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 16 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          buffer,
+		          cached_buffer,
+		          16 );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = libcfile_file_get_cache_statistics(
+		          file,
+		          &number_of_hits,
+		          &number_of_misses,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_EQUAL_UINT64(
+		 "number_of_hits",
+		 number_of_hits,
+		 (uint64_t) 2 );
+
+		CFILE_TEST_ASSERT_EQUAL_UINT64(
+		 "number_of_misses",
+		 number_of_misses,
+		 (uint64_t) 2 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Clean up
+		 */
+		result = libcfile_file_set_block_size(
+		          file,
+		          0,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libcfile_file_get_cache_statistics(
+	          file,
+	          &number_of_hits,
+	          &number_of_misses,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
@@ -3904,15 +13293,25 @@ int cfile_test_internal_file_set_block_size(
 	 result,
 	 1 );
 
+	CFILE_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 0 );
+
+	CFILE_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) 0 );
+
 	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
 	/* Test error cases
 	 */
-	result = libcfile_internal_file_set_block_size(
+	result = libcfile_file_set_cache_size(
 	          NULL,
-	          512,
+	          4,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
@@ -3927,9 +13326,9 @@ int cfile_test_internal_file_set_block_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libcfile_internal_file_set_block_size(
-	          (libcfile_internal_file_t *) file,
-	          (size_t) SSIZE_MAX + 1,
+	result = libcfile_file_set_cache_size(
+	          file,
+	          0,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
@@ -3944,80 +13343,60 @@ int cfile_test_internal_file_set_block_size(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_CFILE_TEST_MEMORY )
-
-	/* Test libcfile_file_initialize with malloc failing
-	 */
-	cfile_test_malloc_attempts_before_fail = 0;
-
-	result = libcfile_internal_file_set_block_size(
-	          (libcfile_internal_file_t *) file,
-	          512,
+	result = libcfile_file_get_cache_statistics(
+	          NULL,
+	          &number_of_hits,
+	          &number_of_misses,
 	          &error );
 
-	if( cfile_test_malloc_attempts_before_fail != -1 )
-	{
-		cfile_test_malloc_attempts_before_fail = -1;
-	}
-	else
-	{
-		CFILE_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		CFILE_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libcfile_file_initialize with memset failing
-	 */
-	cfile_test_memset_attempts_before_fail = 0;
+	libcerror_error_free(
+	 &error );
 
-	result = libcfile_internal_file_set_block_size(
-	          (libcfile_internal_file_t *) file,
-	          512,
+	result = libcfile_file_get_cache_statistics(
+	          file,
+	          NULL,
+	          &number_of_misses,
 	          &error );
 
-	if( cfile_test_memset_attempts_before_fail != -1 )
-	{
-		cfile_test_memset_attempts_before_fail = -1;
-	}
-	else
-	{
-		CFILE_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		CFILE_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_CFILE_TEST_MEMORY ) */
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	/* Clean up
-	 */
-	result = libcfile_internal_file_set_block_size(
-	          (libcfile_internal_file_t *) file,
-	          0,
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_get_cache_statistics(
+	          file,
+	          &number_of_hits,
+	          NULL,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	CFILE_TEST_ASSERT_IS_NULL(
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -4029,35 +13408,50 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT ) */
-
-/* Tests the libcfile_file_set_block_size function
+/* Tests the libcfile_file_get_statistics, libcfile_file_get_latency_histogram and libcfile_file_reset_statistics functions
  * Returns 1 if successful or 0 if not
  */
-int cfile_test_file_set_block_size(
+int cfile_test_file_get_statistics(
      libcfile_file_t *file )
 {
-	libcerror_error_t *error = NULL;
-	size64_t file_size       = 0;
-	int result               = 0;
+	uint8_t buffer[ 16 ];
+	uint64_t histogram[ LIBCFILE_NUMBER_OF_LATENCY_BUCKETS ];
 
-#if defined( WINAPI )
-	HANDLE file_handle       = INVALID_HANDLE_VALUE;
-#else
-	int file_descriptor      = -1;
-#endif
+	libcerror_error_t *error      = NULL;
+	uint64_t number_of_bytes      = 0;
+	uint64_t number_of_operations = 0;
+	ssize_t read_count            = 0;
+	off64_t offset                = 0;
+	int expected_result           = 0;
+	int result                    = 0;
 
 	/* Initialize test
 	 */
-	result = libcfile_file_get_size(
+	offset = libcfile_file_seek_offset(
 	          file,
-	          &file_size,
+	          0,
+	          SEEK_SET,
 	          &error );
 
-	CFILE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	CFILE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libcfile_file_read_buffer(
+	              file,
+	              buffer,
+	              16,
+	              &error );
+
+	CFILE_TEST_ASSERT_NOT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
 
 	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -4065,93 +13459,106 @@ int cfile_test_file_set_block_size(
 
 	/* Test regular cases
 	 */
-	if( ( file_size % 512 ) == 0 )
-	{
-		result = libcfile_file_set_block_size(
-		          file,
-		          512,
-		          &error );
-
-		CFILE_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	result = libcfile_file_get_statistics(
+	          file,
+	          LIBCFILE_OPERATION_TYPE_READ,
+	          &number_of_operations,
+	          &number_of_bytes,
+	          &error );
 
-		CFILE_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	CFILE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		/* Clean up
-		 */
-		result = libcfile_file_set_block_size(
-		          file,
-		          0,
-		          &error );
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		CFILE_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	/* The statistics are not available when compiled without support
+	 */
+	expected_result = result;
 
-		CFILE_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	if( expected_result == 1 )
+	{
+		CFILE_TEST_ASSERT_NOT_EQUAL_INT64(
+		 "number_of_operations",
+		 (int64_t) number_of_operations,
+		 (int64_t) 0 );
 	}
-	/* Test error cases
-	 */
-	result = libcfile_file_set_block_size(
-	          NULL,
-	          512,
+	result = libcfile_file_get_read_amplification(
+	          file,
+	          &number_of_bytes,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 expected_result );
 
-	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-#if defined( WINAPI )
-	file_handle = ( (libcfile_internal_file_t *) file )->handle;
+	result = libcfile_file_get_latency_histogram(
+	          file,
+	          LIBCFILE_OPERATION_TYPE_READ,
+	          histogram,
+	          LIBCFILE_NUMBER_OF_LATENCY_BUCKETS,
+	          &error );
 
-	( (libcfile_internal_file_t *) file )->handle = INVALID_HANDLE_VALUE;
-#else
-	file_descriptor = ( (libcfile_internal_file_t *) file )->descriptor;
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 expected_result );
 
-	( (libcfile_internal_file_t *) file )->descriptor = -1;
-#endif
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	result = libcfile_file_set_block_size(
+	result = libcfile_file_reset_statistics(
 	          file,
-	          512,
 	          &error );
 
-#if defined( WINAPI )
-	( (libcfile_internal_file_t *) file )->handle = file_handle;
-#else
-	( (libcfile_internal_file_t *) file )->descriptor = file_descriptor;
-#endif
-
 	CFILE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 expected_result );
 
-	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	CFILE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libcfile_file_set_block_size(
+	result = libcfile_file_get_statistics(
 	          file,
-	          (size_t) SSIZE_MAX + 1,
+	          LIBCFILE_OPERATION_TYPE_READ,
+	          &number_of_operations,
+	          &number_of_bytes,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 expected_result );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( expected_result == 1 )
+	{
+		CFILE_TEST_ASSERT_EQUAL_UINT64(
+		 "number_of_operations",
+		 number_of_operations,
+		 (uint64_t) 0 );
+	}
+	/* Test error cases
+	 */
+	result = libcfile_file_get_statistics(
+	          NULL,
+	          LIBCFILE_OPERATION_TYPE_READ,
+	          &number_of_operations,
+	          &number_of_bytes,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
@@ -4166,41 +13573,22 @@ int cfile_test_file_set_block_size(
 	libcerror_error_free(
 	 &error );
 
-	if( ( file_size % 511 ) == 0 )
-	{
-		result = libcfile_file_set_block_size(
-		          NULL,
-		          511,
-		          &error );
-
-		CFILE_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		CFILE_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-	/* Clean up
-	 */
-	result = libcfile_file_set_block_size(
-	          file,
-	          0,
+	result = libcfile_file_reset_statistics(
+	          NULL,
 	          &error );
 
 	CFILE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	CFILE_TEST_ASSERT_IS_NULL(
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -4349,10 +13737,62 @@ int main(
 	 "libcfile_file_write_buffer_with_error_code",
 	 cfile_test_file_write_buffer_with_error_code );
 
+	CFILE_TEST_RUN(
+	 "libcfile_file_write_buffer_at_offset",
+	 cfile_test_file_write_buffer_at_offset );
+
+	CFILE_TEST_RUN(
+	 "libcfile_file_write_vector",
+	 cfile_test_file_write_vector );
+
+	CFILE_TEST_RUN(
+	 "libcfile_file_write_vector_at_offset",
+	 cfile_test_file_write_vector_at_offset );
+
+	CFILE_TEST_RUN(
+	 "libcfile_file_submit_write",
+	 cfile_test_file_submit_write );
+
+	CFILE_TEST_RUN(
+	 "libcfile_file_set_write_buffer_size",
+	 cfile_test_file_set_write_buffer_size );
+
+	CFILE_TEST_RUN(
+	 "libcfile_file_sync",
+	 cfile_test_file_sync );
+
+	CFILE_TEST_RUN(
+	 "libcfile_file_commit",
+	 cfile_test_file_commit );
+
+	CFILE_TEST_RUN(
+	 "libcfile_file_set_writeback_size",
+	 cfile_test_file_set_writeback_size );
+
 	CFILE_TEST_RUN(
 	 "libcfile_file_resize",
 	 cfile_test_file_resize );
 
+	CFILE_TEST_RUN(
+	 "libcfile_file_allocate",
+	 cfile_test_file_allocate );
+
+	CFILE_TEST_RUN(
+	 "libcfile_file_get_next_data_extent",
+	 cfile_test_file_get_next_data_extent );
+
+	CFILE_TEST_RUN(
+	 "libcfile_file_get_extents",
+	 cfile_test_file_get_extents );
+
+#if defined( HAVE_CFILE_TEST_MEMORY )
+
+	CFILE_TEST_RUN(
+	 "libcfile_file_read_write_without_allocation",
+	 cfile_test_file_read_write_without_allocation );
+
+#endif /* defined( HAVE_CFILE_TEST_MEMORY ) */
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	CFILE_TEST_RUN_WITH_ARGS(
 	 "libcfile_file_open",
@@ -4387,6 +13827,16 @@ int main(
 	 cfile_test_file_open_close,
 	 source );
 
+	CFILE_TEST_RUN_WITH_ARGS(
+	 "libcfile_file_get_data_at_offset",
+	 cfile_test_file_get_data_at_offset,
+	 source );
+
+	CFILE_TEST_RUN_WITH_ARGS(
+	 "libcfile_file_open_direct",
+	 cfile_test_file_open_direct,
+	 source );
+
 	/* Initialize test
 	 */
 	result = cfile_test_file_open_source(
@@ -4449,20 +13899,64 @@ int main(
 	 cfile_test_file_read_buffer,
 	 file );
 
-#if defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT ) && defined( WINAPI )
+#if defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT )
 
 	CFILE_TEST_RUN_WITH_ARGS(
 	 "libcfile_internal_file_read_buffer_at_offset_with_error_code",
 	 cfile_test_internal_file_read_buffer_at_offset_with_error_code,
 	 file );
 
-#endif /* defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT ) && defined( WINAPI ) */
+#endif /* defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT ) */
 
 	CFILE_TEST_RUN_WITH_ARGS(
 	 "libcfile_file_read_buffer_with_error_code",
 	 cfile_test_file_read_buffer_with_error_code,
 	 file );
 
+	CFILE_TEST_RUN_WITH_ARGS(
+	 "libcfile_file_read_buffer_at_offset",
+	 cfile_test_file_read_buffer_at_offset,
+	 file );
+
+	CFILE_TEST_RUN_WITH_ARGS(
+	 "libcfile_file_read_buffer_at_offset_with_error_code",
+	 cfile_test_file_read_buffer_at_offset_with_error_code,
+	 file );
+
+	CFILE_TEST_RUN_WITH_ARGS(
+	 "libcfile_file_read_vector",
+	 cfile_test_file_read_vector,
+	 file );
+
+	CFILE_TEST_RUN_WITH_ARGS(
+	 "libcfile_file_read_vector_at_offset",
+	 cfile_test_file_read_vector_at_offset,
+	 file );
+
+	CFILE_TEST_RUN_WITH_ARGS(
+	 "libcfile_file_read_ranges",
+	 cfile_test_file_read_ranges,
+	 file );
+
+	CFILE_TEST_RUN_WITH_ARGS(
+	 "libcfile_file_submit_read",
+	 cfile_test_file_submit_read,
+	 file );
+
+	CFILE_TEST_RUN_WITH_ARGS(
+	 "libcfile_file_copy_range",
+	 cfile_test_file_copy_range,
+	 file );
+
+#if defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+	CFILE_TEST_RUN_WITH_ARGS(
+	 "libcfile_file_splice_to_descriptor",
+	 cfile_test_file_splice_to_descriptor,
+	 file );
+
+#endif /* defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
 	CFILE_TEST_RUN_WITH_ARGS(
 	 "libcfile_file_is_open",
 	 cfile_test_file_is_open,
@@ -4516,6 +14010,26 @@ int main(
 	 cfile_test_file_set_access_behavior,
 	 file );
 
+	CFILE_TEST_RUN_WITH_ARGS(
+	 "libcfile_file_set_readahead_size",
+	 cfile_test_file_set_readahead_size,
+	 file );
+
+	CFILE_TEST_RUN_WITH_ARGS(
+	 "libcfile_file_prefetch",
+	 cfile_test_file_prefetch,
+	 file );
+
+	CFILE_TEST_RUN_WITH_ARGS(
+	 "libcfile_file_get_cache_residency",
+	 cfile_test_file_get_cache_residency,
+	 file );
+
+	CFILE_TEST_RUN_WITH_ARGS(
+	 "libcfile_file_read_cached_buffer_at_offset",
+	 cfile_test_file_read_cached_buffer_at_offset,
+	 file );
+
 #if defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT )
 
 	CFILE_TEST_RUN_WITH_ARGS(
@@ -4530,6 +14044,16 @@ int main(
 	 cfile_test_file_set_block_size,
 	 file );
 
+	CFILE_TEST_RUN_WITH_ARGS(
+	 "libcfile_file_set_cache_size",
+	 cfile_test_file_set_cache_size,
+	 file );
+
+	CFILE_TEST_RUN_WITH_ARGS(
+	 "libcfile_file_get_statistics",
+	 cfile_test_file_get_statistics,
+	 file );
+
 	/* Clean up
 	 */
 	result = cfile_test_file_close_source(
@@ -0,0 +1,549 @@
+/*
+ * Library group commit type test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cfile_test_libcerror.h"
+#include "cfile_test_libcfile.h"
+#include "cfile_test_macros.h"
+#include "cfile_test_memory.h"
+#include "cfile_test_unused.h"
+
+#include "../libcfile/libcfile_group_commit.h"
+
+#if defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT )
+
+/* Tests the libcfile_group_commit_set_interval function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_group_commit_set_interval(
+     void )
+{
+	libcfile_group_commit_t group_commit;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     &group_commit,
+	     0,
+	     sizeof( libcfile_group_commit_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+
+	/* Test regular cases
+	 */
+	result = libcfile_group_commit_set_interval(
+	          &group_commit,
+	          1000000,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CFILE_TEST_ASSERT_EQUAL_UINT64(
+	 "group_commit.interval",
+	 group_commit.interval,
+	 (uint64_t) 1000000 );
+
+	/* Test error cases
+	 */
+	result = libcfile_group_commit_set_interval(
+	          NULL,
+	          1000000,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_group_commit_set_interval(
+	          &group_commit,
+	          (uint64_t) LIBCFILE_MAXIMUM_GROUP_COMMIT_INTERVAL + 1,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( LIBCFILE_HAVE_GROUP_COMMIT_WAIT )
+
+/* Tests the libcfile_group_commit_request, libcfile_group_commit_begin and libcfile_group_commit_end functions
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_group_commit_begin(
+     void )
+{
+	libcfile_group_commit_t group_commit;
+
+	libcerror_error_t *error = NULL;
+	uint64_t sequence        = 0;
+	uint64_t sync_sequence   = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     &group_commit,
+	     0,
+	     sizeof( libcfile_group_commit_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+
+	/* Test regular cases
+	 */
+	result = libcfile_group_commit_request(
+	          &group_commit,
+	          &sequence,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CFILE_TEST_ASSERT_EQUAL_UINT64(
+	 "sequence",
+	 sequence,
+	 (uint64_t) 1 );
+
+	result = libcfile_group_commit_request(
+	          &group_commit,
+	          &sequence,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CFILE_TEST_ASSERT_EQUAL_UINT64(
+	 "sequence",
+	 sequence,
+	 (uint64_t) 2 );
+
+	/* Test that the caller that syncs covers all the requests
+	 */
+	result = libcfile_group_commit_begin(
+	          &group_commit,
+	          2,
+	          &sync_sequence,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CFILE_TEST_ASSERT_EQUAL_UINT64(
+	 "sync_sequence",
+	 sync_sequence,
+	 (uint64_t) 2 );
+
+	result = libcfile_group_commit_end(
+	          &group_commit,
+	          sync_sequence,
+	          1,
+	          0,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_group_commit_begin(
+	          &group_commit,
+	          1,
+	          &sync_sequence,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a request that is covered by a failed sync is not synced again
+	 */
+	result = libcfile_group_commit_request(
+	          &group_commit,
+	          &sequence,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CFILE_TEST_ASSERT_EQUAL_UINT64(
+	 "sequence",
+	 sequence,
+	 (uint64_t) 3 );
+
+	result = libcfile_group_commit_begin(
+	          &group_commit,
+	          3,
+	          &sync_sequence,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_group_commit_end(
+	          &group_commit,
+	          sync_sequence,
+	          0,
+	          5,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CFILE_TEST_ASSERT_EQUAL_UINT64(
+	 "group_commit.completed_sequence",
+	 group_commit.completed_sequence,
+	 (uint64_t) 3 );
+
+	result = libcfile_group_commit_begin(
+	          &group_commit,
+	          3,
+	          &sync_sequence,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that a request after the failed sync is synced
+	 */
+	result = libcfile_group_commit_request(
+	          &group_commit,
+	          &sequence,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_group_commit_begin(
+	          &group_commit,
+	          4,
+	          &sync_sequence,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_group_commit_end(
+	          &group_commit,
+	          sync_sequence,
+	          1,
+	          0,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_group_commit_begin(
+	          &group_commit,
+	          4,
+	          &sync_sequence,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_group_commit_begin(
+	          &group_commit,
+	          3,
+	          &sync_sequence,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = libcfile_group_commit_request(
+	          NULL,
+	          &sequence,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_group_commit_request(
+	          &group_commit,
+	          NULL,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_group_commit_begin(
+	          NULL,
+	          3,
+	          &sync_sequence,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_group_commit_begin(
+	          &group_commit,
+	          3,
+	          NULL,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_group_commit_end(
+	          NULL,
+	          3,
+	          1,
+	          0,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( LIBCFILE_HAVE_GROUP_COMMIT_WAIT ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CFILE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CFILE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CFILE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CFILE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CFILE_TEST_UNREFERENCED_PARAMETER( argc )
+	CFILE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT )
+
+	CFILE_TEST_RUN(
+	 "libcfile_group_commit_set_interval",
+	 cfile_test_group_commit_set_interval );
+
+#if defined( LIBCFILE_HAVE_GROUP_COMMIT_WAIT )
+
+	CFILE_TEST_RUN(
+	 "libcfile_group_commit_begin",
+	 cfile_test_group_commit_begin );
+
+#endif /* defined( LIBCFILE_HAVE_GROUP_COMMIT_WAIT ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT ) */
+}
+
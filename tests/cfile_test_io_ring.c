@@ -0,0 +1,1026 @@
+/*
+ * Library io_ring type test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cfile_test_libcerror.h"
+#include "cfile_test_libcfile.h"
+#include "cfile_test_macros.h"
+#include "cfile_test_memory.h"
+#include "cfile_test_unused.h"
+
+#include "../libcfile/libcfile_io_ring.h"
+
+#if defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT )
+
+/* Tests the libcfile_io_ring_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_io_ring_initialize(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	libcfile_io_ring_t *io_ring = NULL;
+	int result                  = 0;
+
+#if defined( HAVE_CFILE_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 3;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcfile_io_ring_initialize(
+	          &io_ring,
+	          4,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "io_ring",
+	 io_ring );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_io_ring_free(
+	          &io_ring,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "io_ring",
+	 io_ring );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcfile_io_ring_initialize(
+	          NULL,
+	          4,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	io_ring = (libcfile_io_ring_t *) 0x12345678UL;
+
+	result = libcfile_io_ring_initialize(
+	          &io_ring,
+	          4,
+	          &error );
+
+	io_ring = NULL;
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_io_ring_initialize(
+	          &io_ring,
+	          0,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_io_ring_initialize(
+	          &io_ring,
+	          -1,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CFILE_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcfile_io_ring_initialize with malloc failing
+		 */
+		cfile_test_malloc_attempts_before_fail = test_number;
+
+		result = libcfile_io_ring_initialize(
+		          &io_ring,
+		          4,
+		          &error );
+
+		if( cfile_test_malloc_attempts_before_fail != -1 )
+		{
+			cfile_test_malloc_attempts_before_fail = -1;
+
+			if( io_ring != NULL )
+			{
+				libcfile_io_ring_free(
+				 &io_ring,
+				 NULL );
+			}
+		}
+		else
+		{
+			CFILE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CFILE_TEST_ASSERT_IS_NULL(
+			 "io_ring",
+			 io_ring );
+
+			CFILE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CFILE_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_ring != NULL )
+	{
+		libcfile_io_ring_free(
+		 &io_ring,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcfile_io_ring_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_io_ring_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcfile_io_ring_free(
+	          NULL,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcfile_io_ring_append_completion and libcfile_io_ring_poll functions
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_io_ring_append_completion(
+     void )
+{
+	libcfile_io_ring_request_t completions[ 4 ];
+
+	libcerror_error_t *error    = NULL;
+	libcfile_io_ring_t *io_ring = NULL;
+	int number_of_completions   = 0;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	result = libcfile_io_ring_initialize(
+	          &io_ring,
+	          2,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "io_ring",
+	 io_ring );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcfile_io_ring_append_completion(
+	          io_ring,
+	          1,
+	          LIBCFILE_IO_RING_OPERATION_READ,
+	          0,
+	          512,
+	          512,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_io_ring_is_full(
+	          io_ring,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_io_ring_append_completion(
+	          io_ring,
+	          2,
+	          LIBCFILE_IO_RING_OPERATION_READ,
+	          0,
+	          512,
+	          -5,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_io_ring_is_full(
+	          io_ring,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the queue is full
+	 */
+	result = libcfile_io_ring_append_completion(
+	          io_ring,
+	          3,
+	          LIBCFILE_IO_RING_OPERATION_READ,
+	          0,
+	          512,
+	          0,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test retrieving the completions one at a time
+	 */
+	number_of_completions = libcfile_io_ring_poll(
+	                         io_ring,
+	                         completions,
+	                         1,
+	                         1,
+	                         &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_completions",
+	 number_of_completions,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CFILE_TEST_ASSERT_EQUAL_UINT64(
+	 "completions[ 0 ].identifier",
+	 completions[ 0 ].identifier,
+	 (uint64_t) 1 );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "completions[ 0 ].result",
+	 completions[ 0 ].result,
+	 (ssize_t) 512 );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "completions[ 0 ].operation",
+	 (int) completions[ 0 ].operation,
+	 LIBCFILE_IO_RING_OPERATION_READ );
+
+	number_of_completions = libcfile_io_ring_poll(
+	                         io_ring,
+	                         completions,
+	                         4,
+	                         4,
+	                         &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_completions",
+	 number_of_completions,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CFILE_TEST_ASSERT_EQUAL_UINT64(
+	 "completions[ 0 ].identifier",
+	 completions[ 0 ].identifier,
+	 (uint64_t) 2 );
+
+	CFILE_TEST_ASSERT_EQUAL_SSIZE(
+	 "completions[ 0 ].result",
+	 completions[ 0 ].result,
+	 (ssize_t) -5 );
+
+	/* Test polling without outstanding requests
+	 */
+	number_of_completions = libcfile_io_ring_poll(
+	                         io_ring,
+	                         completions,
+	                         4,
+	                         1,
+	                         &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_completions",
+	 number_of_completions,
+	 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcfile_io_ring_append_completion(
+	          NULL,
+	          1,
+	          LIBCFILE_IO_RING_OPERATION_READ,
+	          0,
+	          512,
+	          0,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	number_of_completions = libcfile_io_ring_poll(
+	                         NULL,
+	                         completions,
+	                         4,
+	                         0,
+	                         &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_completions",
+	 number_of_completions,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	number_of_completions = libcfile_io_ring_poll(
+	                         io_ring,
+	                         NULL,
+	                         4,
+	                         0,
+	                         &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_completions",
+	 number_of_completions,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	number_of_completions = libcfile_io_ring_poll(
+	                         io_ring,
+	                         completions,
+	                         0,
+	                         0,
+	                         &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_completions",
+	 number_of_completions,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	number_of_completions = libcfile_io_ring_poll(
+	                         io_ring,
+	                         completions,
+	                         4,
+	                         5,
+	                         &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_completions",
+	 number_of_completions,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcfile_io_ring_free(
+	          &io_ring,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "io_ring",
+	 io_ring );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_ring != NULL )
+	{
+		libcfile_io_ring_free(
+		 &io_ring,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcfile_io_ring_register_buffers function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_io_ring_register_buffers(
+     void )
+{
+	uint8_t buffer[ 64 ];
+
+	uint8_t *buffers[ 1 ]       = { NULL };
+	size_t buffer_sizes[ 1 ]    = { 64 };
+	libcerror_error_t *error    = NULL;
+	libcfile_io_ring_t *io_ring = NULL;
+	int result                  = 0;
+
+	buffers[ 0 ] = buffer;
+
+	/* Initialize test
+	 */
+	result = libcfile_io_ring_initialize(
+	          &io_ring,
+	          4,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "io_ring",
+	 io_ring );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcfile_io_ring_register_buffers(
+	          NULL,
+	          buffers,
+	          buffer_sizes,
+	          1,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_io_ring_register_buffers(
+	          io_ring,
+	          NULL,
+	          buffer_sizes,
+	          1,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_io_ring_register_buffers(
+	          io_ring,
+	          buffers,
+	          NULL,
+	          1,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_io_ring_register_buffers(
+	          io_ring,
+	          buffers,
+	          buffer_sizes,
+	          0,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+	result = libcfile_io_ring_register_buffers(
+	          io_ring,
+	          buffers,
+	          buffer_sizes,
+	          1,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the buffers are already registered
+	 */
+	result = libcfile_io_ring_register_buffers(
+	          io_ring,
+	          buffers,
+	          buffer_sizes,
+	          1,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcfile_io_ring_free(
+	          &io_ring,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "io_ring",
+	 io_ring );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_ring != NULL )
+	{
+		libcfile_io_ring_free(
+		 &io_ring,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcfile_io_ring_submit function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_io_ring_submit(
+     void )
+{
+	uint8_t buffer[ 64 ];
+
+	libcerror_error_t *error    = NULL;
+	libcfile_io_ring_t *io_ring = NULL;
+	int result                  = 0;
+
+#if defined( LIBCFILE_HAVE_IO_URING )
+	uint32_t tail               = 0;
+	int descriptor              = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = libcfile_io_ring_initialize(
+	          &io_ring,
+	          4,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "io_ring",
+	 io_ring );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcfile_io_ring_submit(
+	          NULL,
+	          0,
+	          LIBCFILE_IO_RING_OPERATION_READ,
+	          buffer,
+	          64,
+	          0,
+	          1,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_io_ring_submit(
+	          io_ring,
+	          0,
+	          0xff,
+	          buffer,
+	          64,
+	          0,
+	          1,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_io_ring_submit(
+	          io_ring,
+	          0,
+	          LIBCFILE_IO_RING_OPERATION_READ,
+	          NULL,
+	          64,
+	          0,
+	          1,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( LIBCFILE_HAVE_IO_URING )
+	if( io_ring->descriptor != -1 )
+	{
+		/* Test error case where the kernel does not consume the request
+		 */
+		descriptor = io_ring->descriptor;
+		tail       = *( io_ring->submission_tail );
+
+		io_ring->descriptor = -2;
+
+		result = libcfile_io_ring_submit(
+		          io_ring,
+		          0,
+		          LIBCFILE_IO_RING_OPERATION_READ,
+		          buffer,
+		          64,
+		          0,
+		          1,
+		          &error );
+
+		io_ring->descriptor = descriptor;
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CFILE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		CFILE_TEST_ASSERT_EQUAL_UINT32(
+		 "submission_tail",
+		 *( io_ring->submission_tail ),
+		 tail );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "number_of_requests",
+		 io_ring->number_of_requests,
+		 0 );
+	}
+#endif /* defined( LIBCFILE_HAVE_IO_URING ) */
+
+	/* Clean up
+	 */
+	result = libcfile_io_ring_free(
+	          &io_ring,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "io_ring",
+	 io_ring );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_ring != NULL )
+	{
+		libcfile_io_ring_free(
+		 &io_ring,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CFILE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CFILE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CFILE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CFILE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CFILE_TEST_UNREFERENCED_PARAMETER( argc )
+	CFILE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT )
+
+	CFILE_TEST_RUN(
+	 "libcfile_io_ring_initialize",
+	 cfile_test_io_ring_initialize );
+
+	CFILE_TEST_RUN(
+	 "libcfile_io_ring_free",
+	 cfile_test_io_ring_free );
+
+	CFILE_TEST_RUN(
+	 "libcfile_io_ring_append_completion",
+	 cfile_test_io_ring_append_completion );
+
+	CFILE_TEST_RUN(
+	 "libcfile_io_ring_register_buffers",
+	 cfile_test_io_ring_register_buffers );
+
+	CFILE_TEST_RUN(
+	 "libcfile_io_ring_submit",
+	 cfile_test_io_ring_submit );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT ) */
+}
+
@@ -21,6 +21,10 @@
 
 #include <common.h>
 
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
@@ -195,5 +199,47 @@ void *realloc(
 	return( ptr );
 }
 
+#if defined( HAVE_POSIX_MEMALIGN )
+
+static int (*cfile_test_real_posix_memalign)(void **, size_t, size_t) = NULL;
+int cfile_test_posix_memalign_attempts_before_fail                  = -1;
+
+/* Custom posix_memalign for testing memory error cases
+ * Returns 0 if successful or an error code otherwise
+ */
+int posix_memalign(
+     void **ptr,
+     size_t alignment,
+     size_t size )
+{
+	if( cfile_test_real_posix_memalign == NULL )
+	{
+		cfile_test_real_posix_memalign = dlsym(
+		                                  RTLD_NEXT,
+		                                  "posix_memalign" );
+
+		if( cfile_test_real_posix_memalign == NULL )
+		{
+			return( ENOMEM );
+		}
+	}
+	if( cfile_test_posix_memalign_attempts_before_fail == 0 )
+	{
+		cfile_test_posix_memalign_attempts_before_fail = -1;
+
+		return( ENOMEM );
+	}
+	else if( cfile_test_posix_memalign_attempts_before_fail > 0 )
+	{
+		cfile_test_posix_memalign_attempts_before_fail--;
+	}
+	return( cfile_test_real_posix_memalign(
+	         ptr,
+	         alignment,
+	         size ) );
+}
+
+#endif /* defined( HAVE_POSIX_MEMALIGN ) */
+
 #endif /* defined( HAVE_CFILE_TEST_MEMORY ) */
 
@@ -56,6 +56,12 @@ extern int cfile_test_memset_attempts_before_fail;
 
 extern int cfile_test_realloc_attempts_before_fail;
 
+#if defined( HAVE_POSIX_MEMALIGN )
+
+extern int cfile_test_posix_memalign_attempts_before_fail;
+
+#endif
+
 #endif /* defined( HAVE_CFILE_TEST_MEMORY ) */
 
 #if defined( __cplusplus )
@@ -0,0 +1,779 @@
+/*
+ * Library readahead type test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cfile_test_libcerror.h"
+#include "cfile_test_libcfile.h"
+#include "cfile_test_macros.h"
+#include "cfile_test_memory.h"
+#include "cfile_test_unused.h"
+
+#include "../libcfile/libcfile_readahead.h"
+
+#if defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT )
+
+/* Tests the libcfile_readahead_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_readahead_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libcfile_readahead_t *readahead = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_CFILE_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcfile_readahead_initialize(
+	          &readahead,
+	          1024 * 1024,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "readahead",
+	 readahead );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_readahead_free(
+	          &readahead,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "readahead",
+	 readahead );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcfile_readahead_initialize(
+	          NULL,
+	          1024 * 1024,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	readahead = (libcfile_readahead_t *) 0x12345678UL;
+
+	result = libcfile_readahead_initialize(
+	          &readahead,
+	          1024 * 1024,
+	          &error );
+
+	readahead = NULL;
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_readahead_initialize(
+	          &readahead,
+	          0,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_readahead_initialize(
+	          &readahead,
+	          ( 64 * 1024 * 1024 ) + 1,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CFILE_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcfile_readahead_initialize with malloc failing
+		 */
+		cfile_test_malloc_attempts_before_fail = test_number;
+
+		result = libcfile_readahead_initialize(
+		          &readahead,
+		          1024 * 1024,
+		          &error );
+
+		if( cfile_test_malloc_attempts_before_fail != -1 )
+		{
+			cfile_test_malloc_attempts_before_fail = -1;
+
+			if( readahead != NULL )
+			{
+				libcfile_readahead_free(
+				 &readahead,
+				 NULL );
+			}
+		}
+		else
+		{
+			CFILE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CFILE_TEST_ASSERT_IS_NULL(
+			 "readahead",
+			 readahead );
+
+			CFILE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CFILE_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( readahead != NULL )
+	{
+		libcfile_readahead_free(
+		 &readahead,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcfile_readahead_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_readahead_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcfile_readahead_free(
+	          NULL,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcfile_readahead_update and libcfile_readahead_get_range functions
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_readahead_update(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libcfile_readahead_t *readahead = NULL;
+	size64_t range_size             = 0;
+	off64_t offset                  = 0;
+	off64_t range_offset            = 0;
+	int number_of_ranges            = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libcfile_readahead_initialize(
+	          &readahead,
+	          1024 * 1024,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "readahead",
+	 readahead );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a sequential stream
+	 */
+	result = libcfile_readahead_update(
+	          readahead,
+	          0,
+	          4096,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_readahead_update(
+	          readahead,
+	          4096,
+	          4096,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_readahead_update(
+	          readahead,
+	          8192,
+	          4096,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_readahead_get_range(
+	          readahead,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) 12288 );
+
+	CFILE_TEST_ASSERT_EQUAL_UINT64(
+	 "range_size",
+	 (uint64_t) range_size,
+	 (uint64_t) 131072 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_readahead_get_range(
+	          readahead,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* No new prefetch is started until half the window was read
+	 */
+	for( offset = 12288;
+	     offset < 77824;
+	     offset += 4096 )
+	{
+		result = libcfile_readahead_update(
+		          readahead,
+		          offset,
+		          4096,
+		          &error );
+
+		CFILE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* The window grows when the prefetched data is used
+	 */
+	result = libcfile_readahead_update(
+	          readahead,
+	          77824,
+	          4096,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_readahead_get_range(
+	          readahead,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) 143360 );
+
+	CFILE_TEST_ASSERT_EQUAL_UINT64(
+	 "range_size",
+	 (uint64_t) range_size,
+	 (uint64_t) 200704 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CFILE_TEST_ASSERT_EQUAL_SIZE(
+	 "readahead->window_size",
+	 readahead->window_size,
+	 (size_t) 262144 );
+
+	/* The window shrinks when a read does not follow the stream
+	 */
+	result = libcfile_readahead_update(
+	          readahead,
+	          0,
+	          4096,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CFILE_TEST_ASSERT_EQUAL_SIZE(
+	 "readahead->window_size",
+	 readahead->window_size,
+	 (size_t) 131072 );
+
+	/* Test a strided stream
+	 */
+	result = libcfile_readahead_reset(
+	          readahead,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_readahead_update(
+	          readahead,
+	          0,
+	          512,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_readahead_update(
+	          readahead,
+	          65536,
+	          512,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_readahead_update(
+	          readahead,
+	          131072,
+	          512,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_readahead_update(
+	          readahead,
+	          196608,
+	          512,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	do
+	{
+		result = libcfile_readahead_get_range(
+		          readahead,
+		          &range_offset,
+		          &range_size,
+		          &error );
+
+		CFILE_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CFILE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result == 1 )
+		{
+			CFILE_TEST_ASSERT_EQUAL_INT64(
+			 "range_offset",
+			 (int64_t) range_offset,
+			 (int64_t) 196608 + ( (int64_t) ( number_of_ranges + 1 ) * 65536 ) );
+
+			CFILE_TEST_ASSERT_EQUAL_UINT64(
+			 "range_size",
+			 (uint64_t) range_size,
+			 (uint64_t) 512 );
+
+			number_of_ranges++;
+		}
+	}
+	while( result == 1 );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
+	 64 );
+
+	/* Test error cases
+	 */
+	result = libcfile_readahead_update(
+	          NULL,
+	          0,
+	          4096,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_readahead_update(
+	          readahead,
+	          -1,
+	          4096,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_readahead_get_range(
+	          NULL,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_readahead_get_range(
+	          readahead,
+	          NULL,
+	          &range_size,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_readahead_get_range(
+	          readahead,
+	          &range_offset,
+	          NULL,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_readahead_reset(
+	          NULL,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcfile_readahead_free(
+	          &readahead,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "readahead",
+	 readahead );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( readahead != NULL )
+	{
+		libcfile_readahead_free(
+		 &readahead,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CFILE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CFILE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CFILE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CFILE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CFILE_TEST_UNREFERENCED_PARAMETER( argc )
+	CFILE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT )
+
+	CFILE_TEST_RUN(
+	 "libcfile_readahead_initialize",
+	 cfile_test_readahead_initialize );
+
+	CFILE_TEST_RUN(
+	 "libcfile_readahead_free",
+	 cfile_test_readahead_free );
+
+	CFILE_TEST_RUN(
+	 "libcfile_readahead_update",
+	 cfile_test_readahead_update );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,714 @@
+/*
+ * Library statistics type test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cfile_test_libcerror.h"
+#include "cfile_test_libcfile.h"
+#include "cfile_test_macros.h"
+#include "cfile_test_memory.h"
+#include "cfile_test_unused.h"
+
+#include "../libcfile/libcfile_statistics.h"
+
+#if defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT )
+
+/* Tests the libcfile_statistics_get_operation function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_statistics_get_operation(
+     void )
+{
+	libcfile_statistics_t statistics;
+
+	libcerror_error_t *error      = NULL;
+	uint64_t number_of_bytes      = 0;
+	uint64_t number_of_operations = 0;
+	uint64_t start_timestamp      = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     &statistics,
+	     0,
+	     sizeof( libcfile_statistics_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	start_timestamp = libcfile_statistics_get_timestamp();
+
+	libcfile_statistics_add_operation(
+	 &statistics,
+	 LIBCFILE_OPERATION_TYPE_READ,
+	 512,
+	 start_timestamp );
+
+	libcfile_statistics_add_operation(
+	 &statistics,
+	 LIBCFILE_OPERATION_TYPE_READ,
+	 -1,
+	 start_timestamp );
+
+	libcfile_statistics_add_operation(
+	 &statistics,
+	 LIBCFILE_OPERATION_TYPE_WRITE,
+	 100,
+	 start_timestamp );
+
+	libcfile_statistics_add_operation(
+	 &statistics,
+	 0,
+	 100,
+	 start_timestamp );
+
+	libcfile_statistics_add_operation(
+	 &statistics,
+	 5,
+	 100,
+	 start_timestamp );
+
+	/* Test regular cases
+	 */
+	result = libcfile_statistics_get_operation(
+	          &statistics,
+	          LIBCFILE_OPERATION_TYPE_READ,
+	          &number_of_operations,
+	          &number_of_bytes,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CFILE_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_operations",
+	 number_of_operations,
+	 (uint64_t) 2 );
+
+	CFILE_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_bytes",
+	 number_of_bytes,
+	 (uint64_t) 512 );
+
+	result = libcfile_statistics_get_operation(
+	          &statistics,
+	          LIBCFILE_OPERATION_TYPE_WRITE,
+	          &number_of_operations,
+	          &number_of_bytes,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CFILE_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_operations",
+	 number_of_operations,
+	 (uint64_t) 1 );
+
+	CFILE_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_bytes",
+	 number_of_bytes,
+	 (uint64_t) 100 );
+
+	result = libcfile_statistics_get_operation(
+	          &statistics,
+	          LIBCFILE_OPERATION_TYPE_SEEK,
+	          &number_of_operations,
+	          &number_of_bytes,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CFILE_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_operations",
+	 number_of_operations,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libcfile_statistics_get_operation(
+	          NULL,
+	          LIBCFILE_OPERATION_TYPE_READ,
+	          &number_of_operations,
+	          &number_of_bytes,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_statistics_get_operation(
+	          &statistics,
+	          0,
+	          &number_of_operations,
+	          &number_of_bytes,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_statistics_get_operation(
+	          &statistics,
+	          LIBCFILE_OPERATION_TYPE_READ,
+	          NULL,
+	          &number_of_bytes,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_statistics_get_operation(
+	          &statistics,
+	          LIBCFILE_OPERATION_TYPE_READ,
+	          &number_of_operations,
+	          NULL,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcfile_statistics_get_read_amplification function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_statistics_get_read_amplification(
+     void )
+{
+	libcfile_statistics_t statistics;
+
+	libcerror_error_t *error = NULL;
+	uint64_t number_of_bytes = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     &statistics,
+	     0,
+	     sizeof( libcfile_statistics_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	libcfile_statistics_add_read_amplification(
+	 &statistics,
+	 496 );
+
+	libcfile_statistics_add_read_amplification(
+	 &statistics,
+	 16 );
+
+	/* Test regular cases
+	 */
+	result = libcfile_statistics_get_read_amplification(
+	          &statistics,
+	          &number_of_bytes,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CFILE_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_bytes",
+	 number_of_bytes,
+	 (uint64_t) 512 );
+
+	/* Test error cases
+	 */
+	result = libcfile_statistics_get_read_amplification(
+	          NULL,
+	          &number_of_bytes,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_statistics_get_read_amplification(
+	          &statistics,
+	          NULL,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcfile_statistics_get_latency_histogram function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_statistics_get_latency_histogram(
+     void )
+{
+	libcfile_statistics_t statistics;
+	uint64_t histogram[ LIBCFILE_NUMBER_OF_LATENCY_BUCKETS ];
+
+	libcerror_error_t *error   = NULL;
+	uint64_t number_of_entries = 0;
+	uint64_t start_timestamp   = 0;
+	int bucket_index           = 0;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     &statistics,
+	     0,
+	     sizeof( libcfile_statistics_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	start_timestamp = libcfile_statistics_get_timestamp();
+
+	libcfile_statistics_add_operation(
+	 &statistics,
+	 LIBCFILE_OPERATION_TYPE_SEEK,
+	 0,
+	 start_timestamp );
+
+	libcfile_statistics_add_operation(
+	 &statistics,
+	 LIBCFILE_OPERATION_TYPE_SEEK,
+	 0,
+	 start_timestamp );
+
+	libcfile_statistics_add_operation(
+	 &statistics,
+	 LIBCFILE_OPERATION_TYPE_SEEK,
+	 -1,
+	 start_timestamp );
+
+	/* Test regular cases
+	 */
+	result = libcfile_statistics_get_latency_histogram(
+	          &statistics,
+	          LIBCFILE_OPERATION_TYPE_SEEK,
+	          histogram,
+	          LIBCFILE_NUMBER_OF_LATENCY_BUCKETS,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( bucket_index = 0;
+	     bucket_index < LIBCFILE_NUMBER_OF_LATENCY_BUCKETS;
+	     bucket_index++ )
+	{
+		number_of_entries += histogram[ bucket_index ];
+	}
+	CFILE_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_entries",
+	 number_of_entries,
+	 (uint64_t) 3 );
+
+	/* Test retrieving fewer buckets
+	 */
+	histogram[ 1 ] = 0xffffffffffffffffULL;
+
+	result = libcfile_statistics_get_latency_histogram(
+	          &statistics,
+	          LIBCFILE_OPERATION_TYPE_SEEK,
+	          histogram,
+	          1,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CFILE_TEST_ASSERT_EQUAL_UINT64(
+	 "histogram[ 1 ]",
+	 histogram[ 1 ],
+	 (uint64_t) 0xffffffffffffffffULL );
+
+	/* Test error cases
+	 */
+	result = libcfile_statistics_get_latency_histogram(
+	          NULL,
+	          LIBCFILE_OPERATION_TYPE_SEEK,
+	          histogram,
+	          LIBCFILE_NUMBER_OF_LATENCY_BUCKETS,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_statistics_get_latency_histogram(
+	          &statistics,
+	          -1,
+	          histogram,
+	          LIBCFILE_NUMBER_OF_LATENCY_BUCKETS,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_statistics_get_latency_histogram(
+	          &statistics,
+	          LIBCFILE_OPERATION_TYPE_SEEK,
+	          NULL,
+	          LIBCFILE_NUMBER_OF_LATENCY_BUCKETS,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_statistics_get_latency_histogram(
+	          &statistics,
+	          LIBCFILE_OPERATION_TYPE_SEEK,
+	          histogram,
+	          -1,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcfile_statistics_reset function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_statistics_reset(
+     void )
+{
+	libcfile_statistics_t statistics;
+
+	libcerror_error_t *error      = NULL;
+	uint64_t number_of_bytes      = 0;
+	uint64_t number_of_operations = 0;
+	uint64_t start_timestamp      = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     &statistics,
+	     0,
+	     sizeof( libcfile_statistics_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	start_timestamp = libcfile_statistics_get_timestamp();
+
+	libcfile_statistics_add_operation(
+	 &statistics,
+	 LIBCFILE_OPERATION_TYPE_IO_CONTROL,
+	 4,
+	 start_timestamp );
+
+	libcfile_statistics_add_read_amplification(
+	 &statistics,
+	 32 );
+
+	/* Test regular cases
+	 */
+	result = libcfile_statistics_reset(
+	          &statistics,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_statistics_get_operation(
+	          &statistics,
+	          LIBCFILE_OPERATION_TYPE_IO_CONTROL,
+	          &number_of_operations,
+	          &number_of_bytes,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CFILE_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_operations",
+	 number_of_operations,
+	 (uint64_t) 0 );
+
+	CFILE_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_bytes",
+	 number_of_bytes,
+	 (uint64_t) 0 );
+
+	result = libcfile_statistics_get_read_amplification(
+	          &statistics,
+	          &number_of_bytes,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CFILE_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_bytes",
+	 number_of_bytes,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libcfile_statistics_reset(
+	          NULL,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CFILE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CFILE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CFILE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CFILE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CFILE_TEST_UNREFERENCED_PARAMETER( argc )
+	CFILE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT )
+
+	CFILE_TEST_RUN(
+	 "libcfile_statistics_get_operation",
+	 cfile_test_statistics_get_operation );
+
+	CFILE_TEST_RUN(
+	 "libcfile_statistics_get_read_amplification",
+	 cfile_test_statistics_get_read_amplification );
+
+	CFILE_TEST_RUN(
+	 "libcfile_statistics_get_latency_histogram",
+	 cfile_test_statistics_get_latency_histogram );
+
+	CFILE_TEST_RUN(
+	 "libcfile_statistics_reset",
+	 cfile_test_statistics_reset );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCFILE_DLL_IMPORT ) */
+}
+
@@ -242,6 +242,110 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libcfile_file_exists_with_error_code function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_exists_with_error_code(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t error_code      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcfile_file_exists_with_error_code(
+	          "TestFile",
+	          &error_code,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_file_exists_with_error_code(
+	          "bogus",
+	          &error_code,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CFILE_TEST_ASSERT_NOT_EQUAL_INT32(
+	 "error_code",
+	 (int32_t) error_code,
+	 (int32_t) 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcfile_file_exists_with_error_code(
+	          NULL,
+	          &error_code,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_exists_with_error_code(
+	          "TestFile",
+	          NULL,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases without an error
+	 */
+	result = libcfile_file_exists_with_error_code(
+	          NULL,
+	          &error_code,
+	          NULL );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
 /* Tests the libcfile_file_exists_wide function
@@ -310,6 +414,110 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libcfile_file_exists_wide_with_error_code function
+ * Returns 1 if successful or 0 if not
+ */
+int cfile_test_file_exists_wide_with_error_code(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t error_code      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcfile_file_exists_wide_with_error_code(
+	          L"TestFile",
+	          &error_code,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_file_exists_wide_with_error_code(
+	          L"bogus",
+	          &error_code,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CFILE_TEST_ASSERT_NOT_EQUAL_INT32(
+	 "error_code",
+	 (int32_t) error_code,
+	 (int32_t) 0 );
+
+	CFILE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcfile_file_exists_wide_with_error_code(
+	          NULL,
+	          &error_code,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcfile_file_exists_wide_with_error_code(
+	          L"TestFile",
+	          NULL,
+	          &error );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CFILE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases without an error
+	 */
+	result = libcfile_file_exists_wide_with_error_code(
+	          NULL,
+	          &error_code,
+	          NULL );
+
+	CFILE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
 /* Tests the libcfile_file_remove function
@@ -740,12 +948,20 @@ int main(
 	 "libcfile_file_exists",
 	 cfile_test_file_exists );
 
+	CFILE_TEST_RUN(
+	 "libcfile_file_exists_with_error_code",
+	 cfile_test_file_exists_with_error_code );
+
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
 	CFILE_TEST_RUN(
 	 "libcfile_file_exists_wide",
 	 cfile_test_file_exists_wide );
 
+	CFILE_TEST_RUN(
+	 "libcfile_file_exists_wide_with_error_code",
+	 cfile_test_file_exists_wide_with_error_code );
+
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
 	CFILE_TEST_RUN(
@@ -1,8 +1,30 @@
 #!/bin/sh
 # Script to generate test_inputs.at
 #
+# Usage: generate_test_inputs.sh package_name test_profile
+#
+# Or to generate the cfile_bench input files:
+#
+# Usage: generate_test_inputs.sh --bench [ directory ] [ large file size in MiB ]
+#
+# Creates the following files in directory, which defaults to "bench":
+# * dense_file: a file filled with pseudo random data
+# * sparse_file: a file that mostly consists of holes with a data extent
+#   every 16 MiB
+# * large_file: a file filled with pseudo random data that is intended to
+#   exceed the page cache, defaults to 4096 MiB
+#
+# The files can then be benchmarked with: cfile_bench bench/dense_file
+#
 # Version: 20260617
 
+EXIT_SUCCESS=0;
+EXIT_FAILURE=1;
+
+DENSE_FILE_SIZE=64
+SPARSE_FILE_SIZE=1024
+SPARSE_EXTENT_INTERVAL=16
+
 ignore_list_add() {
     if ! ignore_list_contains "$1"; then
         IGNORE_LIST="${IGNORE_LIST}|$1"
@@ -184,6 +206,69 @@ read_project_ini() {
     fi
 }
 
+generate_dense_file() {
+    FILE=$1
+    SIZE=$2
+
+    dd if=/dev/urandom of="${FILE}" bs=1048576 count=${SIZE} 2>/dev/null
+}
+
+generate_sparse_file() {
+    FILE=$1
+    SIZE=$2
+
+    # Seeking past the end of the output file creates a hole.
+    dd if=/dev/null of="${FILE}" bs=1048576 seek=${SIZE} 2>/dev/null || return ${EXIT_FAILURE}
+
+    OFFSET=0
+    while test ${OFFSET} -lt ${SIZE}; do
+        dd if=/dev/urandom of="${FILE}" bs=1048576 seek=${OFFSET} count=1 conv=notrunc 2>/dev/null || return ${EXIT_FAILURE}
+
+        OFFSET=`expr ${OFFSET} + ${SPARSE_EXTENT_INTERVAL}`
+    done
+}
+
+generate_bench_inputs() {
+    DIRECTORY="$1"
+    LARGE_FILE_SIZE="$2"
+
+    if test -z "${DIRECTORY}"; then
+        DIRECTORY="bench"
+    fi
+    if test -z "${LARGE_FILE_SIZE}"; then
+        LARGE_FILE_SIZE=4096
+    fi
+    if ! test -d "${DIRECTORY}"; then
+        mkdir -p "${DIRECTORY}" || return ${EXIT_FAILURE}
+    fi
+
+    echo "Generating ${DIRECTORY}/dense_file of ${DENSE_FILE_SIZE} MiB"
+    if ! generate_dense_file "${DIRECTORY}/dense_file" ${DENSE_FILE_SIZE}; then
+        echo "Unable to generate dense file"
+        return ${EXIT_FAILURE}
+    fi
+
+    echo "Generating ${DIRECTORY}/sparse_file of ${SPARSE_FILE_SIZE} MiB"
+    if ! generate_sparse_file "${DIRECTORY}/sparse_file" ${SPARSE_FILE_SIZE}; then
+        echo "Unable to generate sparse file"
+        return ${EXIT_FAILURE}
+    fi
+
+    echo "Generating ${DIRECTORY}/large_file of ${LARGE_FILE_SIZE} MiB"
+    if ! generate_dense_file "${DIRECTORY}/large_file" ${LARGE_FILE_SIZE}; then
+        echo "Unable to generate large file"
+        return ${EXIT_FAILURE}
+    fi
+    return ${EXIT_SUCCESS}
+}
+
+if test "$1" = "--bench"; then
+    if ! generate_bench_inputs "$2" "$3"; then
+        exit ${EXIT_FAILURE}
+    fi
+    exit ${EXIT_SUCCESS}
+fi
+
 PACKAGE_NAME="$1"
 TEST_PROFILE="$2"
 AT_FILE="test_inputs_${TEST_PROFILE}.at"
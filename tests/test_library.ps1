@@ -1,6 +1,6 @@
 # Tests library functions and types.
 
-$LibraryTests = "error notify support system_string winapi"
+$LibraryTests = "error block_cache group_commit io_ring notify readahead statistics support system_string winapi"
 $LibraryTestsWithInput = "file"
 $OptionSets = "" -split " "
 